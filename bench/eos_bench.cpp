@@ -0,0 +1,459 @@
+/**
+* @file eos_bench.cpp
+* @brief Replays a recorded session through the native pipeline without ROS
+*
+* Scans, IMU and odometry from a CSV recording, a rosbag2 bag or a simulated
+* run are merged by stamp and pushed through the same stages the node runs:
+* IMU and odometry feed the pose filter, and every scan goes through the
+* emergency stop, preprocessing, inference, the rolling map, the distance
+* field and the local planner. Each stage is timed and its heap allocations
+* counted; the result is written as JSON so runs can be compared by script.
+*
+*     eos_bench --synthetic 60 --output bench.json
+*     eos_bench --csv data/sensor_data.csv --model models/eos.eosm
+*     eos_bench --rosbag2 bags/run_01
+*/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/allocation_guard.hpp"
+#include "eos_robotics/distance_field.hpp"
+#include "eos_robotics/emergency_stop.hpp"
+#include "eos_robotics/latency_histogram.hpp"
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+#include "eos_robotics/navigation_controller.hpp"
+#include "eos_robotics/neural_backend.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+#include "eos_robotics/pose_ekf.hpp"
+#include "eos_robotics/scan_preprocessor.hpp"
+
+#include "recording.hpp"
+
+namespace
+{
+
+using eos::bench::Recording;
+
+struct Options
+{
+    std::string csv;
+    std::string rosbag2;
+    double synthetic_seconds = 60.0;
+    std::size_t synthetic_beams = 360;
+    std::uint32_t seed = 1;
+    std::string scan_topic = "/scan";
+    std::string imu_topic = "/imu";
+    std::string odom_topic = "/odom";
+
+    std::string model;
+    eos::BackendType backend = eos::BackendType::Cpu;
+    bool has_goal = false;
+    eos::Pose2D goal;
+    float max_extrapolation = 0.25f;  ///< localization.max_extrapolation
+
+    std::size_t repeat = 1;
+    std::size_t warmup = 10;  ///< scans of each pass left out of the statistics
+    std::string output;
+    std::string save_csv;
+};
+
+void usage(const char* program)
+{
+    std::fprintf(stderr,
+                 "Usage: %s [source] [options]\n"
+                 "Sources (default: --synthetic 60):\n"
+                 "  --csv PATH            recording in the eos_bench CSV format\n"
+                 "  --rosbag2 URI         bag with LaserScan, Imu and Odometry topics\n"
+                 "  --synthetic SECONDS   simulated run in a walled room\n"
+                 "Options:\n"
+                 "  --beams N             beams per simulated scan (360)\n"
+                 "  --seed N              noise seed of the simulated run (1)\n"
+                 "  --scan-topic, --imu-topic, --odom-topic NAME   bag topics\n"
+                 "  --model PATH          .eosm model; random weights when absent\n"
+                 "  --backend cpu|cuda    neural backend (cpu)\n"
+                 "  --goal X,Y            plan towards a goal instead of exploring\n"
+                 "  --repeat N            replay the recording N times (1)\n"
+                 "  --warmup N            scans per pass left out of the statistics (10)\n"
+                 "  --output PATH         write the JSON report here instead of stdout\n"
+                 "  --save-csv PATH       also write the loaded recording as CSV\n",
+                 program);
+}
+
+Options parse_options(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string flag = argv[i];
+        if (flag == "--help" || flag == "-h") {
+            usage(argv[0]);
+            std::exit(0);
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for " + flag);
+        }
+        const std::string value = argv[++i];
+        if (flag == "--csv") {
+            options.csv = value;
+        } else if (flag == "--rosbag2") {
+            options.rosbag2 = value;
+        } else if (flag == "--synthetic") {
+            options.synthetic_seconds = std::stod(value);
+        } else if (flag == "--beams") {
+            options.synthetic_beams = std::stoul(value);
+        } else if (flag == "--seed") {
+            options.seed = static_cast<std::uint32_t>(std::stoul(value));
+        } else if (flag == "--scan-topic") {
+            options.scan_topic = value;
+        } else if (flag == "--imu-topic") {
+            options.imu_topic = value;
+        } else if (flag == "--odom-topic") {
+            options.odom_topic = value;
+        } else if (flag == "--model") {
+            options.model = value;
+        } else if (flag == "--backend") {
+            options.backend = eos::parse_backend_type(value);
+        } else if (flag == "--goal") {
+            const std::size_t comma = value.find(',');
+            if (comma == std::string::npos) {
+                throw std::invalid_argument("--goal takes X,Y");
+            }
+            options.goal = eos::Pose2D{std::stof(value.substr(0, comma)),
+                                       std::stof(value.substr(comma + 1)), 0.0f};
+            options.has_goal = true;
+        } else if (flag == "--repeat") {
+            options.repeat = std::max<std::size_t>(std::stoul(value), 1);
+        } else if (flag == "--warmup") {
+            options.warmup = std::stoul(value);
+        } else if (flag == "--output") {
+            options.output = value;
+        } else if (flag == "--save-csv") {
+            options.save_csv = value;
+        } else {
+            throw std::invalid_argument("Unknown option " + flag);
+        }
+    }
+    return options;
+}
+
+Recording load(const Options& options)
+{
+    if (!options.csv.empty()) {
+        return eos::bench::load_csv(options.csv);
+    }
+    if (!options.rosbag2.empty()) {
+#if defined(EOS_BENCH_WITH_ROSBAG2)
+        return eos::bench::load_rosbag2(options.rosbag2, options.scan_topic, options.imu_topic,
+                                        options.odom_topic);
+#else
+        throw std::runtime_error("eos_bench was built without rosbag2_cpp");
+#endif
+    }
+    return eos::bench::synthesize_recording(options.synthetic_seconds, options.synthetic_beams,
+                                            options.seed);
+}
+
+enum Stage
+{
+    Localization,
+    EmergencyStop,
+    Preprocess,
+    Inference,
+    Mapping,
+    DistanceField,
+    Planning,
+    Scan,  ///< every stage a scan goes through, end to end
+    kStageCount
+};
+
+constexpr const char* kStageNames[kStageCount] = {
+    "localization", "emergency_stop", "preprocess", "inference",
+    "mapping",      "distance_field", "planning",   "scan",
+};
+
+struct StageStats
+{
+    eos::LatencyHistogram histogram;
+    std::uint64_t allocations = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+* @brief Times @p work into @p stats when @p record, counting its allocations
+*/
+template <typename Work>
+void measure(StageStats& stats, bool record, Work&& work)
+{
+    const std::uint64_t allocations = eos::thread_allocation_count();
+    const Clock::time_point start = Clock::now();
+    work();
+    const Clock::time_point end = Clock::now();
+    if (record) {
+        stats.histogram.record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        stats.allocations += eos::thread_allocation_count() - allocations;
+    }
+}
+
+/**
+* @brief The node's native stages with their default parameters
+*/
+struct Pipeline
+{
+    explicit Pipeline(const Options& options)
+        : emergency_stop(eos::EmergencyStopConfig{}),
+          preprocessor(eos::ScanPreprocessorConfig{}),
+          grid(eos::OccupancyGridConfig{}),
+          field(grid, planner_config.robot_radius + planner_config.safety_distance),
+          planner(planner_config)
+    {
+        eos::LifConfig lif;
+        lif.input_size = preprocessor.size();
+        auto model = options.model.empty() ? eos::LifModel::random(lif)
+                                           : eos::LifModel::open(options.model, lif);
+        backend = eos::make_backend(options.backend, std::move(model), lif);
+        if (backend->input_size() != preprocessor.size()) {
+            throw std::invalid_argument("Model takes " + std::to_string(backend->input_size()) +
+                                        " inputs, the preprocessor makes " +
+                                        std::to_string(preprocessor.size()));
+        }
+        rates.assign(backend->output_size(), 0.0f);
+        planner.use_map(&field);
+        if (options.has_goal) {
+            planner.set_goal(options.goal);
+        }
+    }
+
+    eos::NavigationControllerConfig planner_config;
+    eos::PoseEkf ekf;
+    eos::EmergencyStop emergency_stop;
+    eos::ScanPreprocessor preprocessor;
+    std::unique_ptr<eos::NeuralBackend> backend;
+    std::vector<float> rates;
+    eos::OccupancyGrid grid;
+    eos::DistanceField field;
+    eos::NavigationController planner;
+    eos::Pose2D odom_pose;
+};
+
+struct PassTotals
+{
+    std::uint64_t scans = 0;
+    std::uint64_t stopped_scans = 0;
+    std::uint64_t stop_triggers = 0;
+    double linear_sum = 0.0;
+};
+
+/**
+* @brief Replay @p recording once through a fresh pipeline
+*
+* @p skip scans are run but not recorded, so one-off growth of the cached
+* tables does not land in the statistics.
+*/
+void replay(const Recording& recording, const Options& options, std::size_t skip,
+            std::array<StageStats, kStageCount>& stats, PassTotals& totals)
+{
+    Pipeline pipeline(options);
+    std::size_t scan_index = 0;
+    std::size_t imu_index = 0;
+    std::size_t odom_index = 0;
+
+    while (scan_index < recording.scans.size()) {
+        const std::int64_t scan_stamp = recording.scans[scan_index].stamp_ns;
+        const bool imu_next = imu_index < recording.imu.size() &&
+                              recording.imu[imu_index].stamp_ns <= scan_stamp;
+        const bool odom_next = odom_index < recording.odom.size() &&
+                               recording.odom[odom_index].stamp_ns <= scan_stamp;
+        const bool record = scan_index >= skip;
+
+        if (odom_next && (!imu_next || recording.odom[odom_index].stamp_ns <=
+                                           recording.imu[imu_index].stamp_ns)) {
+            const auto& odom = recording.odom[odom_index++];
+            pipeline.odom_pose = eos::Pose2D{odom.x, odom.y, odom.yaw};
+            measure(stats[Localization], record, [&] {
+                pipeline.ekf.add_odometry(odom.stamp_ns, odom.x, odom.y, odom.yaw,
+                                          odom.linear_velocity, odom.angular_velocity);
+            });
+            continue;
+        }
+        if (imu_next) {
+            const auto& imu = recording.imu[imu_index++];
+            measure(stats[Localization], record, [&] {
+                pipeline.ekf.add_imu(imu.stamp_ns, imu.angular_velocity,
+                                     imu.forward_acceleration);
+            });
+            continue;
+        }
+
+        const auto& scan = recording.scans[scan_index++];
+        const float* ranges = scan.ranges.data();
+        const std::size_t count = scan.ranges.size();
+        bool stopped = false;
+        measure(stats[Scan], record, [&] {
+            measure(stats[EmergencyStop], record, [&] {
+                stopped = pipeline.emergency_stop.check_scan(ranges, count, scan.range_min,
+                                                             scan.angle_min, scan.angle_increment);
+            });
+            measure(stats[Preprocess], record, [&] {
+                pipeline.preprocessor.process(ranges, count, scan.range_min, scan.range_max,
+                                              scan.angle_min, scan.angle_increment);
+            });
+            measure(stats[Inference], record, [&] {
+                pipeline.backend->run(pipeline.preprocessor.output(), pipeline.rates.data());
+            });
+
+            const eos::PoseEstimate estimate = pipeline.ekf.estimate();
+            const eos::Pose2D pose = estimate.valid
+                ? estimate.at(scan.stamp_ns, options.max_extrapolation)
+                : pipeline.odom_pose;
+            measure(stats[Mapping], record, [&] {
+                pipeline.grid.recenter(pose.x, pose.y);
+                pipeline.grid.integrate_scan(pose, ranges, count, scan.range_min, scan.range_max,
+                                             scan.angle_min, scan.angle_increment);
+            });
+            measure(stats[DistanceField], record, [&] { pipeline.field.update(); });
+
+            // A latched stop holds the robot still, as the control callback does
+            measure(stats[Planning], record, [&] {
+                pipeline.planner.update_scan(ranges, count, scan.range_min, scan.range_max,
+                                             scan.angle_min, scan.angle_increment);
+                if (stopped) {
+                    pipeline.planner.stop();
+                } else {
+                    totals.linear_sum += pipeline.planner.compute_command(pose).linear;
+                }
+            });
+        });
+        if (record) {
+            ++totals.scans;
+            totals.stopped_scans += stopped ? 1 : 0;
+        }
+    }
+    totals.stop_triggers += pipeline.emergency_stop.triggers();
+}
+
+std::string json_string(const std::string& text)
+{
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            quoted += escaped;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+void write_report(std::FILE* out, const Recording& recording, const Options& options,
+                  const std::array<StageStats, kStageCount>& stats, const PassTotals& totals,
+                  double wall_seconds)
+{
+    const double duration = recording.scans.size() < 2
+        ? 0.0
+        : 1e-9 * static_cast<double>(recording.scans.back().stamp_ns -
+                                     recording.scans.front().stamp_ns);
+    const eos::HistogramSummary scan = stats[Scan].histogram.summarize();
+    const double busy_seconds = 1e-9 * scan.mean_ns * static_cast<double>(scan.count);
+
+    std::fprintf(out, "{\n");
+    std::fprintf(out, "  \"source\": %s,\n", json_string(recording.source).c_str());
+    std::fprintf(out, "  \"recording\": {\"scans\": %zu, \"imu\": %zu, \"odom\": %zu, "
+                      "\"duration_s\": %.3f},\n",
+                 recording.scans.size(), recording.imu.size(), recording.odom.size(), duration);
+    std::fprintf(out, "  \"backend\": \"%s\",\n", eos::to_string(options.backend));
+    std::fprintf(out, "  \"repeat\": %zu,\n", options.repeat);
+    std::fprintf(out, "  \"allocation_hooks\": %s,\n",
+                 eos::allocation_hooks_enabled() ? "true" : "false");
+    std::fprintf(out, "  \"measured_scans\": %llu,\n",
+                 static_cast<unsigned long long>(totals.scans));
+    std::fprintf(out, "  \"stopped_scans\": %llu,\n",
+                 static_cast<unsigned long long>(totals.stopped_scans));
+    std::fprintf(out, "  \"emergency_stop_triggers\": %llu,\n",
+                 static_cast<unsigned long long>(totals.stop_triggers));
+    std::fprintf(out, "  \"mean_linear_command\": %.4f,\n",
+                 totals.scans > totals.stopped_scans
+                     ? totals.linear_sum / static_cast<double>(totals.scans - totals.stopped_scans)
+                     : 0.0);
+    std::fprintf(out, "  \"wall_time_s\": %.6f,\n", wall_seconds);
+    std::fprintf(out, "  \"scans_per_second\": %.1f,\n",
+                 busy_seconds > 0.0 ? static_cast<double>(scan.count) / busy_seconds : 0.0);
+    std::fprintf(out, "  \"realtime_factor\": %.1f,\n",
+                 wall_seconds > 0.0
+                     ? duration * static_cast<double>(options.repeat) / wall_seconds
+                     : 0.0);
+    std::fprintf(out, "  \"stages\": {\n");
+    for (std::size_t i = 0; i < kStageCount; ++i) {
+        const eos::HistogramSummary summary = stats[i].histogram.summarize();
+        std::fprintf(out,
+                     "    \"%s\": {\"count\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %lld, "
+                     "\"p90_ns\": %lld, \"p99_ns\": %lld, \"p999_ns\": %lld, \"max_ns\": %lld, "
+                     "\"allocations\": %llu}%s\n",
+                     kStageNames[i], static_cast<unsigned long long>(summary.count),
+                     summary.mean_ns, static_cast<long long>(summary.p50_ns),
+                     static_cast<long long>(summary.p90_ns),
+                     static_cast<long long>(summary.p99_ns),
+                     static_cast<long long>(summary.p999_ns),
+                     static_cast<long long>(summary.max_ns),
+                     static_cast<unsigned long long>(stats[i].allocations),
+                     i + 1 < kStageCount ? "," : "");
+    }
+    std::fprintf(out, "  }\n}\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    try {
+        const Options options = parse_options(argc, argv);
+        const Recording recording = load(options);
+        if (recording.empty()) {
+            throw std::runtime_error("Recording " + recording.source + " has no scans");
+        }
+        if (!options.save_csv.empty()) {
+            eos::bench::save_csv(recording, options.save_csv);
+        }
+
+        std::array<StageStats, kStageCount> stats;
+        PassTotals totals;
+        const Clock::time_point start = Clock::now();
+        for (std::size_t pass = 0; pass < options.repeat; ++pass) {
+            replay(recording, options, options.warmup, stats, totals);
+        }
+        const double wall_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::FILE* out = stdout;
+        if (!options.output.empty()) {
+            out = std::fopen(options.output.c_str(), "w");
+            if (!out) {
+                throw std::runtime_error("Cannot write report " + options.output);
+            }
+        }
+        write_report(out, recording, options, stats, totals, wall_seconds);
+        if (out != stdout) {
+            std::fclose(out);
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::fprintf(stderr, "eos_bench: %s\n", e.what());
+        return 1;
+    }
+}
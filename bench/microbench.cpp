@@ -0,0 +1,216 @@
+/**
+* @file microbench.cpp
+* @brief Google Benchmark cases for the native kernels, one stage at a time
+*
+* Every case runs on scans from the simulated session eos_bench replays, and
+* every case is parameterized by the size that drives its cost: beams per
+* scan, hidden_neurons, grid cells per side or lattice size. The kernels'
+* instruction set and the compiler are added to the benchmark context, so a
+* JSON baseline says what it was built with:
+*
+*     eos_microbench --benchmark_out=gcc-avx2.json --benchmark_out_format=json
+*     compare.py benchmarks gcc-avx2.json clang-avx2.json
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "eos_robotics/distance_field.hpp"
+#include "eos_robotics/kernels.hpp"
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/navigation_controller.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+#include "eos_robotics/scan_preprocessor.hpp"
+
+#include "recording.hpp"
+
+namespace
+{
+
+using eos::bench::Recording;
+using eos::bench::ScanRecord;
+
+const ScanRecord& room_scan(std::size_t beams)
+{
+    // One scan per beam count, kept for the process so setup stays cheap
+    static std::map<std::size_t, Recording> sessions;
+    auto session = sessions.find(beams);
+    if (session == sessions.end()) {
+        session = sessions.emplace(beams, eos::bench::synthesize_recording(0.0, beams, 1)).first;
+    }
+    return session->second.scans.front();
+}
+
+eos::Pose2D start_pose(const Recording& recording)
+{
+    const auto& odom = recording.odom.front();
+    return eos::Pose2D{odom.x, odom.y, odom.yaw};
+}
+
+eos::OccupancyGridConfig grid_config(std::size_t cells)
+{
+    eos::OccupancyGridConfig config;
+    config.cells = cells;
+    return config;
+}
+
+void integrate(eos::OccupancyGrid& grid, const eos::Pose2D& pose, const ScanRecord& scan)
+{
+    grid.integrate_scan(pose, scan.ranges.data(), scan.ranges.size(), scan.range_min,
+                        scan.range_max, scan.angle_min, scan.angle_increment);
+}
+
+// Args: beams, binning strategy (0 min, 1 mean, 2 sector)
+void BM_ScanPreprocess(benchmark::State& state)
+{
+    const ScanRecord& scan = room_scan(static_cast<std::size_t>(state.range(0)));
+    eos::ScanPreprocessorConfig config;
+    const eos::BinningStrategy strategies[] = {
+        eos::BinningStrategy::Min, eos::BinningStrategy::Mean, eos::BinningStrategy::Sector};
+    const char* names[] = {"min", "mean", "sector"};
+    config.strategy = strategies[state.range(1)];
+    eos::ScanPreprocessor preprocessor(config);
+
+    for (auto _ : state) {
+        preprocessor.process(scan.ranges.data(), scan.ranges.size(), scan.range_min,
+                             scan.range_max, scan.angle_min, scan.angle_increment);
+        benchmark::DoNotOptimize(preprocessor.output());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel(names[state.range(1)]);
+}
+BENCHMARK(BM_ScanPreprocess)->ArgsProduct({{360, 720, 1440, 2880}, {0, 1, 2}});
+
+// Args: hidden_neurons, propagation (0 dense, 1 sparse); items are timesteps
+void BM_LifTimestep(benchmark::State& state)
+{
+    eos::LifConfig config;
+    config.hidden_neurons = static_cast<std::size_t>(state.range(0));
+    config.propagation =
+        state.range(1) == 0 ? eos::PropagationMode::Dense : eos::PropagationMode::Sparse;
+    eos::LifEngine engine(config);
+
+    // Inputs of a real scan, so spike density is what the node sees
+    eos::ScanPreprocessor preprocessor(eos::ScanPreprocessorConfig{});
+    const ScanRecord& scan = room_scan(360);
+    preprocessor.process(scan.ranges.data(), scan.ranges.size(), scan.range_min, scan.range_max,
+                         scan.angle_min, scan.angle_increment);
+    std::vector<float> rates(engine.output_size());
+
+    for (auto _ : state) {
+        engine.run(preprocessor.output(), rates.data());
+        benchmark::DoNotOptimize(rates.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(config.time_steps));
+    state.SetLabel(state.range(1) == 0 ? "dense" : "sparse");
+}
+BENCHMARK(BM_LifTimestep)->ArgsProduct({{64, 128, 256, 512}, {0, 1}});
+
+// Args: beams, grid cells per side; items are beams
+void BM_GridIntegrateScan(benchmark::State& state)
+{
+    const ScanRecord& scan = room_scan(static_cast<std::size_t>(state.range(0)));
+    eos::OccupancyGrid grid(grid_config(static_cast<std::size_t>(state.range(1))));
+    const eos::Pose2D pose{0.0f, -1.5f, 0.0f};
+    grid.recenter(pose.x, pose.y);
+
+    for (auto _ : state) {
+        integrate(grid, pose, scan);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GridIntegrateScan)->ArgsProduct({{360, 1440}, {128, 256, 512}});
+
+// Args: grid cells per side; the robot drives the simulated loop, one scan per update
+void BM_DistanceFieldUpdate(benchmark::State& state)
+{
+    static const Recording session = eos::bench::synthesize_recording(30.0, 360, 1);
+    eos::NavigationControllerConfig planner;
+    eos::OccupancyGrid grid(grid_config(static_cast<std::size_t>(state.range(0))));
+    eos::DistanceField field(grid, planner.robot_radius + planner.safety_distance);
+
+    std::size_t scan = 0;
+    std::size_t recomputed = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        // Odometry runs at twice the scan rate in the simulated session
+        const auto& odom = session.odom[std::min(2 * scan, session.odom.size() - 1)];
+        grid.recenter(odom.x, odom.y);
+        integrate(grid, eos::Pose2D{odom.x, odom.y, odom.yaw}, session.scans[scan]);
+        scan = (scan + 1) % session.scans.size();
+        state.ResumeTiming();
+
+        recomputed += field.update();
+    }
+    state.counters["cells"] = benchmark::Counter(
+        static_cast<double>(recomputed), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_DistanceFieldUpdate)->Arg(128)->Arg(256)->Arg(512)
+    ->Unit(benchmark::kMicrosecond);
+
+// Args: linear samples, angular samples, distance field attached (0/1); every
+// sample of the lattice is scored, so time scales with lattice size alone
+void BM_PlannerCommand(benchmark::State& state)
+{
+    static const Recording session = eos::bench::synthesize_recording(0.0, 360, 1);
+    const ScanRecord& scan = session.scans.front();
+    const eos::Pose2D pose = start_pose(session);
+
+    eos::NavigationControllerConfig config;
+    config.linear_samples = static_cast<std::size_t>(state.range(0));
+    config.angular_samples = static_cast<std::size_t>(state.range(1));
+    config.max_linear_acceleration = config.max_linear_velocity / config.control_period;
+    config.max_angular_acceleration = 2.0f * config.max_angular_velocity / config.control_period;
+    eos::NavigationController planner(config);
+    eos::OccupancyGrid grid(grid_config(256));
+    eos::DistanceField field(grid, config.robot_radius + config.safety_distance);
+    grid.recenter(pose.x, pose.y);
+    integrate(grid, pose, scan);
+    field.update();
+    if (state.range(2) != 0) {
+        planner.use_map(&field);
+    }
+    planner.update_scan(scan.ranges.data(), scan.ranges.size(), scan.range_min, scan.range_max,
+                        scan.angle_min, scan.angle_increment);
+
+    std::size_t evaluated = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(planner.compute_command(pose));
+        evaluated += planner.evaluated_samples();
+    }
+    state.counters["samples"] = benchmark::Counter(
+        static_cast<double>(evaluated), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<std::int64_t>(evaluated));
+}
+BENCHMARK(BM_PlannerCommand)
+    ->Args({11, 41, 0})
+    ->Args({31, 101, 0})
+    ->Args({31, 101, 1})
+    ->Args({61, 201, 1});
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::AddCustomContext("eos_instruction_set", eos::kernels::instruction_set());
+#if defined(__clang__)
+    benchmark::AddCustomContext("eos_compiler", "clang " __clang_version__);
+#elif defined(__GNUC__)
+    benchmark::AddCustomContext("eos_compiler", "gcc " __VERSION__);
+#endif
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
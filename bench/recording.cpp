@@ -0,0 +1,276 @@
+/**
+* @file recording.cpp
+* @brief CSV reader/writer and simulated sessions for eos_bench
+*/
+
+#include "recording.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace eos
+{
+namespace bench
+{
+
+namespace
+{
+
+constexpr float kPi = 3.14159265358979f;
+
+/// Splits one CSV row and converts its fields, reporting the row on failure
+class Row
+{
+public:
+    Row(const std::string& line, const std::string& path, std::size_t number)
+        : path_(path), number_(number)
+    {
+        std::size_t begin = 0;
+        while (true) {
+            const std::size_t end = line.find(',', begin);
+            fields_.push_back(line.substr(begin, end - begin));
+            if (end == std::string::npos) {
+                break;
+            }
+            begin = end + 1;
+        }
+    }
+
+    std::size_t size() const { return fields_.size(); }
+    const std::string& text(std::size_t i) const { return fields_[i]; }
+
+    float number(std::size_t i) const
+    {
+        const char* begin = fields_[i].c_str();
+        char* end = nullptr;
+        errno = 0;
+        const float value = std::strtof(begin, &end);
+        if (end == begin || errno == ERANGE) {
+            fail("field " + std::to_string(i + 1) + " is not a number");
+        }
+        return value;
+    }
+
+    std::int64_t stamp() const
+    {
+        const char* begin = fields_[0].c_str();
+        char* end = nullptr;
+        errno = 0;
+        const long long value = std::strtoll(begin, &end, 10);
+        if (end == begin || errno == ERANGE) {
+            fail("stamp is not an integer");
+        }
+        return value;
+    }
+
+    void expect(std::size_t count) const
+    {
+        if (fields_.size() != count) {
+            fail("expected " + std::to_string(count) + " fields, got " +
+                 std::to_string(fields_.size()));
+        }
+    }
+
+    [[noreturn]] void fail(const std::string& what) const
+    {
+        throw std::runtime_error(path_ + ":" + std::to_string(number_) + ": " + what);
+    }
+
+private:
+    const std::string& path_;
+    std::size_t number_;
+    std::vector<std::string> fields_;
+};
+
+template <typename Record>
+void sort_stream(std::vector<Record>& records)
+{
+    std::stable_sort(records.begin(), records.end(),
+                     [](const Record& a, const Record& b) { return a.stamp_ns < b.stamp_ns; });
+}
+
+/// Distance along a ray to a circle, or +inf if it misses
+float ray_circle(float ox, float oy, float dx, float dy, float cx, float cy, float radius)
+{
+    const float fx = ox - cx;
+    const float fy = oy - cy;
+    const float b = fx * dx + fy * dy;
+    const float c = fx * fx + fy * fy - radius * radius;
+    const float disc = b * b - c;
+    if (disc < 0.0f) {
+        return std::numeric_limits<float>::infinity();
+    }
+    const float t = -b - std::sqrt(disc);
+    return t > 0.0f ? t : std::numeric_limits<float>::infinity();
+}
+
+}  // namespace
+
+void sort_by_stamp(Recording& recording)
+{
+    sort_stream(recording.scans);
+    sort_stream(recording.imu);
+    sort_stream(recording.odom);
+}
+
+Recording load_csv(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot open recording " + path);
+    }
+
+    Recording recording;
+    recording.source = path;
+    std::string line;
+    std::size_t number = 0;
+    while (std::getline(file, line)) {
+        ++number;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#' || line.rfind("stamp_ns", 0) == 0) {
+            continue;
+        }
+
+        const Row row(line, path, number);
+        if (row.size() < 2) {
+            row.fail("expected a stamp and a message type");
+        }
+        const std::string& type = row.text(1);
+        if (type == "scan") {
+            if (row.size() < 7) {
+                row.fail("a scan needs its geometry and at least one range");
+            }
+            ScanRecord scan;
+            scan.stamp_ns = row.stamp();
+            scan.angle_min = row.number(2);
+            scan.angle_increment = row.number(3);
+            scan.range_min = row.number(4);
+            scan.range_max = row.number(5);
+            scan.ranges.reserve(row.size() - 6);
+            for (std::size_t i = 6; i < row.size(); ++i) {
+                scan.ranges.push_back(row.number(i));
+            }
+            recording.scans.push_back(std::move(scan));
+        } else if (type == "imu") {
+            row.expect(4);
+            recording.imu.push_back(ImuRecord{row.stamp(), row.number(2), row.number(3)});
+        } else if (type == "odom") {
+            row.expect(7);
+            recording.odom.push_back(OdomRecord{row.stamp(), row.number(2), row.number(3),
+                                                row.number(4), row.number(5), row.number(6)});
+        } else {
+            row.fail("unknown message type '" + type + "'");
+        }
+    }
+
+    sort_by_stamp(recording);
+    return recording;
+}
+
+void save_csv(const Recording& recording, const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        throw std::runtime_error("Cannot write recording " + path);
+    }
+    std::fprintf(file, "# eos_bench recording: %s\n", recording.source.c_str());
+    for (const auto& scan : recording.scans) {
+        std::fprintf(file, "%lld,scan,%.9g,%.9g,%.9g,%.9g", static_cast<long long>(scan.stamp_ns),
+                     scan.angle_min, scan.angle_increment, scan.range_min, scan.range_max);
+        for (const float range : scan.ranges) {
+            std::fprintf(file, ",%.6g", range);
+        }
+        std::fputc('\n', file);
+    }
+    for (const auto& imu : recording.imu) {
+        std::fprintf(file, "%lld,imu,%.9g,%.9g\n", static_cast<long long>(imu.stamp_ns),
+                     imu.angular_velocity, imu.forward_acceleration);
+    }
+    for (const auto& odom : recording.odom) {
+        std::fprintf(file, "%lld,odom,%.9g,%.9g,%.9g,%.9g,%.9g\n",
+                     static_cast<long long>(odom.stamp_ns), odom.x, odom.y, odom.yaw,
+                     odom.linear_velocity, odom.angular_velocity);
+    }
+    const bool failed = std::ferror(file) != 0;
+    if (std::fclose(file) != 0 || failed) {
+        throw std::runtime_error("Failed writing recording " + path);
+    }
+}
+
+Recording synthesize_recording(double seconds, std::size_t beams, std::uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> range_noise(0.0f, 0.01f);
+    std::normal_distribution<float> imu_noise(0.0f, 0.02f);
+    std::bernoulli_distribution dropout(0.01);
+
+    // 0.3 m/s on a 1.5 m circle around the centre of a 6 m room
+    const float v = 0.3f;
+    const float w = v / 1.5f;
+    const float room = 3.0f;
+    struct Pillar
+    {
+        float x, y, radius;
+    };
+    const Pillar pillars[] = {{0.0f, 0.0f, 0.3f}, {2.2f, 1.8f, 0.2f}, {-2.0f, -2.1f, 0.25f}};
+
+    Recording recording;
+    recording.source = "synthetic";
+    const std::int64_t end_ns = static_cast<std::int64_t>(seconds * 1e9);
+    const float increment = 2.0f * kPi / static_cast<float>(beams);
+    for (std::int64_t t_ns = 0; t_ns <= end_ns; t_ns += 10000000) {
+        const float t = static_cast<float>(t_ns) * 1e-9f;
+        const float yaw = w * t;
+        const float x = 1.5f * std::sin(yaw);
+        const float y = 1.5f * (1.0f - std::cos(yaw)) - 1.5f;
+
+        recording.imu.push_back(ImuRecord{t_ns, w + imu_noise(rng), imu_noise(rng)});
+        if (t_ns % 50000000 == 0) {
+            recording.odom.push_back(OdomRecord{t_ns, x, y, yaw, v, w});
+        }
+        if (t_ns % 100000000 != 0) {
+            continue;
+        }
+
+        ScanRecord scan;
+        scan.stamp_ns = t_ns;
+        scan.angle_min = -kPi;
+        scan.angle_increment = increment;
+        scan.range_min = 0.12f;
+        scan.range_max = 3.5f;
+        scan.ranges.resize(beams);
+        for (std::size_t i = 0; i < beams; ++i) {
+            const float angle = yaw + scan.angle_min + static_cast<float>(i) * increment;
+            const float dx = std::cos(angle);
+            const float dy = std::sin(angle);
+            float range = std::numeric_limits<float>::infinity();
+            // Walls of the square room
+            if (dx > 1e-6f) range = std::min(range, (room - x) / dx);
+            if (dx < -1e-6f) range = std::min(range, (-room - x) / dx);
+            if (dy > 1e-6f) range = std::min(range, (room - y) / dy);
+            if (dy < -1e-6f) range = std::min(range, (-room - y) / dy);
+            for (const Pillar& pillar : pillars) {
+                range = std::min(range, ray_circle(x, y, dx, dy, pillar.x, pillar.y, pillar.radius));
+            }
+            range += range_noise(rng);
+            scan.ranges[i] = range > scan.range_max || dropout(rng)
+                ? std::numeric_limits<float>::infinity()
+                : range;
+        }
+        recording.scans.push_back(std::move(scan));
+    }
+    return recording;
+}
+
+}  // namespace bench
+}  // namespace eos
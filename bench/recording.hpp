@@ -0,0 +1,110 @@
+/**
+* @file recording.hpp
+* @brief Recorded scans, IMU and odometry for offline replay by eos_bench
+*/
+
+#ifndef EOS_ROBOTICS__BENCH__RECORDING_HPP_
+#define EOS_ROBOTICS__BENCH__RECORDING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+namespace bench
+{
+
+struct ScanRecord
+{
+    std::int64_t stamp_ns = 0;
+    float angle_min = 0.0f;
+    float angle_increment = 0.0f;
+    float range_min = 0.0f;
+    float range_max = 0.0f;
+    std::vector<float> ranges;
+};
+
+/// The fields of sensor_msgs/Imu the node consumes
+struct ImuRecord
+{
+    std::int64_t stamp_ns = 0;
+    float angular_velocity = 0.0f;      ///< angular_velocity.z
+    float forward_acceleration = 0.0f;  ///< linear_acceleration.x
+};
+
+/// The fields of nav_msgs/Odometry the node consumes
+struct OdomRecord
+{
+    std::int64_t stamp_ns = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float yaw = 0.0f;
+    float linear_velocity = 0.0f;
+    float angular_velocity = 0.0f;
+};
+
+/**
+* @brief One sensor session, each stream sorted by stamp
+*/
+struct Recording
+{
+    std::string source;
+    std::vector<ScanRecord> scans;
+    std::vector<ImuRecord> imu;
+    std::vector<OdomRecord> odom;
+
+    bool empty() const { return scans.empty(); }
+};
+
+/**
+* @brief Stable-sort each stream of @p recording by stamp
+*/
+void sort_by_stamp(Recording& recording);
+
+/**
+* @brief Read a recording from CSV, one message per row
+*
+*     stamp_ns,scan,angle_min,angle_increment,range_min,range_max,r0,r1,...
+*     stamp_ns,imu,angular_velocity_z,linear_acceleration_x
+*     stamp_ns,odom,x,y,yaw,linear_velocity,angular_velocity
+*
+* Blank lines, lines starting with '#' and a "stamp_ns,..." header are
+* skipped; "inf" and "nan" are accepted as ranges.
+*
+* @throws std::runtime_error for an unreadable file or a malformed row
+*/
+Recording load_csv(const std::string& path);
+
+/**
+* @brief Write @p recording in the format load_csv() reads
+*
+* @throws std::runtime_error on I/O failure
+*/
+void save_csv(const Recording& recording, const std::string& path);
+
+/**
+* @brief Simulated session: a robot circling a walled room with pillars
+*
+* Scans are ray-cast at 10 Hz with @p beams beams over 360 degrees, IMU
+* samples come at 100 Hz and odometry at 20 Hz, all with light noise.
+*/
+Recording synthesize_recording(double seconds, std::size_t beams, std::uint32_t seed);
+
+#if defined(EOS_BENCH_WITH_ROSBAG2)
+/**
+* @brief Read the scan, IMU and odometry topics of a rosbag2 bag
+*
+* Stamps are the message header stamps.
+*
+* @throws std::runtime_error if the bag cannot be opened
+*/
+Recording load_rosbag2(const std::string& uri, const std::string& scan_topic,
+                       const std::string& imu_topic, const std::string& odom_topic);
+#endif
+
+}  // namespace bench
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__BENCH__RECORDING_HPP_
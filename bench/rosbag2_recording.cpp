@@ -0,0 +1,92 @@
+/**
+* @file rosbag2_recording.cpp
+* @brief Reads scan, IMU and odometry topics of a rosbag2 bag without spinning a node
+*/
+
+#include "recording.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <nav_msgs/msg/odometry.hpp>
+#include <rclcpp/serialization.hpp>
+#include <rclcpp/serialized_message.hpp>
+#include <rclcpp/time.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <sensor_msgs/msg/imu.hpp>
+#include <sensor_msgs/msg/laser_scan.hpp>
+
+namespace eos
+{
+namespace bench
+{
+
+namespace
+{
+
+template <typename Message>
+Message deserialize(const rosbag2_storage::SerializedBagMessage& bag_message)
+{
+    static const rclcpp::Serialization<Message> serialization;
+    const rclcpp::SerializedMessage serialized(*bag_message.serialized_data);
+    Message message;
+    serialization.deserialize_message(&serialized, &message);
+    return message;
+}
+
+std::int64_t stamp_of(const builtin_interfaces::msg::Time& stamp)
+{
+    return rclcpp::Time(stamp).nanoseconds();
+}
+
+}  // namespace
+
+Recording load_rosbag2(const std::string& uri, const std::string& scan_topic,
+                       const std::string& imu_topic, const std::string& odom_topic)
+{
+    rosbag2_cpp::Reader reader;
+    try {
+        reader.open(uri);
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Cannot open bag " + uri + ": " + e.what());
+    }
+
+    Recording recording;
+    recording.source = uri;
+    while (reader.has_next()) {
+        const auto bag_message = reader.read_next();
+        if (bag_message->topic_name == scan_topic) {
+            const auto scan = deserialize<sensor_msgs::msg::LaserScan>(*bag_message);
+            ScanRecord record;
+            record.stamp_ns = stamp_of(scan.header.stamp);
+            record.angle_min = scan.angle_min;
+            record.angle_increment = scan.angle_increment;
+            record.range_min = scan.range_min;
+            record.range_max = scan.range_max;
+            record.ranges = scan.ranges;
+            recording.scans.push_back(std::move(record));
+        } else if (bag_message->topic_name == imu_topic) {
+            const auto imu = deserialize<sensor_msgs::msg::Imu>(*bag_message);
+            recording.imu.push_back(ImuRecord{stamp_of(imu.header.stamp),
+                                              static_cast<float>(imu.angular_velocity.z),
+                                              static_cast<float>(imu.linear_acceleration.x)});
+        } else if (bag_message->topic_name == odom_topic) {
+            const auto odom = deserialize<nav_msgs::msg::Odometry>(*bag_message);
+            // Yaw of a planar orientation, as in the node's odometry callback
+            const auto& q = odom.pose.pose.orientation;
+            const double yaw = std::atan2(2.0 * (q.w * q.z + q.x * q.y),
+                                          1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+            recording.odom.push_back(OdomRecord{
+                stamp_of(odom.header.stamp), static_cast<float>(odom.pose.pose.position.x),
+                static_cast<float>(odom.pose.pose.position.y), static_cast<float>(yaw),
+                static_cast<float>(odom.twist.twist.linear.x),
+                static_cast<float>(odom.twist.twist.angular.z)});
+        }
+    }
+    // Bags are in receive order; replay goes by header stamp
+    sort_by_stamp(recording);
+    return recording;
+}
+
+}  // namespace bench
+}  // namespace eos
@@ -0,0 +1,100 @@
+/**
+* @file aligned_buffer.hpp
+* @brief Cache-line aligned, fixed-size storage for the native kernels
+*/
+
+#ifndef EOS_ROBOTICS__ALIGNED_BUFFER_HPP_
+#define EOS_ROBOTICS__ALIGNED_BUFFER_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace eos
+{
+
+/**
+* @brief Round @p value up to the next multiple of @p multiple
+*/
+constexpr std::size_t round_up(std::size_t value, std::size_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/**
+* @brief Zero-initialised heap array aligned to a 64-byte cache line
+*
+* Used for weights, membrane potentials and sensor buffers so SIMD loads
+* never straddle cache lines. The size is fixed at construction; the buffer
+* is move-only and never reallocates.
+*/
+template <typename T>
+class AlignedBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "AlignedBuffer only holds trivially copyable types");
+
+public:
+    static constexpr std::size_t alignment = 64;
+
+    AlignedBuffer() = default;
+
+    explicit AlignedBuffer(std::size_t size)
+        : size_(size)
+    {
+        if (size_ == 0) {
+            return;
+        }
+        const std::size_t bytes = round_up(size_ * sizeof(T), alignment);
+        void* raw = std::aligned_alloc(alignment, bytes);
+        if (!raw) {
+            throw std::bad_alloc();
+        }
+        std::memset(raw, 0, bytes);
+        data_.reset(static_cast<T*>(raw));
+    }
+
+    AlignedBuffer(AlignedBuffer&&) noexcept = default;
+    AlignedBuffer& operator=(AlignedBuffer&&) noexcept = default;
+    AlignedBuffer(const AlignedBuffer&) = delete;
+    AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+    T* data() { return data_.get(); }
+    const T* data() const { return data_.get(); }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+
+    T* begin() { return data(); }
+    T* end() { return data() + size_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + size_; }
+
+    /**
+     * @brief Reset every element to zero without reallocating
+     */
+    void zero()
+    {
+        if (size_ != 0) {
+            std::memset(static_cast<void*>(data_.get()), 0, size_ * sizeof(T));
+        }
+    }
+
+private:
+    struct FreeDeleter
+    {
+        void operator()(T* ptr) const { std::free(ptr); }
+    };
+
+    std::unique_ptr<T[], FreeDeleter> data_;
+    std::size_t size_ = 0;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__ALIGNED_BUFFER_HPP_
@@ -0,0 +1,61 @@
+/**
+* @file allocation_guard.hpp
+* @brief Heap allocation counting for the allocation-free hot path
+*
+* Built with EOS_ALLOCATION_HOOKS (on by default in Debug builds), the global
+* operator new is replaced by a counting version and EOS_ASSERT_NO_ALLOCATIONS
+* aborts if its enclosing scope allocated. Without the define both are free.
+*/
+
+#ifndef EOS_ROBOTICS__ALLOCATION_GUARD_HPP_
+#define EOS_ROBOTICS__ALLOCATION_GUARD_HPP_
+
+#include <cstdint>
+
+namespace eos
+{
+
+/**
+* @brief True when the counting operator new is linked in
+*/
+bool allocation_hooks_enabled();
+
+/**
+* @brief Heap allocations made by the calling thread so far (0 without hooks)
+*/
+std::uint64_t thread_allocation_count();
+
+/**
+* @brief Heap allocations made by all threads so far (0 without hooks)
+*/
+std::uint64_t total_allocation_count();
+
+/**
+* @brief Aborts on destruction if the calling thread allocated during its lifetime
+*/
+class AllocationGuard
+{
+public:
+    explicit AllocationGuard(const char* scope);
+    ~AllocationGuard();
+
+    AllocationGuard(const AllocationGuard&) = delete;
+    AllocationGuard& operator=(const AllocationGuard&) = delete;
+
+private:
+    const char* scope_;
+    std::uint64_t start_;
+};
+
+}  // namespace eos
+
+#if defined(EOS_ALLOCATION_HOOKS)
+#define EOS_ALLOCATION_GUARD_CONCAT_(a, b) a##b
+#define EOS_ALLOCATION_GUARD_NAME_(line) EOS_ALLOCATION_GUARD_CONCAT_(eos_allocation_guard_, line)
+#define EOS_ASSERT_NO_ALLOCATIONS(scope) \
+    ::eos::AllocationGuard EOS_ALLOCATION_GUARD_NAME_(__LINE__)(scope)
+#else
+#define EOS_ASSERT_NO_ALLOCATIONS(scope) static_cast<void>(0)
+#endif
+
+#endif  // EOS_ROBOTICS__ALLOCATION_GUARD_HPP_
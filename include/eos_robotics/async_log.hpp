@@ -0,0 +1,338 @@
+/**
+* @file async_log.hpp
+* @brief Throttled, sampled logging for hot callbacks, formatted on a background thread
+*
+* A hot-path log call checks its subsystem's level (one relaxed load), then
+* its call site's sampling and throttling, and only then copies the format
+* pointer and up to kMaxLogArgs scalar arguments into a fixed-size record
+* on a lock-free bounded queue. The printf-style formatting and the call
+* into the real logger happen on the logger's own thread. A full queue
+* drops the record and counts it instead of blocking the callback.
+*
+* Formats and %s arguments must outlive the record, e.g. string literals
+* or the names returned by the to_string() helpers; only pointers are
+* queued.
+*/
+
+#ifndef EOS_ROBOTICS__ASYNC_LOG_HPP_
+#define EOS_ROBOTICS__ASYNC_LOG_HPP_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace eos
+{
+
+enum class LogLevel : std::uint8_t
+{
+    Debug = 0,
+    Info,
+    Warn,
+    Error,
+    Off,
+};
+
+/**
+* @brief Parts of the node with their own level (debug.enable_*_debug)
+*/
+enum class LogSubsystem : std::uint8_t
+{
+    Perception = 0,  ///< laser, IMU and odometry callbacks
+    Neural,          ///< inference
+    Navigation,      ///< planning and control
+    Count,
+};
+
+const char* to_string(LogSubsystem subsystem);
+
+/**
+* @throws std::invalid_argument for anything but debug, info, warn, error or off
+*/
+LogLevel parse_log_level(const std::string& name);
+
+constexpr std::size_t kMaxLogArgs = 6;
+
+/**
+* @brief One queued argument; the record keeps the value, not the expression
+*/
+struct LogArg
+{
+    enum class Type : std::uint8_t
+    {
+        Int,
+        Uint,
+        Double,
+        String,
+    };
+
+    Type type = Type::Int;
+    union
+    {
+        long long i;
+        unsigned long long u;
+        double d;
+        const char* s;
+    };
+
+    LogArg() : i(0) {}
+
+    template <typename T>
+    static LogArg from(T value)
+    {
+        LogArg arg;
+        if constexpr (std::is_same_v<T, bool>) {
+            arg.type = Type::Int;
+            arg.i = value ? 1 : 0;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            arg.type = Type::Double;
+            arg.d = static_cast<double>(value);
+        } else if constexpr (std::is_enum_v<T>) {
+            arg.type = Type::Int;
+            arg.i = static_cast<long long>(value);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            arg.type = Type::Int;
+            arg.i = value;
+        } else if constexpr (std::is_integral_v<T>) {
+            arg.type = Type::Uint;
+            arg.u = value;
+        } else {
+            static_assert(std::is_convertible_v<T, const char*>,
+                          "log arguments are numbers, enums or static strings");
+            arg.type = Type::String;
+            arg.s = value;
+        }
+        return arg;
+    }
+};
+
+/**
+* @brief A log call waiting to be formatted
+*/
+struct LogRecord
+{
+    std::int64_t stamp_ns = 0;
+    const char* format = nullptr;
+    std::uint64_t suppressed = 0;  ///< calls of the site skipped since its last record
+    LogLevel level = LogLevel::Info;
+    LogSubsystem subsystem = LogSubsystem::Perception;
+    std::uint8_t arg_count = 0;
+    std::array<LogArg, kMaxLogArgs> args;
+};
+
+/**
+* @brief printf-style formatting of @p record's format and arguments
+*
+* Conversions are matched to arguments in order; each argument is printed
+* with the flags, width and precision of its conversion but according to
+* its own type, so a mismatched length modifier cannot misread it. Missing
+* arguments print as "?".
+*/
+std::string format_record(const LogRecord& record);
+
+/**
+* @brief Sampling and throttling counters of one call site
+*
+* A call is let through if it is the first of sample_every calls and at
+* least throttle_ns after the last one let through.
+*/
+struct LogSiteState
+{
+    /// Count the call and decide; on true, @p suppressed gets the calls skipped since the last pass
+    bool admit(std::int64_t now_ns, std::int64_t throttle_ns, std::uint32_t sample_every,
+               std::uint64_t& suppressed);
+
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> skipped{0};
+    std::atomic<std::int64_t> last_ns{0};
+};
+
+/**
+* @brief Rate limits of one call site together with their own counters
+*
+* EOS_HOT_LOG does not use this: it keeps its counters in the AsyncLog it
+* writes to, so nodes sharing a process throttle independently.
+*/
+struct LogSite
+{
+    LogSite(std::int64_t throttle_ns, std::uint32_t sample_every)
+        : throttle_ns(throttle_ns), sample_every(sample_every > 0 ? sample_every : 1)
+    {
+    }
+
+    /// Count the call and decide; on true, @p suppressed gets the calls skipped since the last pass
+    bool admit(std::int64_t now_ns, std::uint64_t& suppressed)
+    {
+        return state.admit(now_ns, throttle_ns, sample_every, suppressed);
+    }
+
+    const std::int64_t throttle_ns;
+    const std::uint32_t sample_every;
+    LogSiteState state;
+};
+
+/**
+* @brief Lock-free bounded multi-producer queue and the thread that drains it
+*
+* write() may be called from any number of threads and never blocks,
+* allocates or formats. The sink runs on the logger's thread only.
+*/
+class AsyncLog
+{
+public:
+    using Sink = std::function<void(LogLevel level, LogSubsystem subsystem,
+                                    const std::string& text)>;
+
+    /// Call sites whose counters each log keeps; IDs beyond it share slots
+    static constexpr std::size_t kMaxSites = 128;
+
+    /**
+     * @param capacity Records in flight, rounded up to a power of two
+     * @param sink Receives the formatted records, in queue order
+     */
+    AsyncLog(std::size_t capacity, Sink sink);
+
+    /// Drains what is queued, then stops the thread
+    ~AsyncLog();
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    void set_level(LogSubsystem subsystem, LogLevel level)
+    {
+        levels_[static_cast<std::size_t>(subsystem)].store(level, std::memory_order_relaxed);
+    }
+
+    LogLevel level(LogSubsystem subsystem) const
+    {
+        return levels_[static_cast<std::size_t>(subsystem)].load(std::memory_order_relaxed);
+    }
+
+    bool enabled(LogSubsystem subsystem, LogLevel level) const
+    {
+        return level >= this->level(subsystem) && level != LogLevel::Off;
+    }
+
+    /// A process-wide ID for one EOS_HOT_LOG call site
+    static std::size_t register_site();
+
+    /**
+     * @brief Queue a record if the level, sampling and throttling of @p site let it through
+     *
+     * @return true if a record was queued
+     */
+    template <typename... Args>
+    bool write(LogSite& site, LogSubsystem subsystem, LogLevel level, const char* format,
+               Args... args)
+    {
+        return write_with(site.state, site.throttle_ns, site.sample_every, subsystem, level,
+                          format, args...);
+    }
+
+    /**
+     * @brief write() for call site @p site_id, whose counters this log keeps
+     *
+     * Every AsyncLog rate-limits the site on its own, so the robots of a
+     * fleet process do not suppress each other's records.
+     */
+    template <typename... Args>
+    bool write_site(std::size_t site_id, std::int64_t throttle_ns, std::uint32_t sample_every,
+                    LogSubsystem subsystem, LogLevel level, const char* format, Args... args)
+    {
+        return write_with(sites_[site_id % kMaxSites], throttle_ns,
+                          sample_every > 0 ? sample_every : 1, subsystem, level, format, args...);
+    }
+
+    /// Block until everything queued so far has reached the sink; not for hot paths
+    void flush();
+
+    /// Records lost to a full queue
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    static std::int64_t now_ns();
+
+private:
+    template <typename... Args>
+    bool write_with(LogSiteState& site, std::int64_t throttle_ns, std::uint32_t sample_every,
+                    LogSubsystem subsystem, LogLevel level, const char* format, Args... args)
+    {
+        static_assert(sizeof...(Args) <= kMaxLogArgs, "too many log arguments");
+        if (!enabled(subsystem, level)) {
+            return false;
+        }
+        const std::int64_t now = now_ns();
+        std::uint64_t suppressed = 0;
+        if (!site.admit(now, throttle_ns, sample_every, suppressed)) {
+            return false;
+        }
+        LogRecord record;
+        record.stamp_ns = now;
+        record.format = format;
+        record.suppressed = suppressed;
+        record.level = level;
+        record.subsystem = subsystem;
+        record.arg_count = static_cast<std::uint8_t>(sizeof...(Args));
+        std::size_t i = 0;
+        ((record.args[i++] = LogArg::from(args)), ...);
+        static_cast<void>(i);
+        return push(record);
+    }
+
+    // Vyukov bounded queue: each cell's sequence tells producers and the
+    // consumer whose turn it is, so neither side takes a lock
+    struct alignas(64) Cell
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        LogRecord record;
+    };
+
+    bool push(const LogRecord& record);
+    bool pop(LogRecord& record);
+    void run();
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::uint64_t> enqueue_{0};
+    alignas(64) std::uint64_t dequeue_ = 0;
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<std::uint64_t> delivered_{0};
+    std::array<std::atomic<LogLevel>, static_cast<std::size_t>(LogSubsystem::Count)> levels_;
+    std::array<LogSiteState, kMaxSites> sites_;
+
+    Sink sink_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable drained_;
+    bool stopping_ = false;
+    std::thread worker_;
+};
+
+}  // namespace eos
+
+/**
+* @brief Log through an AsyncLog from a hot path
+*
+* Lets through at most one call per throttle_ms and one in sample_every
+* (0 or 1 for all); the arguments are only evaluated when the subsystem's
+* level is enabled. The call site only keeps its ID in a function-local
+* static; its counters live in @p log.
+*/
+#define EOS_HOT_LOG(log, subsystem, level, throttle_ms, sample_every, ...)                     \
+    do {                                                                                      \
+        if ((log).enabled((subsystem), (level))) {                                            \
+            static const std::size_t eos_hot_log_site_ = ::eos::AsyncLog::register_site();    \
+            (log).write_site(eos_hot_log_site_,                                               \
+                             static_cast<std::int64_t>(throttle_ms) * 1000000,                \
+                             (sample_every), (subsystem), (level), __VA_ARGS__);              \
+        }                                                                                     \
+    } while (0)
+
+#endif  // EOS_ROBOTICS__ASYNC_LOG_HPP_
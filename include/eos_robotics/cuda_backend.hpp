@@ -0,0 +1,33 @@
+/**
+* @file cuda_backend.hpp
+* @brief CUDA implementation of NeuralBackend, built with EOS_ENABLE_CUDA
+*/
+
+#ifndef EOS_ROBOTICS__CUDA_BACKEND_HPP_
+#define EOS_ROBOTICS__CUDA_BACKEND_HPP_
+
+#include <memory>
+
+#include "eos_robotics/neural_backend.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Upload @p model to the current CUDA device and capture its inference graph
+*
+* The whole fixed-length window (input upload, state reset, time_steps x
+* layers of matvec + LIF update, rate readout and download) is captured once
+* into a CUDA graph, so each run() is one graph launch between two copies to
+* and from pinned host buffers. Propagation is always dense on the GPU; the
+* event-driven path only pays off on the CPU. Synapse pruning is applied to
+* the uploaded weights.
+*
+* @throws std::runtime_error if no device is available or CUDA calls fail
+*/
+std::unique_ptr<NeuralBackend> make_cuda_backend(
+    std::shared_ptr<const LifModel> model, const LifConfig& config);
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__CUDA_BACKEND_HPP_
@@ -0,0 +1,93 @@
+/**
+* @file distance_field.hpp
+* @brief Incrementally maintained obstacle distance layer over the occupancy grid
+*/
+
+#ifndef EOS_ROBOTICS__DISTANCE_FIELD_HPP_
+#define EOS_ROBOTICS__DISTANCE_FIELD_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Euclidean distance from every cell of the grid window to the nearest
+*        occupied cell, saturated at max_distance()
+*
+* update() reads the grid's dirty region and the moves of its window and
+* recomputes only the cells within max_distance() of a change, with the
+* exact two-pass distance transform of Felzenszwalb and Huttenlocher run over
+* that patch. A clearance query is then a single lookup, whatever the number
+* of obstacles. Distances are measured between cell centres; cells outside
+* the window, like unknown ones, count as free.
+*
+* All scratch space is allocated at construction: update() never touches
+* the heap.
+*/
+class DistanceField
+{
+public:
+    /**
+     * @param grid grid the field follows; must outlive the field
+     * @param max_distance distances saturate here, in meters
+     * @throws std::invalid_argument for a non-positive max_distance
+     */
+    DistanceField(OccupancyGrid& grid, float max_distance);
+
+    /**
+     * @brief Catch up with the grid and clear its dirty region
+     * @return cells recomputed
+     */
+    std::size_t update();
+
+    /// Distance in meters from a cell to the nearest occupied cell
+    float distance_cell(long cx, long cy) const
+    {
+        return grid_->contains_cell(cx, cy) ? distances_[index(cx, cy)] : max_distance_;
+    }
+
+    float distance(float x, float y) const
+    {
+        return distance_cell(grid_->cell_of(x), grid_->cell_of(y));
+    }
+
+    float max_distance() const { return max_distance_; }
+    const OccupancyGrid& grid() const { return *grid_; }
+
+private:
+    /// Wrap-around row-major index; a cell keeps its slot while it stays in the window
+    std::size_t index(long cx, long cy) const
+    {
+        return (static_cast<std::size_t>(cy) & mask_) * grid_->cells() +
+               (static_cast<std::size_t>(cx) & mask_);
+    }
+
+    /// Recompute the cells within reach of @p changed, clipped to the window
+    std::size_t refresh(const CellRegion& changed);
+    CellRegion clip(const CellRegion& region, long margin) const;
+    void transform_line(const float* input, std::size_t count, float* output);
+
+    OccupancyGrid* grid_;
+    float max_distance_;
+    long reach_;          ///< max_distance in whole cells
+    float far_;           ///< squared cell distance standing in for "no obstacle"
+    std::size_t mask_;
+    long origin_x_;
+    long origin_y_;
+
+    AlignedBuffer<float> distances_;
+    AlignedBuffer<float> columns_;   ///< column pass output, row-major over the patch
+    std::vector<float> line_in_;
+    std::vector<float> line_out_;
+    std::vector<long> envelope_sites_;
+    std::vector<float> envelope_bounds_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__DISTANCE_FIELD_HPP_
@@ -0,0 +1,98 @@
+/**
+* @file emergency_stop.hpp
+* @brief Latched obstacle stop checked on every scan, ahead of the planner
+*/
+
+#ifndef EOS_ROBOTICS__EMERGENCY_STOP_HPP_
+#define EOS_ROBOTICS__EMERGENCY_STOP_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eos
+{
+
+/**
+* @brief Stop and release distances of the sector ahead of the robot
+*/
+struct EmergencyStopConfig
+{
+    float stop_distance = 0.2f;     ///< navigation.emergency_stop_distance
+    float release_distance = 0.3f;  ///< the latch clears once the sector is clear this far
+    float half_angle = 1.0f;        ///< half-width of the sector around the heading, rad
+    float recovery_turn_rate = 0.4f;  ///< navigation.emergency_stop_recovery_turn_rate, rad/s
+};
+
+/**
+* @brief Minimum-range check over the scan beams that overlap the heading
+*
+* check_scan() runs in the laser callback, so a stop is decided one scan
+* after an obstacle appears instead of on the next control tick. Only the
+* beams within half_angle of straight ahead are reduced, with the
+* min_valid_range kernel, straight from the raw ranges. Once the nearest of
+* them falls within stop_distance the stop latches, and it only clears on a
+* scan whose sector is clear beyond release_distance.
+*
+* A latch does not freeze the robot: limit() still lets through the parts of
+* a command that do not close on the obstacle, and turns the robot in place
+* towards the clearer half of the sector when nothing else is left, until
+* the sector clears and the latch releases by itself.
+*
+* The latch is read from the control thread while the sensing thread sets
+* it; check_scan() itself must only be called from one thread.
+*/
+class EmergencyStop
+{
+public:
+    /**
+     * @throws std::invalid_argument for a non-positive stop distance, a
+     *         release distance below it, or a sector outside (0, pi]
+     */
+    explicit EmergencyStop(const EmergencyStopConfig& config);
+
+    /**
+     * @brief Check one scan and update the latch
+     * @return true while stopped
+     */
+    bool check_scan(const float* ranges, std::size_t count, float range_min, float angle_min,
+                    float angle_increment);
+
+    bool stopped() const { return stopped_.load(std::memory_order_acquire); }
+
+    /// Nearest return in the sector of the last scan; +inf if it had none
+    float nearest() const { return nearest_; }
+
+    /// Times the stop has latched
+    std::uint64_t triggers() const { return triggers_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Restrict a planned command to motion that cannot close on the obstacle
+     *
+     * While latched, forward motion is dropped; reversing and turning pass.
+     * If neither is left the robot turns in place at recovery_turn_rate
+     * towards the side of the sector with more room. Unlatched, the command
+     * passes unchanged.
+     */
+    void limit(double& linear, double& angular) const;
+
+    /// Drop the latch without waiting for a clear scan
+    void reset() { stopped_.store(false, std::memory_order_release); }
+
+    const EmergencyStopConfig& config() const { return config_; }
+
+private:
+    /// Nearest valid return between @p from and @p to rad of the heading
+    float sector_min(const float* ranges, std::size_t count, float range_min, float angle_min,
+                     float angle_increment, float from, float to) const;
+
+    EmergencyStopConfig config_;
+    std::atomic<bool> stopped_{false};
+    std::atomic<std::uint64_t> triggers_{0};
+    std::atomic<float> recovery_side_{1.0f};  ///< +1 turns left, -1 right
+    float nearest_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__EMERGENCY_STOP_HPP_
@@ -0,0 +1,239 @@
+#ifndef EOS_ROBOTICS__EOS_CORE_H_
+#define EOS_ROBOTICS__EOS_CORE_H_
+
+/* C ABI of the Rust core (src/ffi.rs); regenerate with cbindgen --config cbindgen.toml */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Result of a C ABI call
+ */
+typedef enum EosStatus {
+  /**
+   * The call succeeded
+   */
+  EOS_STATUS_OK = 0,
+  /**
+   * A required pointer was null or a buffer had the wrong length
+   */
+  EOS_STATUS_INVALID_ARGUMENT = 1,
+  /**
+   * The core rejected the request; see eos_last_error_message()
+   */
+  EOS_STATUS_FAILED = 2,
+  /**
+   * The core panicked; the handle should be freed
+   */
+  EOS_STATUS_PANIC = 3,
+} EosStatus;
+
+/**
+ * Planner and controller driven together, one step per control tick
+ */
+typedef struct EosNavigator EosNavigator;
+
+/**
+ * SNN engine handle
+ */
+typedef struct EosSnn EosSnn;
+
+/**
+ * Navigation limits, mirroring the navigation block of params.yaml
+ */
+typedef struct EosNavigationParams {
+  /**
+   * Maximum linear velocity (m/s)
+   */
+  float max_linear_velocity;
+  /**
+   * Maximum angular velocity (rad/s)
+   */
+  float max_angular_velocity;
+  /**
+   * Maximum acceleration (m/s^2)
+   */
+  float max_acceleration;
+  /**
+   * Safety distance from obstacles (m)
+   */
+  float safety_distance;
+  /**
+   * Goal tolerance (m)
+   */
+  float goal_tolerance;
+  /**
+   * Obstacle inflation radius (m)
+   */
+  float obstacle_inflation;
+} EosNavigationParams;
+
+/**
+ * Simple 2D pose representation
+ */
+typedef struct EosPose2D {
+  /**
+   * X position
+   */
+  float x;
+  /**
+   * Y position
+   */
+  float y;
+  /**
+   * Orientation (theta)
+   */
+  float theta;
+} EosPose2D;
+
+/**
+ * One laser scan, borrowed from the caller for the duration of a call
+ */
+typedef struct EosScan {
+  /**
+   * `count` ranges in meters
+   */
+  const float *ranges;
+  /**
+   * Number of beams
+   */
+  size_t count;
+  /**
+   * Angle of the first beam (rad)
+   */
+  float angle_min;
+  /**
+   * Angle between beams (rad)
+   */
+  float angle_increment;
+  /**
+   * Minimum valid range
+   */
+  float range_min;
+  /**
+   * Maximum valid range
+   */
+  float range_max;
+} EosScan;
+
+/**
+ * Motion command for the robot
+ */
+typedef struct EosMotionCommand {
+  /**
+   * Linear velocity (m/s)
+   */
+  float linear;
+  /**
+   * Angular velocity (rad/s)
+   */
+  float angular;
+} EosMotionCommand;
+
+/**
+ * Network topology, mirroring the neural block of params.yaml
+ */
+typedef struct EosNeuralParams {
+  /**
+   * Number of input features
+   */
+  size_t input_size;
+  /**
+   * Number of outputs
+   */
+  size_t output_size;
+  /**
+   * Number of hidden layers
+   */
+  size_t hidden_layers;
+  /**
+   * Neurons per hidden layer
+   */
+  size_t hidden_neurons;
+  /**
+   * Simulation time steps
+   */
+  size_t time_steps;
+  /**
+   * Spike threshold
+   */
+  float spike_threshold;
+} EosNeuralParams;
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * Message of the last failed call on this thread, or ""
+ *
+ * The string stays valid until the next failing call on the same thread.
+ */
+const char *eos_last_error_message(void);
+
+/**
+ * Create a navigator; returns null and sets the last error on failure
+ */
+EosNavigator *eos_navigator_new(const EosNavigationParams *params);
+
+/**
+ * Free a navigator; null is ignored
+ */
+void eos_navigator_free(EosNavigator *navigator);
+
+/**
+ * Set the navigation goal
+ */
+EosStatus eos_navigator_set_goal(EosNavigator *navigator, EosPose2D goal);
+
+/**
+ * Clear the navigation goal; the planner explores until a new one is set
+ */
+EosStatus eos_navigator_clear_goal(EosNavigator *navigator);
+
+/**
+ * Plan on `scan` and return the smoothed velocity command for this tick
+ */
+EosStatus eos_navigator_step(EosNavigator *navigator,
+                             const EosScan *scan,
+                             const float *neural,
+                             size_t neural_count,
+                             const EosPose2D *pose,
+                             EosMotionCommand *command);
+
+/**
+ * Stop immediately and reset the controller's velocity profile
+ */
+EosStatus eos_navigator_emergency_stop(EosNavigator *navigator, EosMotionCommand *command);
+
+/**
+ * Create and initialise an SNN engine with a default model
+ *
+ * Returns null and sets the last error on failure.
+ */
+EosSnn *eos_snn_new(const EosNeuralParams *params);
+
+/**
+ * Free an SNN engine; null is ignored
+ */
+void eos_snn_free(EosSnn *snn);
+
+/**
+ * Replace the engine's model with a JSON model file
+ */
+EosStatus eos_snn_load_model(EosSnn *snn, const char *path);
+
+/**
+ * Run `input_count` preprocessed features into `output_count` outputs
+ */
+EosStatus eos_snn_process(const EosSnn *snn,
+                          const float *input,
+                          size_t input_count,
+                          float *output,
+                          size_t output_count);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif // __cplusplus
+
+#endif  /* EOS_ROBOTICS__EOS_CORE_H_ */
@@ -0,0 +1,33 @@
+/**
+* @file eos_ros_node.hpp
+* @brief Entry points of the Eos node for the standalone executable
+*
+* The node class itself lives in the eos_ros_node_component library and is
+* registered there as the eos::EosRosNode component; containers construct
+* it from NodeOptions on their own.
+*/
+
+#ifndef EOS_ROBOTICS__EOS_ROS_NODE_HPP_
+#define EOS_ROBOTICS__EOS_ROS_NODE_HPP_
+
+#include "rclcpp/node_options.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Construct the node as a component container would
+*/
+rclcpp_lifecycle::LifecycleNode::SharedPtr make_eos_ros_node(const rclcpp::NodeOptions& options);
+
+/**
+* @brief Spin @p node on its executor.* configuration until shutdown
+*
+* @throws std::invalid_argument if @p node was not made by make_eos_ros_node()
+*/
+void spin_eos_ros_node(const rclcpp_lifecycle::LifecycleNode::SharedPtr& node);
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__EOS_ROS_NODE_HPP_
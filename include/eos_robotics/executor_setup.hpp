@@ -0,0 +1,81 @@
+/**
+* @file executor_setup.hpp
+* @brief Executor selection, callback group threads and real-time scheduling
+*/
+
+#ifndef EOS_ROBOTICS__EXECUTOR_SETUP_HPP_
+#define EOS_ROBOTICS__EXECUTOR_SETUP_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Which executor spins the node
+*/
+enum class ExecutorType
+{
+    SingleThreaded,        ///< rclcpp::executors::SingleThreadedExecutor
+    StaticSingleThreaded,  ///< rclcpp::executors::StaticSingleThreadedExecutor
+    MultiThreaded,         ///< shared pool of threads over all callback groups
+    Isolated,              ///< one dedicated thread and executor per callback group
+};
+
+/**
+* @brief Parse "single_threaded" / "static_single_threaded" / "multi_threaded" / "isolated"
+*
+* @throws std::invalid_argument for any other string
+*/
+ExecutorType parse_executor_type(const std::string& name);
+
+/**
+* @brief Executor settings, read from the `executor.*` parameters
+*/
+struct ExecutorConfig
+{
+    ExecutorType type = ExecutorType::SingleThreaded;
+    std::size_t threads = 0;  ///< MultiThreaded pool size, 0 = hardware concurrency
+};
+
+/**
+* @brief A callback group and how its thread should be scheduled
+*
+* cpu and priority only take effect with ExecutorType::Isolated, where the
+* group has a thread of its own.
+*/
+struct CallbackGroupSchedule
+{
+    std::string name;
+    rclcpp::CallbackGroup::SharedPtr group;
+    int cpu = -1;      ///< CPU to pin the thread to, -1 = no affinity
+    int priority = 0;  ///< SCHED_FIFO priority 1-99, 0 = keep SCHED_OTHER
+};
+
+/**
+* @brief Pin the calling thread and/or switch it to SCHED_FIFO
+*
+* Failures (e.g. missing CAP_SYS_NICE) are logged and the thread keeps its
+* current scheduling.
+*/
+void apply_thread_schedule(const CallbackGroupSchedule& schedule, const rclcpp::Logger& logger);
+
+/**
+* @brief Spin @p node until shutdown using the configured executor
+*
+* In Isolated mode every entry of @p groups gets its own executor and
+* thread, and the node's default callback group is spun on the calling
+* thread.
+*/
+void spin(
+    const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr& node,
+    const ExecutorConfig& config,
+    const std::vector<CallbackGroupSchedule>& groups);
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__EXECUTOR_SETUP_HPP_
@@ -0,0 +1,116 @@
+/**
+* @file inference_batcher.hpp
+* @brief Micro-batching of inference requests from several robots onto one engine
+*/
+
+#ifndef EOS_ROBOTICS__INFERENCE_BATCHER_HPP_
+#define EOS_ROBOTICS__INFERENCE_BATCHER_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/lif_engine.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Collects one request per client and runs them as a single batch
+*
+* Each client has one request slot; a newer request from the same client
+* replaces one that has not run yet, since only the latest scan matters. A
+* batch runs as soon as every client has a request waiting, or when the
+* latency budget has passed since the oldest waiting request arrived,
+* whichever comes first. Batches run on the batcher's own thread, which also
+* delivers the replies; after construction nothing on that path allocates.
+*/
+class InferenceBatcher
+{
+public:
+    /**
+     * @brief Called on the batcher thread for every finished request
+     *
+     * @param client Slot the request was submitted on
+     * @param tag Tag the request was submitted with (e.g. the scan stamp)
+     * @param output output_size() firing rates, valid during the call only
+     * @param batch_size Requests that ran together in this batch
+     */
+    using ReplyCallback = std::function<void(std::size_t client, std::int64_t tag,
+                                             const float* output, std::size_t batch_size)>;
+
+    /**
+     * @param engine Engine to run; its max_batch must cover @p clients
+     * @param clients Number of request slots
+     * @param latency_budget Longest a request waits for others to join its batch
+     *
+     * @throws std::invalid_argument without clients or with too small a max_batch
+     */
+    InferenceBatcher(std::unique_ptr<LifEngine> engine, std::size_t clients,
+                     std::chrono::nanoseconds latency_budget, ReplyCallback reply);
+
+    /// Stops the batcher thread; requests still waiting are dropped
+    ~InferenceBatcher();
+
+    InferenceBatcher(const InferenceBatcher&) = delete;
+    InferenceBatcher& operator=(const InferenceBatcher&) = delete;
+
+    /**
+     * @brief Queue input_size() features for @p client; any thread
+     */
+    void submit(std::size_t client, std::int64_t tag, const float* features);
+
+    std::size_t clients() const { return clients_; }
+    std::size_t input_size() const { return engine_->input_size(); }
+    std::size_t output_size() const { return engine_->output_size(); }
+    const LifEngine& engine() const { return *engine_; }
+
+    /// Batches run so far
+    std::uint64_t batches() const;
+    /// Requests run so far, over all batches
+    std::uint64_t requests() const;
+    /// Requests replaced by a newer one from the same client before they ran
+    std::uint64_t superseded() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void run();
+
+    std::unique_ptr<LifEngine> engine_;
+    const std::size_t clients_;
+    const std::chrono::nanoseconds latency_budget_;
+    ReplyCallback reply_;
+
+    // Request slots, guarded by mutex_
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    AlignedBuffer<float> slot_features_;    ///< clients x input_size
+    std::vector<std::int64_t> slot_tags_;
+    std::vector<char> slot_pending_;
+    std::size_t pending_ = 0;
+    Clock::time_point oldest_pending_;
+    bool stopping_ = false;
+    std::uint64_t batches_ = 0;
+    std::uint64_t requests_ = 0;
+    std::uint64_t superseded_ = 0;
+
+    // Batch being run, owned by the batcher thread
+    AlignedBuffer<float> batch_features_;   ///< batch x input_size, sample-major
+    AlignedBuffer<float> batch_outputs_;    ///< batch x output_size
+    std::vector<std::size_t> batch_clients_;
+    std::vector<std::int64_t> batch_tags_;
+
+    std::thread worker_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__INFERENCE_BATCHER_HPP_
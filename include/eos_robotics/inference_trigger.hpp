@@ -0,0 +1,175 @@
+/**
+* @file inference_trigger.hpp
+* @brief Decides whether a new scan should trigger an inference
+*/
+
+#ifndef EOS_ROBOTICS__INFERENCE_TRIGGER_HPP_
+#define EOS_ROBOTICS__INFERENCE_TRIGGER_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+namespace eos
+{
+
+/**
+* @brief Rate limit, deadline and IMU synchronisation policy; times in nanoseconds
+*/
+struct InferenceTriggerConfig
+{
+    std::int64_t min_interval_ns = 0;   ///< 0 = no rate limit
+    std::int64_t deadline_ns = 0;       ///< max scan age at inference, 0 = none
+    bool sync_imu = false;              ///< require an IMU sample close to the scan stamp
+    std::int64_t sync_slop_ns = 20000000;
+};
+
+/**
+* @brief Stamps of the most recent IMU samples, for matching a scan to one
+*
+* A scan is stamped at the start of its sweep and reaches inference tens of
+* milliseconds later, by when the latest IMU sample is far past that stamp;
+* the sample to synchronise with is the one closest to it. Owned by the
+* sensing group, like the rest of the IMU path.
+*/
+class StampHistory
+{
+public:
+    /// 160 ms of a 200 Hz IMU
+    static constexpr std::size_t kCapacity = 32;
+
+    void push(std::int64_t stamp_ns)
+    {
+        stamps_[head_ % kCapacity] = stamp_ns;
+        ++head_;
+    }
+
+    /**
+     * @brief The kept stamp closest to @p stamp_ns, or 0 if none was pushed
+     */
+    std::int64_t nearest(std::int64_t stamp_ns) const
+    {
+        std::int64_t best = 0;
+        for (std::size_t i = 0; i < size(); ++i) {
+            if (i == 0 || std::llabs(stamps_[i] - stamp_ns) < std::llabs(best - stamp_ns)) {
+                best = stamps_[i];
+            }
+        }
+        return best;
+    }
+
+    std::size_t size() const { return head_ < kCapacity ? head_ : kCapacity; }
+
+private:
+    std::array<std::int64_t, kCapacity> stamps_{};
+    std::size_t head_ = 0;
+};
+
+/**
+* @brief Outcome of InferenceTrigger::evaluate
+*/
+enum class TriggerDecision : std::size_t
+{
+    Run = 0,
+    Unchanged,       ///< same scan as the last inference
+    DeadlineMissed,  ///< scan already older than the deadline
+    RateLimited,     ///< last inference too recent
+    Unsynchronized,  ///< no IMU sample within the slop of the scan
+    Count,
+};
+
+/**
+* @brief Stateful gate in front of the inference stage
+*
+* Works for both the timer-driven and the scan-driven mode: a timer tick and
+* a scan arrival are evaluated the same way, so inference never runs twice
+* on the same scan and never on one that is already too old to act on.
+* Not thread-safe; owned by the inference callback group.
+*/
+class InferenceTrigger
+{
+public:
+    InferenceTrigger() = default;
+    explicit InferenceTrigger(const InferenceTriggerConfig& config)
+        : config_(config)
+    {
+    }
+
+    /**
+     * @brief Evaluate a candidate scan; on Run the scan is recorded as consumed
+     *
+     * @param scan_stamp_ns Header stamp of the scan, identifies it
+     * @param imu_stamp_ns Header stamp of the IMU sample closest to the scan's,
+     *        e.g. StampHistory::nearest(scan_stamp_ns)
+     * @param now_ns Current time on the same clock as the stamps
+     */
+    TriggerDecision evaluate(std::int64_t scan_stamp_ns, std::int64_t imu_stamp_ns,
+                             std::int64_t now_ns)
+    {
+        TriggerDecision decision = TriggerDecision::Run;
+
+        if (has_run_ && scan_stamp_ns == last_scan_stamp_ns_) {
+            decision = TriggerDecision::Unchanged;
+        } else if (config_.deadline_ns > 0 && now_ns - scan_stamp_ns > config_.deadline_ns) {
+            decision = TriggerDecision::DeadlineMissed;
+        } else if (has_run_ && config_.min_interval_ns > 0 &&
+                   now_ns - last_run_ns_ < config_.min_interval_ns)
+        {
+            decision = TriggerDecision::RateLimited;
+        } else if (config_.sync_imu &&
+                   std::llabs(imu_stamp_ns - scan_stamp_ns) > config_.sync_slop_ns)
+        {
+            decision = TriggerDecision::Unsynchronized;
+        }
+
+        ++counts_[static_cast<std::size_t>(decision)];
+        if (decision == TriggerDecision::Run) {
+            has_run_ = true;
+            last_scan_stamp_ns_ = scan_stamp_ns;
+            last_run_ns_ = now_ns;
+        }
+        return decision;
+    }
+
+    /// Number of evaluations that ended with @p decision
+    std::uint64_t count(TriggerDecision decision) const
+    {
+        return counts_[static_cast<std::size_t>(decision)];
+    }
+
+    const InferenceTriggerConfig& config() const { return config_; }
+
+private:
+    InferenceTriggerConfig config_;
+    bool has_run_ = false;
+    std::int64_t last_scan_stamp_ns_ = 0;
+    std::int64_t last_run_ns_ = 0;
+    std::array<std::uint64_t, static_cast<std::size_t>(TriggerDecision::Count)> counts_{};
+};
+
+/**
+* @brief Human-readable name of a decision, for logs
+*/
+inline const char* to_string(TriggerDecision decision)
+{
+    switch (decision) {
+        case TriggerDecision::Run:
+            return "run";
+        case TriggerDecision::Unchanged:
+            return "unchanged";
+        case TriggerDecision::DeadlineMissed:
+            return "deadline missed";
+        case TriggerDecision::RateLimited:
+            return "rate limited";
+        case TriggerDecision::Unsynchronized:
+            return "unsynchronized";
+        case TriggerDecision::Count:
+            break;
+    }
+    return "unknown";
+}
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__INFERENCE_TRIGGER_HPP_
@@ -0,0 +1,47 @@
+/**
+* @file kernel_table.hpp
+* @brief One instruction set's build of the native kernels, for runtime dispatch
+*
+* Internal to kernels.cpp and kernel_dispatch.cpp; everything else calls the
+* functions of kernels.hpp.
+*/
+
+#ifndef EOS_ROBOTICS__KERNEL_TABLE_HPP_
+#define EOS_ROBOTICS__KERNEL_TABLE_HPP_
+
+#include "eos_robotics/kernels.hpp"
+
+namespace eos
+{
+namespace kernels
+{
+
+/**
+* @brief Entry points of one build of kernels.cpp
+*/
+struct KernelTable
+{
+    const char* name;  ///< instruction_set() while this table is active
+    decltype(&kernels::matvec) matvec;
+    decltype(&kernels::matvec_batch) matvec_batch;
+    decltype(&kernels::lif_step) lif_step;
+    decltype(&kernels::gather_spike_indices) gather_spike_indices;
+    decltype(&kernels::scatter_add) scatter_add;
+    decltype(&kernels::sanitize_ranges) sanitize_ranges;
+    decltype(&kernels::reduce_min) reduce_min;
+    decltype(&kernels::min_valid_range) min_valid_range;
+    decltype(&kernels::reduce_sum) reduce_sum;
+    decltype(&kernels::accumulate) accumulate;
+    decltype(&kernels::scale) scale;
+    decltype(&kernels::min_squared_distance) min_squared_distance;
+};
+
+// Defined by the build of kernels.cpp for each instruction set
+namespace avx2 { extern const KernelTable table; }
+namespace neon { extern const KernelTable table; }
+namespace scalar { extern const KernelTable table; }
+
+}  // namespace kernels
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__KERNEL_TABLE_HPP_
@@ -0,0 +1,156 @@
+/**
+* @file kernels.hpp
+* @brief SIMD kernels shared by the native neural and perception stages
+*
+* Each kernel has an AVX2 and a NEON implementation with a scalar fallback.
+* On x86_64 the AVX2 and scalar builds are both linked in and the first
+* call picks the best one the CPU supports, so one binary runs on any
+* x86_64 machine; the EOS_KERNELS environment variable ("avx2", "scalar")
+* overrides the choice. On aarch64 NEON is always there and always used.
+* Buffers passed in are expected to come from AlignedBuffer; lengths do
+* not need to be a multiple of the vector width.
+*/
+
+#ifndef EOS_ROBOTICS__KERNELS_HPP_
+#define EOS_ROBOTICS__KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+namespace kernels
+{
+
+/// Number of floats processed per SIMD iteration; row strides are padded to this
+constexpr std::size_t kFloatLanes = 8;
+
+/**
+* @brief "avx2", "neon" or "scalar": the implementation in use
+*/
+const char* instruction_set();
+
+/**
+* @brief Implementations linked in that this CPU can run, best first
+*/
+std::vector<std::string> available_instruction_sets();
+
+/**
+* @brief Switch every kernel to the implementation @p name
+*
+* Meant for startup, tests and benchmarks: kernels already running on
+* other threads finish on the previous implementation.
+*
+* @return false, changing nothing, if @p name is not available
+*/
+bool select_instruction_set(const std::string& name);
+
+/**
+* @brief Dense matrix-vector product y = W x
+*
+* @param weights Row-major matrix, each row padded to @p stride floats
+* @param rows Number of rows (outputs)
+* @param stride Row stride in floats, a multiple of kFloatLanes
+* @param x Input vector of at least @p stride floats, zero-padded
+* @param y Output vector of @p rows floats
+*/
+void matvec(const float* weights, std::size_t rows, std::size_t stride,
+            const float* x, float* y);
+
+/**
+* @brief Dense product y_b = W x_b for a batch of input vectors
+*
+* Every weight vector is loaded once and applied to several samples, so the
+* matrix is streamed once per call instead of once per sample. Each output
+* is bit-identical to matvec() on the same sample.
+*
+* @param x First input vector; sample b starts at x + b * x_stride, each
+*          zero-padded to @p stride floats and 32-byte aligned
+* @param y Output; sample b's @p rows floats start at y + b * y_stride
+*/
+void matvec_batch(const float* weights, std::size_t rows, std::size_t stride,
+                  const float* x, std::size_t x_stride, std::size_t batch,
+                  float* y, std::size_t y_stride);
+
+/**
+* @brief One leaky-integrate-and-fire update over a population
+*
+* v = v * decay + current; neurons with v >= threshold emit a spike
+* (spikes[i] = 1) and are reset to zero, all others get spikes[i] = 0.
+*
+* @return Number of neurons that fired
+*/
+std::size_t lif_step(float* membrane, const float* current, float* spikes,
+                     std::size_t count, float decay, float threshold);
+
+/**
+* @brief Write the indices of all non-zero entries of a 0/1 spike vector
+*
+* @param indices Output buffer with room for @p count entries
+* @return Number of indices written
+*/
+std::size_t gather_spike_indices(const float* spikes, std::size_t count,
+                                 std::uint32_t* indices);
+
+/**
+* @brief Scatter-add one compressed synapse row: y[index[k]] += weight[k]
+*/
+void scatter_add(float* y, const std::uint32_t* index, const float* weight,
+                 std::size_t count);
+
+/**
+* @brief Copy range readings, replacing invalid ones with @p range_max
+*
+* NaN, +/-inf and readings outside [range_min, range_max] all mean "no
+* return" and become range_max.
+*/
+void sanitize_ranges(const float* ranges, std::size_t count, float range_min,
+                     float range_max, float* out);
+
+/**
+* @brief Minimum of @p count floats; +inf for an empty range
+*/
+float reduce_min(const float* x, std::size_t count);
+
+/**
+* @brief Nearest reading at or above @p range_min; +inf if there is none
+*
+* NaN and readings below range_min are skipped, so raw LaserScan ranges can
+* be passed in without sanitising them first.
+*/
+float min_valid_range(const float* ranges, std::size_t count, float range_min);
+
+/**
+* @brief Sum of @p count floats
+*/
+float reduce_sum(const float* x, std::size_t count);
+
+/**
+* @brief Element-wise accumulate acc += x
+*/
+void accumulate(float* acc, const float* x, std::size_t count);
+
+/**
+* @brief Element-wise scale x *= factor
+*/
+void scale(float* x, std::size_t count, float factor);
+
+/**
+* @brief Lower min_sq[i] to the nearest squared distance from (x[i], y[i]) to any point
+*
+* Used to score trajectory rollouts: each lane is one rollout sample and the
+* points are obstacles, so every sample stays in a register while all
+* obstacles stream past it.
+*
+* @param px, py @p points obstacle coordinates
+*/
+void min_squared_distance(const float* x, const float* y, std::size_t count,
+                          const float* px, const float* py, std::size_t points,
+                          float* min_sq);
+
+}  // namespace kernels
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__KERNELS_HPP_
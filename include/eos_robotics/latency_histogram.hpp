@@ -0,0 +1,91 @@
+/**
+* @file latency_histogram.hpp
+* @brief Lock-free log-linear latency histogram
+*/
+
+#ifndef EOS_ROBOTICS__LATENCY_HISTOGRAM_HPP_
+#define EOS_ROBOTICS__LATENCY_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eos
+{
+
+/**
+* @brief Percentile summary of a LatencyHistogram; all values in nanoseconds
+*/
+struct HistogramSummary
+{
+    std::uint64_t count = 0;
+    double mean_ns = 0.0;
+    std::int64_t max_ns = 0;
+    std::int64_t p50_ns = 0;
+    std::int64_t p90_ns = 0;
+    std::int64_t p99_ns = 0;
+    std::int64_t p999_ns = 0;
+};
+
+/**
+* @brief HDR-style histogram with ~6% relative precision over the full int64 range
+*
+* Values below 16 get exact buckets; above that every power of two is split
+* into 16 linear sub-buckets. record() is a handful of relaxed atomic adds,
+* so any number of threads may record while another summarizes; a summary
+* taken concurrently with recording may miss the samples in flight.
+*/
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t kSubBucketBits = 4;
+    static constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    static constexpr std::size_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * @brief Record one sample; negative values count as 0
+     */
+    void record(std::int64_t value_ns)
+    {
+        const std::uint64_t value = value_ns > 0 ? static_cast<std::uint64_t>(value_ns) : 0;
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+
+        std::uint64_t max = max_.load(std::memory_order_relaxed);
+        while (value > max &&
+               !max_.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * @brief Count, mean, max and the p50/p90/p99/p99.9 upper bucket bounds
+     */
+    HistogramSummary summarize() const;
+
+    /**
+     * @brief Value at quantile @p q in [0, 1], reported as its bucket's upper bound
+     */
+    std::int64_t percentile(double q) const;
+
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    static std::size_t bucket_index(std::uint64_t value);
+    static std::uint64_t bucket_upper_bound(std::size_t index);
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBuckets> buckets_{};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_{0};
+    std::atomic<std::uint64_t> max_{0};
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__LATENCY_HISTOGRAM_HPP_
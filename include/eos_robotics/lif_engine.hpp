@@ -0,0 +1,237 @@
+/**
+* @file lif_engine.hpp
+* @brief Native leaky-integrate-and-fire spiking network engine
+*
+* Feed-forward LIF network: input -> hidden_layers x hidden_neurons -> output.
+* Weights come from a shared, immutable LifModel (row-padded matrices, used in
+* place even when memory-mapped); the membrane potentials / spikes of every
+* layer live in parallel flat arrays owned by the engine, so each timestep is
+* a sequence of matvec + lif_step kernel calls with no pointer chasing. Up to
+* max_batch independent samples can share one run, each with its own copy of
+* that state.
+*/
+
+#ifndef EOS_ROBOTICS__LIF_ENGINE_HPP_
+#define EOS_ROBOTICS__LIF_ENGINE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/lif_model.hpp"
+
+namespace eos
+{
+
+/**
+* @brief How spikes are propagated between spiking layers
+*/
+enum class PropagationMode
+{
+    Dense,      ///< full matrix-vector product every timestep
+    Sparse,     ///< event-driven: scatter only the rows of neurons that fired
+    Automatic,  ///< pick per layer and timestep from the observed spike density
+};
+
+/**
+* @brief Parse "dense" / "sparse" / "auto"
+*
+* @throws std::invalid_argument for any other string
+*/
+PropagationMode parse_propagation_mode(const std::string& name);
+
+/**
+* @brief Network topology and neuron dynamics, mirrors the `neural` block of params.yaml
+*/
+struct LifConfig
+{
+    std::size_t input_size = 100;
+    std::size_t output_size = 10;
+    std::size_t hidden_layers = 2;
+    std::size_t hidden_neurons = 64;
+    std::size_t time_steps = 10;
+    float spike_threshold = 0.5f;
+    float membrane_decay = 0.9f;
+    std::uint32_t seed = 42;
+
+    PropagationMode propagation = PropagationMode::Automatic;
+    /// In Automatic mode, use the sparse path when at most this fraction of
+    /// the presynaptic layer fired in the current timestep
+    float sparse_density_threshold = 0.15f;
+    /// Synapses with |w| below this are dropped from both weight layouts
+    float synapse_prune_threshold = 0.0f;
+    /// Samples one run_batch() call can take; state is allocated for all of them
+    std::size_t max_batch = 1;
+};
+
+/**
+* @brief Read-only synapse layouts an engine derives from its model
+*
+* The dense rows, pruned into a private copy when a prune threshold is set,
+* and the presynaptic-major CSR the sparse path scatters from. Engines
+* running the same model with the same threshold share one instance, so N
+* robots in one process keep one copy of the weights and N membrane states.
+*/
+class LifSynapses
+{
+public:
+    /**
+     * @brief The layouts of @p model at @p prune_threshold, shared with
+     *        every engine that asked for the same while one still holds them
+     */
+    static std::shared_ptr<const LifSynapses> shared(std::shared_ptr<const LifModel> model,
+                                                     float prune_threshold);
+
+    LifSynapses(std::shared_ptr<const LifModel> model, float prune_threshold);
+
+    LifSynapses(const LifSynapses&) = delete;
+    LifSynapses& operator=(const LifSynapses&) = delete;
+
+    /// Dense rows of layer @p layer, in the model or the pruned copy
+    const float* weights(std::size_t layer) const { return weights_[layer]; }
+
+    /// CSR row offsets of layer @p layer (>= 1), one row per presynaptic neuron
+    const std::uint32_t* row_ptr(std::size_t layer) const
+    {
+        return csr_row_ptr_.data() + row_ptr_offset_[layer];
+    }
+
+    const std::uint32_t* csr_index() const { return csr_index_.data(); }
+    const float* csr_weight() const { return csr_weight_.data(); }
+
+    /// Bytes held beyond the model's own weights
+    std::size_t private_bytes() const;
+
+private:
+    std::shared_ptr<const LifModel> model_;
+    AlignedBuffer<float> pruned_;        ///< empty without pruning
+    std::vector<const float*> weights_;
+    std::vector<std::size_t> row_ptr_offset_;
+    std::vector<std::uint32_t> csr_row_ptr_;
+    std::vector<std::uint32_t> csr_index_;
+    std::vector<float> csr_weight_;
+};
+
+/**
+* @brief LIF spiking network with SIMD membrane updates
+*
+* Each call to run() resets the membranes, drives the input layer with a
+* constant current for `time_steps` steps and returns output firing rates.
+* Between spiking layers the engine either runs a dense matvec or, when few
+* neurons fired, scatters only the compressed synapse rows of the fired
+* neurons; both paths produce the same currents.
+*/
+class LifEngine
+{
+public:
+    /**
+     * @brief Build the topology and initialise weights from a seeded uniform
+     *        Xavier distribution
+     *
+     * @throws std::invalid_argument if any layer size or time_steps is zero
+     */
+    explicit LifEngine(const LifConfig& config);
+
+    /**
+     * @brief Run @p model with the dynamics of @p config
+     *
+     * The model's layer table overrides the topology fields of @p config.
+     * Its weights are used in place unless synapse pruning is enabled, in
+     * which case a pruned copy is used; either way the synapse layouts come
+     * from LifSynapses::shared(), and only the membrane state is the
+     * engine's own.
+     *
+     * @throws std::invalid_argument without a model, for zero time_steps or
+     *         max_batch, or a row stride that is not a multiple of the SIMD width
+     */
+    LifEngine(std::shared_ptr<const LifModel> model, const LifConfig& config);
+
+    /**
+     * @brief Run one inference
+     *
+     * @param inputs input_size() currents, typically normalised to [0, 1]
+     * @param outputs output_size() firing rates in [0, 1]
+     */
+    void run(const float* inputs, float* outputs);
+
+    /**
+     * @brief Run @p batch independent inferences in lockstep
+     *
+     * Every layer and timestep is applied to all samples before moving on,
+     * so each weight row is loaded once per batch rather than once per
+     * sample. With dense or sparse propagation the results equal run() on
+     * each sample; in auto mode the path is chosen from the spike density of
+     * the whole batch. Performs no heap allocation.
+     *
+     * @param inputs batch x input_size() currents, sample-major
+     * @param batch 1 .. config().max_batch
+     * @param outputs batch x output_size() firing rates, sample-major
+     *
+     * @throws std::invalid_argument if @p batch is zero or above max_batch
+     */
+    void run_batch(const float* inputs, std::size_t batch, float* outputs);
+
+    std::size_t input_size() const { return config_.input_size; }
+    std::size_t output_size() const { return config_.output_size; }
+    const LifConfig& config() const { return config_; }
+    const std::shared_ptr<const LifModel>& model() const { return model_; }
+    const std::shared_ptr<const LifSynapses>& synapses() const { return synapses_; }
+
+    /// Total spikes emitted by hidden and output layers during the last run(), all samples
+    std::size_t last_spike_count() const { return last_spike_count_; }
+
+    /// Layer-timestep propagations that took the sparse path during the last run();
+    /// a batch takes one path per layer and timestep for all of its samples
+    std::size_t last_sparse_propagations() const { return last_sparse_propagations_; }
+
+private:
+    struct Layer
+    {
+        std::size_t inputs;         ///< presynaptic neurons
+        std::size_t neurons;        ///< postsynaptic neurons
+        std::size_t stride;         ///< padded row length in floats
+        const float* weights;       ///< neurons x stride, from synapses_
+        std::size_t state_offset;   ///< first neuron in a sample's membrane_ / spikes_ slice
+    };
+
+    /**
+     * @brief Synaptic current of @p layer for every sample, into current_,
+     *        from the spikes of the layer before it
+     *
+     * @return true if the sparse path was taken
+     */
+    bool propagate(std::size_t layer_index, std::size_t batch);
+
+    LifConfig config_;
+    std::shared_ptr<const LifModel> model_;
+    std::shared_ptr<const LifSynapses> synapses_;
+    std::vector<Layer> layers_;
+
+    // Per-sample state: sample b's slice of each buffer starts at b * its stride
+    AlignedBuffer<float> membrane_;      ///< membrane potential per neuron
+    AlignedBuffer<float> spikes_;        ///< 0/1 spike per neuron, padded per layer
+    AlignedBuffer<float> input_;         ///< padded copy of the current input
+    AlignedBuffer<float> drive_;         ///< input-layer current, constant per run
+    AlignedBuffer<float> current_;       ///< scratch synaptic current
+    AlignedBuffer<float> spike_counts_;  ///< output-layer spike accumulator
+    std::size_t state_stride_ = 0;       ///< membrane_, spikes_ and spike_queue_
+    std::size_t input_stride_ = 0;
+    std::size_t drive_stride_ = 0;
+    std::size_t current_stride_ = 0;
+    std::size_t output_stride_ = 0;      ///< spike_counts_
+
+    // Per-timestep spike queues: indices of the neurons that fired, per layer
+    // and sample; queue_length_ is indexed sample * layers + layer
+    AlignedBuffer<std::uint32_t> spike_queue_;
+    std::vector<std::size_t> queue_length_;
+
+    std::size_t last_spike_count_ = 0;
+    std::size_t last_sparse_propagations_ = 0;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__LIF_ENGINE_HPP_
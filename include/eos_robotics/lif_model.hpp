@@ -0,0 +1,174 @@
+/**
+* @file lif_model.hpp
+* @brief Immutable LIF network weights and the memory-mapped .eosm model format
+*
+* A model is only the layer table and the weight matrices; membrane state,
+* spikes and scratch live in each LifEngine, so one model can back any
+* number of engines.
+*
+* .eosm layout (little endian, version 1):
+*
+*     offset 0    ModelFileHeader (64 bytes)
+*     offset 64   ModelLayerRecord x layer_count (32 bytes each)
+*     ...         per layer: neurons x stride float32, row-major, rows padded
+*                 with zeros to `stride`, each blob 64-byte aligned
+*
+* Strides are multiples of 16 floats so every row starts on a cache line
+* and the weights can be used straight from the mapping.
+*/
+
+#ifndef EOS_ROBOTICS__LIF_MODEL_HPP_
+#define EOS_ROBOTICS__LIF_MODEL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+
+namespace eos
+{
+
+struct LifConfig;
+
+/**
+* @brief On-disk header of an .eosm file
+*/
+struct ModelFileHeader
+{
+    char magic[8];                    ///< "EOSSNN\0\0"
+    std::uint32_t version;            ///< kModelFormatVersion
+    std::uint32_t header_size;        ///< sizeof(ModelFileHeader)
+    std::uint32_t layer_count;
+    std::uint32_t flags;              ///< reserved, 0
+    std::uint64_t file_size;          ///< total bytes, catches truncation
+    std::uint64_t layer_table_offset;
+    std::uint8_t reserved[24];
+};
+
+/**
+* @brief On-disk description of one weight layer
+*/
+struct ModelLayerRecord
+{
+    std::uint32_t inputs;          ///< presynaptic neurons
+    std::uint32_t neurons;         ///< postsynaptic neurons (matrix rows)
+    std::uint32_t stride;          ///< padded row length in floats
+    std::uint32_t reserved;
+    std::uint64_t weight_offset;   ///< byte offset of the blob from the file start
+    std::uint64_t weight_bytes;    ///< neurons * stride * sizeof(float)
+};
+
+static_assert(sizeof(ModelFileHeader) == 64, "ModelFileHeader must stay 64 bytes");
+static_assert(sizeof(ModelLayerRecord) == 32, "ModelLayerRecord must stay 32 bytes");
+
+constexpr char kModelMagic[8] = {'E', 'O', 'S', 'S', 'N', 'N', '\0', '\0'};
+constexpr std::uint32_t kModelFormatVersion = 1;
+constexpr std::size_t kModelBlobAlignment = 64;
+constexpr std::size_t kModelRowFloats = 16;
+
+/**
+* @brief Read-only view of one layer's weight matrix
+*/
+struct ModelLayer
+{
+    std::size_t inputs;
+    std::size_t neurons;
+    std::size_t stride;     ///< padded row length in floats
+    const float* weights;   ///< neurons x stride, 64-byte aligned rows
+};
+
+/**
+* @brief Feed-forward LIF weights, either owned or mapped from an .eosm file
+*/
+class LifModel
+{
+public:
+    /**
+     * @brief Seeded Xavier-uniform weights for the topology in @p config
+     *
+     * @throws std::invalid_argument if any layer size is zero
+     */
+    static std::shared_ptr<const LifModel> random(const LifConfig& config);
+
+    /**
+     * @brief Map an .eosm file read-only and validate it
+     *
+     * The mapping is shared, so processes loading the same file share its
+     * pages through the page cache. It also means a mapped model must only
+     * ever be replaced atomically (write a new file, then rename() it over
+     * the old one, as save() and scripts/convert_model.py do): rewriting it
+     * in place changes the weights under a running engine, and truncating
+     * it raises SIGBUS.
+     *
+     * @throws std::runtime_error if the file cannot be mapped or is malformed
+     */
+    static std::shared_ptr<const LifModel> load(const std::string& path);
+
+    /**
+     * @brief load() @p path, or seed weights from @p config when it does not exist
+     *
+     * @throws std::invalid_argument for a JSON model, which has to be converted first
+     * @throws std::runtime_error if an existing file cannot be mapped or is malformed
+     */
+    static std::shared_ptr<const LifModel> open(const std::string& path, const LifConfig& config);
+
+    /**
+     * @brief load() through a process-wide cache
+     *
+     * Every caller asking for the same unchanged file while one of them
+     * still holds the model gets that instance, so robots hosted in one
+     * process also share the synapse layouts engines derive from it. A
+     * file rewritten since (new size or modification time) is loaded anew.
+     *
+     * @throws std::runtime_error if the file cannot be mapped or is malformed
+     */
+    static std::shared_ptr<const LifModel> load_shared(const std::string& path);
+
+    /**
+     * @brief open() through the same cache; seeded weights are shared per
+     *        seed and topology
+     *
+     * @throws as open()
+     */
+    static std::shared_ptr<const LifModel> open_shared(const std::string& path,
+                                                       const LifConfig& config);
+
+    /**
+     * @brief Write @p model to @p path in .eosm format
+     *
+     * Writes and fsyncs @p path + ".tmp", then renames it over @p path, so
+     * engines still mapping the old file keep its weights intact.
+     *
+     * @throws std::runtime_error on I/O failure
+     */
+    static void save(const LifModel& model, const std::string& path);
+
+    ~LifModel();
+    LifModel(const LifModel&) = delete;
+    LifModel& operator=(const LifModel&) = delete;
+
+    const std::vector<ModelLayer>& layers() const { return layers_; }
+    std::size_t input_size() const { return layers_.front().inputs; }
+    std::size_t output_size() const { return layers_.back().neurons; }
+
+    /// True when the weights are used in place from a file mapping
+    bool memory_mapped() const { return mapping_ != nullptr; }
+
+    /// Bytes of weight data, including row padding
+    std::size_t weight_bytes() const;
+
+private:
+    LifModel() = default;
+
+    AlignedBuffer<float> owned_;
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    std::vector<ModelLayer> layers_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__LIF_MODEL_HPP_
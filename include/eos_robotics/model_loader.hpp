@@ -0,0 +1,64 @@
+/**
+* @file model_loader.hpp
+* @brief Background loading of replacement models for a running NeuralBridge
+*/
+
+#ifndef EOS_ROBOTICS__MODEL_LOADER_HPP_
+#define EOS_ROBOTICS__MODEL_LOADER_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "eos_robotics/neural_bridge.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Maps, validates and stages models on its own thread
+*
+* Requests are processed in order. Each one maps the .eosm file, checks it
+* against the running model's input and output sizes, builds a complete
+* backend (the CPU engine's sparse synapse layout, or the accelerator's
+* uploaded weights) and stages it on the bridge;
+* the inference thread picks it up at its next boundary.
+*/
+class ModelLoader
+{
+public:
+    /// Called on the loader thread once a request succeeded or failed
+    using Callback = std::function<void(bool success, const std::string& message)>;
+
+    explicit ModelLoader(NeuralBridge& bridge);
+
+    /// Finishes the request in progress; queued requests are answered as cancelled
+    ~ModelLoader();
+
+    ModelLoader(const ModelLoader&) = delete;
+    ModelLoader& operator=(const ModelLoader&) = delete;
+
+    /**
+     * @brief Queue a load of @p path; returns immediately
+     */
+    void request(const std::string& path, Callback done);
+
+private:
+    void run();
+    void load(const std::string& path, const Callback& done);
+
+    NeuralBridge& bridge_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::pair<std::string, Callback>> queue_;
+    bool stopping_ = false;
+    std::thread worker_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__MODEL_LOADER_HPP_
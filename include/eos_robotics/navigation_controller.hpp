@@ -0,0 +1,171 @@
+/**
+* @file navigation_controller.hpp
+* @brief Dynamic-window local planner behind /cmd_vel
+*/
+
+#ifndef EOS_ROBOTICS__NAVIGATION_CONTROLLER_HPP_
+#define EOS_ROBOTICS__NAVIGATION_CONTROLLER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/pose2d.hpp"
+
+namespace eos
+{
+
+class DistanceField;
+
+/**
+* @brief Body-frame velocity command
+*/
+struct VelocityCommand
+{
+    float linear = 0.0f;   ///< m/s, forward
+    float angular = 0.0f;  ///< rad/s, counter-clockwise
+};
+
+/**
+* @brief Limits, sampling and scoring weights of the local planner
+*/
+struct NavigationControllerConfig
+{
+    float max_linear_velocity = 0.5f;        ///< max_velocity
+    float max_angular_velocity = 1.0f;       ///< navigation.max_angular_velocity
+    float max_linear_acceleration = 0.3f;    ///< navigation.max_acceleration
+    float max_angular_acceleration = 1.0f;   ///< navigation.max_angular_acceleration
+    float control_period = 1.0f / 15.0f;     ///< seconds between compute_command() calls
+
+    float robot_radius = 0.3f;      ///< navigation.obstacle_inflation; closer is a collision
+    float safety_distance = 0.5f;   ///< clearance beyond the radius that scores as fully safe
+    float goal_tolerance = 0.1f;
+
+    /// Velocity lattice: linear_samples x angular_samples rollouts, precomputed
+    std::size_t linear_samples = 31;
+    std::size_t angular_samples = 101;
+    float horizon = 1.5f;           ///< seconds simulated per rollout
+    float rollout_step = 0.1f;      ///< seconds between rollout points
+
+    /// Nearest return per angular sector; bounds the obstacle count per tick
+    std::size_t obstacle_sectors = 120;
+
+    float goal_weight = 1.0f;       ///< progress towards the goal (forward without one)
+    float clearance_weight = 0.6f;
+    float velocity_weight = 0.2f;
+};
+
+/**
+* @brief Dynamic window approach over a precomputed velocity lattice
+*
+* Every (v, w) pair of the lattice is rolled out once at construction into
+* structure-of-arrays lookup tables of robot-frame positions, one table per
+* rollout step. A control tick only picks the lattice block reachable from
+* the previous command within the acceleration limits (the dynamic window),
+* finds each rollout's clearance with the min_squared_distance kernel, and
+* scores progress, clearance and speed. Rollouts that pass within
+* robot_radius of an obstacle are inadmissible; if none is left the robot
+* stops. With a distance field attached, the clearance of each rollout in
+* the window also takes the field's distance at every rollout point, one
+* lookup each, so mapped obstacles the scan no longer sees are respected.
+*
+* All buffers are allocated up front: update_scan() and compute_command()
+* never touch the heap.
+*/
+class NavigationController
+{
+public:
+    /**
+     * @throws std::invalid_argument for non-positive limits, periods or sample counts
+     */
+    explicit NavigationController(const NavigationControllerConfig& config);
+
+    /**
+     * @brief Take the obstacles of one scan, in the robot frame
+     *
+     * Invalid returns and returns beyond what any rollout can reach are
+     * ignored; the nearest return per sector is kept.
+     */
+    void update_scan(const float* ranges, std::size_t count, float range_min, float range_max,
+                     float angle_min, float angle_increment);
+
+    /**
+     * @brief Also check rollouts against the obstacles of @p map
+     *
+     * The field should reach robot_radius + safety_distance for clearance to
+     * score fully. It must outlive the controller; nullptr detaches it.
+     */
+    void use_map(const DistanceField* map) { map_ = map; }
+
+    void set_goal(const Pose2D& goal);
+
+    /// Drop the goal, or stop holding at a reached one, and explore forward
+    void clear_goal();
+    bool has_goal() const { return has_goal_; }
+
+    /// The robot was stopped externally: the next window starts from rest
+    void stop() { last_command_ = VelocityCommand{}; }
+
+    /**
+     * @brief Plan one control tick from @p pose
+     *
+     * Without a scan the robot stays put; without a goal it explores
+     * forward. Reaching the goal stops the robot there until set_goal() or
+     * clear_goal().
+     */
+    VelocityCommand compute_command(const Pose2D& pose);
+
+    /// Samples scored and found admissible by the last compute_command()
+    std::size_t evaluated_samples() const { return evaluated_; }
+    std::size_t admissible_samples() const { return admissible_; }
+
+    /// Rollouts in the precomputed lattice
+    std::size_t lattice_size() const { return config_.linear_samples * config_.angular_samples; }
+    const NavigationControllerConfig& config() const { return config_; }
+
+private:
+    struct IndexRange
+    {
+        std::size_t first;
+        std::size_t last;  ///< inclusive
+    };
+
+    void build_lattice();
+    IndexRange window(float current, float acceleration, float minimum, float step,
+                      std::size_t count) const;
+    float map_clearance(const Pose2D& pose, float c, float s, std::size_t sample) const;
+
+    NavigationControllerConfig config_;
+    std::size_t steps_;          ///< rollout points per sample
+    std::size_t row_stride_;     ///< angular_samples padded to kFloatLanes
+    std::size_t table_stride_;   ///< floats per step table
+    float linear_step_;
+    float angular_step_;
+    float reach_;                ///< farthest obstacle that can affect a rollout
+
+    // Lookup tables: the position after step k of sample (i, j) is at
+    // [k * table_stride_ + i * row_stride_ + j]
+    AlignedBuffer<float> rollout_x_;
+    AlignedBuffer<float> rollout_y_;
+    AlignedBuffer<float> clearance_sq_;
+
+    // Obstacles of the latest scan
+    std::vector<float> sector_range_;
+    std::vector<float> sector_angle_;
+    AlignedBuffer<float> obstacle_x_;
+    AlignedBuffer<float> obstacle_y_;
+    std::size_t obstacle_count_ = 0;
+    bool has_scan_ = false;
+    const DistanceField* map_ = nullptr;
+
+    Pose2D goal_;
+    bool has_goal_ = false;
+    bool holding_ = false;
+    VelocityCommand last_command_;
+    std::size_t evaluated_ = 0;
+    std::size_t admissible_ = 0;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__NAVIGATION_CONTROLLER_HPP_
@@ -0,0 +1,105 @@
+/**
+* @file neural_backend.hpp
+* @brief Where NeuralBridge runs the spiking network: CPU SIMD engine or accelerator
+*/
+
+#ifndef EOS_ROBOTICS__NEURAL_BACKEND_HPP_
+#define EOS_ROBOTICS__NEURAL_BACKEND_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Available inference backends, selected by neural.backend
+*/
+enum class BackendType
+{
+    Cpu,   ///< LifEngine with the compile-time selected SIMD kernels
+    Cuda,  ///< CUDA graph of the dense timestep loop; needs EOS_ENABLE_CUDA
+};
+
+/**
+* @brief Parse "cpu" / "cuda"
+*
+* @throws std::invalid_argument for any other string
+*/
+BackendType parse_backend_type(const std::string& name);
+
+const char* to_string(BackendType type);
+
+/**
+* @brief Whether @p type was compiled into this build
+*/
+bool backend_available(BackendType type);
+
+/**
+* @brief One LIF network instance on some compute device
+*
+* Implementations own all per-inference buffers, so run() performs no heap
+* allocation after construction; they share the immutable model they were
+* built from.
+*/
+class NeuralBackend
+{
+public:
+    virtual ~NeuralBackend() = default;
+
+    /**
+     * @brief Run one inference
+     *
+     * @param inputs input_size() currents, typically normalised to [0, 1]
+     * @param outputs output_size() firing rates in [0, 1]
+     */
+    virtual void run(const float* inputs, float* outputs) = 0;
+
+    virtual std::size_t input_size() const = 0;
+    virtual std::size_t output_size() const = 0;
+    virtual const std::shared_ptr<const LifModel>& model() const = 0;
+    virtual BackendType type() const = 0;
+};
+
+/**
+* @brief The default backend: a LifEngine on the calling thread
+*/
+class CpuBackend : public NeuralBackend
+{
+public:
+    CpuBackend(std::shared_ptr<const LifModel> model, const LifConfig& config)
+        : engine_(std::move(model), config)
+    {
+    }
+
+    void run(const float* inputs, float* outputs) override { engine_.run(inputs, outputs); }
+
+    std::size_t input_size() const override { return engine_.input_size(); }
+    std::size_t output_size() const override { return engine_.output_size(); }
+    const std::shared_ptr<const LifModel>& model() const override { return engine_.model(); }
+    BackendType type() const override { return BackendType::Cpu; }
+
+    const LifEngine& engine() const { return engine_; }
+
+private:
+    LifEngine engine_;
+};
+
+/**
+* @brief Build a backend of @p type running @p model with the dynamics of @p config
+*
+* @throws std::runtime_error if @p type is not compiled in or its device
+*         cannot be initialised
+* @throws std::invalid_argument for an unsupported model or config
+*/
+std::unique_ptr<NeuralBackend> make_backend(
+    BackendType type, std::shared_ptr<const LifModel> model, const LifConfig& config);
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__NEURAL_BACKEND_HPP_
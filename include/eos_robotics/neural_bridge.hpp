@@ -0,0 +1,145 @@
+/**
+* @file neural_bridge.hpp
+* @brief Bridge between ROS sensor messages and the native LIF engine
+*/
+
+#ifndef EOS_ROBOTICS__NEURAL_BRIDGE_HPP_
+#define EOS_ROBOTICS__NEURAL_BRIDGE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "sensor_msgs/msg/laser_scan.hpp"
+#include "sensor_msgs/msg/imu.hpp"
+#include "nav_msgs/msg/odometry.hpp"
+
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/neural_backend.hpp"
+#include "eos_robotics/scan_preprocessor.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Encodes sensor data into network input and runs in-process inference
+*
+* Inference runs on a NeuralBackend: the CPU SIMD engine by default, or an
+* accelerator. A replacement backend can be staged from any thread and is
+* swapped in by the inference thread at its next boundary (swap_staged());
+* the one it replaces is parked and freed later by reclaim_retired(), so
+* neither side ever blocks or frees memory on the inference path.
+*/
+class NeuralBridge
+{
+public:
+    /**
+     * @brief Construct the bridge and its backend
+     *
+     * @param model_path .eosm model, memory-mapped and used in place; when the
+     *        file does not exist the weights are seeded from config.seed
+     * @param config Neuron dynamics, plus the topology for seeded weights
+     * @param preprocessing Scan binning; its bin count must equal the model's inputs
+     * @param backend Device the network runs on; replacement models use it too
+     *
+     * @throws std::invalid_argument for a JSON model or mismatched sizes
+     * @throws std::runtime_error for an unreadable or malformed .eosm file, or
+     *         a backend that is not built in or fails to initialise
+     */
+    NeuralBridge(const std::string& model_path, const LifConfig& config,
+                 const ScanPreprocessorConfig& preprocessing,
+                 BackendType backend = BackendType::Cpu);
+
+    /**
+     * @brief Bin the scan into input_size() features
+     *
+     * @return Pointer to the features, valid until the next preprocess() call
+     */
+    const float* preprocess(const sensor_msgs::msg::LaserScan& laser);
+
+    /**
+     * @brief Preprocess the scan and run one inference
+     *
+     * @param output Receives output_size() firing rates in [0, 1]
+     */
+    void process(
+        const sensor_msgs::msg::LaserScan& laser,
+        const sensor_msgs::msg::Imu& imu,
+        const nav_msgs::msg::Odometry& odom,
+        float* output);
+
+    /**
+     * @brief Run one inference on scan features that were already preprocessed
+     *
+     * Performs no heap allocation on the CPU backend.
+     *
+     * @param features input_size() values from a ScanPreprocessor
+     * @param output Receives output_size() firing rates in [0, 1]
+     */
+    void process_features(
+        const float* features,
+        const sensor_msgs::msg::Imu& imu,
+        const nav_msgs::msg::Odometry& odom,
+        float* output);
+
+    /**
+     * @brief Build a backend of this bridge's type and dynamics for @p model; any thread
+     */
+    std::unique_ptr<NeuralBackend> build_backend(std::shared_ptr<const LifModel> model) const;
+
+    /**
+     * @brief Hand over a backend to replace the current one; any thread
+     *
+     * A backend staged earlier and not yet swapped in is discarded.
+     *
+     * @throws std::invalid_argument if its input or output size differs
+     */
+    void stage(std::unique_ptr<NeuralBackend> backend);
+
+    /**
+     * @brief Inference thread: switch to the staged backend, if any
+     *
+     * Never frees memory: while the backend replaced by the previous swap
+     * has not been reclaimed yet, the staged one stays staged.
+     *
+     * @return true if the backend changed
+     */
+    bool swap_staged();
+
+    /**
+     * @brief Free the backend replaced by the last swap; call off the hot path
+     */
+    void reclaim_retired();
+
+    ~NeuralBridge();
+    NeuralBridge(const NeuralBridge&) = delete;
+    NeuralBridge& operator=(const NeuralBridge&) = delete;
+
+    std::size_t input_size() const { return input_size_; }
+    std::size_t output_size() const { return output_size_; }
+    const std::string& model_path() const { return model_path_; }
+
+    /// Dynamics every backend of this bridge runs with
+    const LifConfig& config() const { return config_; }
+    BackendType backend_type() const { return backend_type_; }
+
+    /// Current backend; only stable on the inference thread or before sharing
+    const NeuralBackend& backend() const { return *backend_; }
+
+private:
+    std::string model_path_;
+    LifConfig config_;
+    BackendType backend_type_;
+    std::unique_ptr<NeuralBackend> backend_;
+    std::size_t input_size_;
+    std::size_t output_size_;
+    ScanPreprocessor preprocessor_;
+    
+    std::atomic<NeuralBackend*> staged_{nullptr};
+    std::atomic<NeuralBackend*> retired_{nullptr};
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__NEURAL_BRIDGE_HPP_
@@ -0,0 +1,205 @@
+/**
+* @file node_metrics.hpp
+* @brief Callback latency, sensor age and timer jitter metrics for the node
+*/
+
+#ifndef EOS_ROBOTICS__NODE_METRICS_HPP_
+#define EOS_ROBOTICS__NODE_METRICS_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+#include "eos_robotics/latency_histogram.hpp"
+#include "eos_robotics/trace_ring.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Everything the node records a latency distribution for
+*/
+enum class LatencyMetric : std::size_t
+{
+    LaserCallback = 0,
+    ImuCallback,
+    OdomCallback,
+    GoalCallback,
+    InferenceCallback,
+    NavigationCallback,
+    StatusCallback,
+    LaserAgeAtInference,  ///< now - scan stamp when inference consumes it
+    ImuAgeAtInference,
+    OdomAgeAtInference,
+    SenseToCmdVel,        ///< now - stamp of the scan behind the latest inference, per command
+    ServerRoundTrip,      ///< client mode: now - scan stamp when the server's result arrives
+    InferenceJitter,      ///< |actual - nominal| timer period
+    NavigationJitter,
+    Count,
+};
+
+const char* to_string(LatencyMetric metric);
+
+/**
+* @brief Periodic callbacks whose schedule is monitored
+*/
+enum class MonitoredLoop : std::size_t
+{
+    Inference = 0,
+    Navigation,
+    Count,
+};
+
+const char* to_string(MonitoredLoop loop);
+
+/**
+* @brief Jitter, missed-period and overrun tracking for one periodic callback
+*
+* begin()/end() are called by the callback itself, from one thread at a time;
+* the counters may be read from any thread.
+*/
+class LoopMonitor
+{
+public:
+    /**
+     * @param period_ns Nominal period; 0 disables monitoring
+     * @param jitter Histogram receiving |actual - nominal| period
+     */
+    void configure(std::int64_t period_ns, LatencyHistogram* jitter)
+    {
+        period_ns_ = period_ns;
+        jitter_ = jitter;
+        started_ = false;
+    }
+
+    void begin(std::int64_t now_ns)
+    {
+        if (period_ns_ <= 0) {
+            return;
+        }
+        if (started_) {
+            const std::int64_t interval = now_ns - last_start_ns_;
+            jitter_->record(interval > period_ns_ ? interval - period_ns_ : period_ns_ - interval);
+            // Ticks that never ran because the previous one was late
+            if (interval >= 2 * period_ns_) {
+                missed_.fetch_add(static_cast<std::uint64_t>(interval / period_ns_ - 1),
+                                  std::memory_order_relaxed);
+            }
+        }
+        last_start_ns_ = now_ns;
+        started_ = true;
+    }
+
+    void end(std::int64_t now_ns)
+    {
+        if (period_ns_ > 0 && now_ns - last_start_ns_ > period_ns_) {
+            overruns_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    std::int64_t period_ns() const { return period_ns_; }
+    std::uint64_t overruns() const { return overruns_.load(std::memory_order_relaxed); }
+    std::uint64_t missed_periods() const { return missed_.load(std::memory_order_relaxed); }
+
+private:
+    std::int64_t period_ns_ = 0;
+    LatencyHistogram* jitter_ = nullptr;
+    std::int64_t last_start_ns_ = 0;
+    bool started_ = false;
+    std::atomic<std::uint64_t> overruns_{0};
+    std::atomic<std::uint64_t> missed_{0};
+};
+
+/**
+* @brief All histograms and loop monitors of one node
+*/
+class NodeMetrics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    LatencyHistogram& histogram(LatencyMetric metric)
+    {
+        return histograms_[static_cast<std::size_t>(metric)];
+    }
+    const LatencyHistogram& histogram(LatencyMetric metric) const
+    {
+        return histograms_[static_cast<std::size_t>(metric)];
+    }
+
+    void record(LatencyMetric metric, std::int64_t value_ns) { histogram(metric).record(value_ns); }
+
+    /**
+     * @brief Start monitoring @p loop with its nominal period and jitter histogram
+     */
+    void configure_loop(MonitoredLoop loop, std::int64_t period_ns, LatencyMetric jitter);
+
+    LoopMonitor& loop(MonitoredLoop loop) { return loops_[static_cast<std::size_t>(loop)]; }
+    const LoopMonitor& loop(MonitoredLoop loop) const
+    {
+        return loops_[static_cast<std::size_t>(loop)];
+    }
+
+    static std::int64_t now_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Human-readable table of every non-empty histogram and loop, in microseconds
+     */
+    void write_report(std::ostream& out) const;
+
+private:
+    std::array<LatencyHistogram, static_cast<std::size_t>(LatencyMetric::Count)> histograms_;
+    std::array<LoopMonitor, static_cast<std::size_t>(MonitoredLoop::Count)> loops_;
+};
+
+/**
+* @brief Records the lifetime of the scope into a callback histogram
+*
+* With a loop monitor attached the scope also counts as one tick of that loop.
+* The same span goes into the calling thread's trace ring, named after the
+* metric, so every callback shows up in a trace dump at no extra clock read.
+*/
+class ScopedLatency
+{
+public:
+    ScopedLatency(NodeMetrics& metrics, LatencyMetric metric, LoopMonitor* loop = nullptr)
+        : histogram_(metrics.histogram(metric)),
+          metric_(metric),
+          loop_(loop),
+          start_ns_(NodeMetrics::now_ns())
+    {
+        if (loop_) {
+            loop_->begin(start_ns_);
+        }
+    }
+
+    ~ScopedLatency()
+    {
+        const std::int64_t end_ns = NodeMetrics::now_ns();
+        histogram_.record(end_ns - start_ns_);
+        trace::complete(to_string(metric_), start_ns_, end_ns - start_ns_);
+        if (loop_) {
+            loop_->end(end_ns);
+        }
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyHistogram& histogram_;
+    LatencyMetric metric_;
+    LoopMonitor* loop_;
+    std::int64_t start_ns_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__NODE_METRICS_HPP_
@@ -0,0 +1,201 @@
+/**
+* @file occupancy_grid.hpp
+* @brief Robot-centred rolling occupancy grid built incrementally from laser scans
+*/
+
+#ifndef EOS_ROBOTICS__OCCUPANCY_GRID_HPP_
+#define EOS_ROBOTICS__OCCUPANCY_GRID_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/pose2d.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Grid geometry and log-odds sensor model
+*/
+struct OccupancyGridConfig
+{
+    float resolution = 0.05f;     ///< meters per cell
+    std::size_t cells = 256;      ///< cells per side, a power of two multiple of kTileSide
+    float max_range = 5.0f;       ///< returns are integrated up to this range
+
+    // Log-odds increments and bounds; clamping keeps cells able to change state
+    float hit_log_odds = 0.85f;
+    float miss_log_odds = -0.4f;
+    float min_log_odds = -2.0f;
+    float max_log_odds = 3.5f;
+    float occupied_log_odds = 0.4f;  ///< cells above this count as occupied
+};
+
+/**
+* @brief Inclusive rectangle of odom-frame cells; empty when min > max
+*/
+struct CellRegion
+{
+    long min_x = std::numeric_limits<long>::max();
+    long min_y = std::numeric_limits<long>::max();
+    long max_x = std::numeric_limits<long>::min();
+    long max_y = std::numeric_limits<long>::min();
+
+    bool empty() const { return min_x > max_x || min_y > max_y; }
+
+    void include(long cx, long cy) { include(cx, cy, cx, cy); }
+
+    void include(long x0, long y0, long x1, long y1)
+    {
+        min_x = std::min(min_x, x0);
+        min_y = std::min(min_y, y0);
+        max_x = std::max(max_x, x1);
+        max_y = std::max(max_y, y1);
+    }
+};
+
+/**
+* @brief Square window of cells that follows the robot through the odom frame
+*
+* Cells hold quantised log-odds (int8) and are stored in 16 x 16 tiles, so
+* a neighbourhood query or a short ray touches a few cache lines. Cell
+* (x, y) of the odom frame always lives at (x, y) modulo cells(): when the
+* window moves, only the rows and columns that enter it are cleared and
+* nothing is copied. Every query is O(1).
+*
+* integrate_scan() ray-casts each beam from the robot with Bresenham's
+* algorithm: cells along the beam get a miss, the endpoint a hit. Beam
+* directions come from a table cached per scan geometry, so a scan costs no
+* trigonometry per beam; the table only reallocates when a scan with more
+* beams than any before it arrives.
+*
+* The cells whose occupied state flips are accumulated in dirty_region()
+* until clear_dirty(), so layers derived from the grid only redo the part
+* that changed. Moves of the window are not recorded there; such layers
+* follow origin_x() and origin_y() themselves.
+*/
+class OccupancyGrid
+{
+public:
+    static constexpr std::size_t kTileShift = 4;
+    static constexpr std::size_t kTileSide = std::size_t{1} << kTileShift;
+
+    /**
+     * @throws std::invalid_argument for a non-power-of-two size, a size that
+     *         is not a whole number of tiles, or a bad sensor model
+     */
+    explicit OccupancyGrid(const OccupancyGridConfig& config);
+
+    /**
+     * @brief Centre the window on (x, y), clearing the cells that enter it
+     */
+    void recenter(float x, float y);
+
+    /**
+     * @brief Integrate one scan taken from @p pose
+     *
+     * NaN and returns below range_min are skipped; returns at or beyond
+     * range_max, or beyond max_range, clear the beam up to the nearer of the
+     * two without marking a hit.
+     */
+    void integrate_scan(const Pose2D& pose, const float* ranges, std::size_t count,
+                        float range_min, float range_max, float angle_min,
+                        float angle_increment);
+
+    /// Cell index along one axis of the odom frame
+    long cell_of(float coordinate) const
+    {
+        return static_cast<long>(std::floor(coordinate / config_.resolution));
+    }
+
+    bool contains_cell(long cx, long cy) const
+    {
+        return static_cast<unsigned long>(cx - origin_x_) < config_.cells &&
+               static_cast<unsigned long>(cy - origin_y_) < config_.cells;
+    }
+
+    /// Log-odds of a cell; 0 (unknown) outside the window
+    float log_odds_cell(long cx, long cy) const
+    {
+        return contains_cell(cx, cy) ? cells_[index(cx, cy)] * kLogOddsStep : 0.0f;
+    }
+
+    bool occupied_cell(long cx, long cy) const
+    {
+        return contains_cell(cx, cy) && cells_[index(cx, cy)] > occupied_threshold_;
+    }
+
+    /// Occupancy probability at a point; 0.5 when unknown or outside the window
+    float probability(float x, float y) const
+    {
+        return 1.0f - 1.0f / (1.0f + std::exp(log_odds_cell(cell_of(x), cell_of(y))));
+    }
+
+    bool occupied(float x, float y) const { return occupied_cell(cell_of(x), cell_of(y)); }
+
+    /// Lowest cell of the window along each axis
+    long origin_x() const { return origin_x_; }
+    long origin_y() const { return origin_y_; }
+
+    std::size_t cells() const { return config_.cells; }
+    float resolution() const { return config_.resolution; }
+    const OccupancyGridConfig& config() const { return config_; }
+
+    /// Scans integrated since construction
+    std::uint64_t scans() const { return scans_; }
+
+    /// Bounding box of the cells whose occupied state flipped since clear_dirty()
+    const CellRegion& dirty_region() const { return dirty_; }
+    void clear_dirty() { dirty_ = CellRegion{}; }
+
+    /// One quantisation step of the stored log-odds
+    static constexpr float kLogOddsStep = 1.0f / 16.0f;
+
+private:
+    /// Tiled storage index of odom-frame cell (cx, cy); must be in the window
+    std::size_t index(long cx, long cy) const
+    {
+        const std::size_t x = static_cast<std::size_t>(cx) & mask_;
+        const std::size_t y = static_cast<std::size_t>(cy) & mask_;
+        const std::size_t tile = (y >> kTileShift) * tiles_per_side_ + (x >> kTileShift);
+        return (tile << (2 * kTileShift)) | ((y & (kTileSide - 1)) << kTileShift) |
+               (x & (kTileSide - 1));
+    }
+
+    void update_cell(long cx, long cy, int delta);
+    void clear_columns(long first, long last);
+    void clear_rows(long first, long last);
+    void trace_ray(long x0, long y0, long x1, long y1, bool hit);
+    void update_beam_table(std::size_t count, float angle_min, float angle_increment);
+
+    OccupancyGridConfig config_;
+    std::size_t mask_;
+    std::size_t tiles_per_side_;
+    AlignedBuffer<std::int8_t> cells_;
+    int hit_;
+    int miss_;
+    int min_;
+    int max_;
+    int occupied_threshold_;
+
+    long origin_x_ = 0;
+    long origin_y_ = 0;
+    std::uint64_t scans_ = 0;
+    CellRegion dirty_;
+
+    // Beam directions in the sensor frame for the current scan geometry
+    std::vector<float> beam_cos_;
+    std::vector<float> beam_sin_;
+    std::size_t table_count_ = 0;
+    float table_angle_min_ = 0.0f;
+    float table_angle_increment_ = 0.0f;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__OCCUPANCY_GRID_HPP_
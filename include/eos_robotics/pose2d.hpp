@@ -0,0 +1,69 @@
+/**
+* @file pose2d.hpp
+* @brief Planar pose types shared by the localization, mapping and planning stages
+*/
+
+#ifndef EOS_ROBOTICS__POSE2D_HPP_
+#define EOS_ROBOTICS__POSE2D_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace eos
+{
+
+/**
+* @brief Planar pose; goals, maps and the robot pose share one frame (odom)
+*/
+struct Pose2D
+{
+    float x = 0.0f;
+    float y = 0.0f;
+    float theta = 0.0f;
+};
+
+/**
+* @brief Filtered pose and body twist at one instant
+*
+* Small and trivially copyable so it can travel through the sensor snapshot
+* to the control and inference threads.
+*/
+struct PoseEstimate
+{
+    Pose2D pose;
+    float linear_velocity = 0.0f;   ///< m/s, forward
+    float angular_velocity = 0.0f;  ///< rad/s, counter-clockwise
+    std::int64_t stamp_ns = 0;
+    bool valid = false;
+
+    /**
+     * @brief Pose at @p query_ns, holding the twist constant
+     *
+     * Works backwards too, e.g. for the pose a scan was taken from. The
+     * offset is clamped to @p max_horizon_s seconds either side of stamp_ns,
+     * so a stale estimate never runs away.
+     */
+    Pose2D at(std::int64_t query_ns, float max_horizon_s) const
+    {
+        const float dt = std::clamp(static_cast<float>(query_ns - stamp_ns) * 1e-9f,
+                                    -max_horizon_s, max_horizon_s);
+        const float v = linear_velocity;
+        const float w = angular_velocity;
+        Pose2D result = pose;
+        result.theta = pose.theta + w * dt;
+        if (std::abs(w) > 1e-6f) {
+            // Constant twist traces an arc
+            result.x += v / w * (std::sin(result.theta) - std::sin(pose.theta));
+            result.y -= v / w * (std::cos(result.theta) - std::cos(pose.theta));
+        } else {
+            result.x += v * dt * std::cos(pose.theta);
+            result.y += v * dt * std::sin(pose.theta);
+        }
+        return result;
+    }
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__POSE2D_HPP_
@@ -0,0 +1,226 @@
+/**
+* @file pose_ekf.hpp
+* @brief Fixed-size extended Kalman filter fusing wheel odometry with the IMU
+*/
+
+#ifndef EOS_ROBOTICS__POSE_EKF_HPP_
+#define EOS_ROBOTICS__POSE_EKF_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "eos_robotics/pose2d.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Process and measurement noise of the pose filter, as standard deviations
+*/
+struct PoseEkfConfig
+{
+    // Process noise densities: how fast the unmodelled part may change
+    double acceleration_noise = 1.0;          ///< m/s^2 per sqrt(s)
+    double angular_acceleration_noise = 2.0;  ///< rad/s^2 per sqrt(s)
+    double position_noise = 0.02;             ///< m per sqrt(s), wheel slip
+    double heading_noise = 0.02;              ///< rad per sqrt(s)
+
+    // Measurement noise
+    double odom_position_stddev = 0.02;       ///< m
+    double odom_heading_stddev = 0.02;        ///< rad
+    double odom_velocity_stddev = 0.05;       ///< m/s
+    double odom_angular_velocity_stddev = 0.1;
+    double gyro_stddev = 0.02;                ///< rad/s
+};
+
+/**
+* @brief Unicycle EKF over [x, y, theta, v, omega] in the odom frame
+*
+* Odometry corrects the full state; the gyro corrects omega and the forward
+* accelerometer reading drives v between odometry messages, so the estimate
+* moves at IMU rate. Every matrix has compile-time dimensions and the filter
+* never allocates.
+*
+* Measurements are expected roughly in stamp order. One older than the
+* filter (odometry usually lags the IMU by a few milliseconds) is applied at
+* the filter's time instead of being replayed.
+*/
+class PoseEkf
+{
+public:
+    static constexpr int kStateSize = 5;
+    enum Index { X = 0, Y, Theta, V, Omega };
+
+    using State = Eigen::Matrix<double, kStateSize, 1>;
+    using Covariance = Eigen::Matrix<double, kStateSize, kStateSize>;
+
+    /**
+     * @throws std::invalid_argument for a non-positive standard deviation
+     */
+    explicit PoseEkf(const PoseEkfConfig& config = PoseEkfConfig{})
+        : config_(config)
+    {
+        for (const double stddev : {config_.acceleration_noise, config_.angular_acceleration_noise,
+                                    config_.position_noise, config_.heading_noise,
+                                    config_.odom_position_stddev, config_.odom_heading_stddev,
+                                    config_.odom_velocity_stddev,
+                                    config_.odom_angular_velocity_stddev, config_.gyro_stddev}) {
+            if (!(stddev > 0.0)) {
+                throw std::invalid_argument("Pose filter noise must be positive");
+            }
+        }
+        reset();
+    }
+
+    /// Forget everything; the next odometry message initialises the filter
+    void reset()
+    {
+        state_.setZero();
+        covariance_.setIdentity();
+        stamp_ns_ = 0;
+        acceleration_ = 0.0;
+        initialized_ = false;
+    }
+
+    bool initialized() const { return initialized_; }
+
+    /**
+     * @brief Fuse one odometry message: pose and body twist
+     */
+    void add_odometry(std::int64_t stamp_ns, double x, double y, double theta, double v,
+                      double omega)
+    {
+        State z;
+        z << x, y, theta, v, omega;
+        if (!initialized_) {
+            state_ = z;
+            covariance_ = odom_noise();
+            stamp_ns_ = stamp_ns;
+            initialized_ = true;
+            return;
+        }
+
+        predict(stamp_ns);
+        State innovation = z - state_;
+        innovation(Theta) = wrap_angle(innovation(Theta));
+        correct<kStateSize>(innovation, Covariance::Identity(), odom_noise());
+    }
+
+    /**
+     * @brief Fuse one IMU sample: yaw rate and forward acceleration
+     *
+     * Ignored until odometry has initialised the filter.
+     */
+    void add_imu(std::int64_t stamp_ns, double angular_velocity, double forward_acceleration)
+    {
+        if (!initialized_) {
+            return;
+        }
+        predict(stamp_ns);
+        acceleration_ = forward_acceleration;
+
+        Eigen::Matrix<double, 1, kStateSize> h = Eigen::Matrix<double, 1, kStateSize>::Zero();
+        h(Omega) = 1.0;
+        Eigen::Matrix<double, 1, 1> innovation;
+        innovation << angular_velocity - state_(Omega);
+        Eigen::Matrix<double, 1, 1> r;
+        r << config_.gyro_stddev * config_.gyro_stddev;
+        correct<1>(innovation, h, r);
+    }
+
+    /// Current estimate, for the snapshot and extrapolation with PoseEstimate::at()
+    PoseEstimate estimate() const
+    {
+        PoseEstimate result;
+        result.pose = Pose2D{static_cast<float>(state_(X)), static_cast<float>(state_(Y)),
+                             static_cast<float>(state_(Theta))};
+        result.linear_velocity = static_cast<float>(state_(V));
+        result.angular_velocity = static_cast<float>(state_(Omega));
+        result.stamp_ns = stamp_ns_;
+        result.valid = initialized_;
+        return result;
+    }
+
+    const State& state() const { return state_; }
+    const Covariance& covariance() const { return covariance_; }
+    std::int64_t stamp_ns() const { return stamp_ns_; }
+
+private:
+    static double wrap_angle(double angle)
+    {
+        constexpr double kTwoPi = 6.283185307179586;
+        return std::remainder(angle, kTwoPi);
+    }
+
+    Covariance odom_noise() const
+    {
+        State variances;
+        variances << config_.odom_position_stddev, config_.odom_position_stddev,
+            config_.odom_heading_stddev, config_.odom_velocity_stddev,
+            config_.odom_angular_velocity_stddev;
+        return variances.cwiseProduct(variances).asDiagonal();
+    }
+
+    /// Propagate the state to @p stamp_ns; older stamps leave it where it is
+    void predict(std::int64_t stamp_ns)
+    {
+        if (stamp_ns <= stamp_ns_) {
+            return;
+        }
+        const double dt = static_cast<double>(stamp_ns - stamp_ns_) * 1e-9;
+        stamp_ns_ = stamp_ns;
+
+        const double theta = state_(Theta);
+        const double v = state_(V);
+        const double c = std::cos(theta);
+        const double s = std::sin(theta);
+
+        Covariance f = Covariance::Identity();
+        f(X, Theta) = -v * s * dt;
+        f(X, V) = c * dt;
+        f(Y, Theta) = v * c * dt;
+        f(Y, V) = s * dt;
+        f(Theta, Omega) = dt;
+
+        state_(X) += v * c * dt;
+        state_(Y) += v * s * dt;
+        state_(Theta) = wrap_angle(theta + state_(Omega) * dt);
+        state_(V) += acceleration_ * dt;
+
+        State densities;
+        densities << config_.position_noise, config_.position_noise, config_.heading_noise,
+            config_.acceleration_noise, config_.angular_acceleration_noise;
+        const Covariance q = (densities.cwiseProduct(densities) * dt).asDiagonal();
+        covariance_ = f * covariance_ * f.transpose() + q;
+    }
+
+    template <int M>
+    void correct(const Eigen::Matrix<double, M, 1>& innovation,
+                 const Eigen::Matrix<double, M, kStateSize>& h,
+                 const Eigen::Matrix<double, M, M>& r)
+    {
+        const Eigen::Matrix<double, M, M> s = h * covariance_ * h.transpose() + r;
+        const Eigen::Matrix<double, kStateSize, M> gain =
+            covariance_ * h.transpose() * s.inverse();
+        state_ += gain * innovation;
+        state_(Theta) = wrap_angle(state_(Theta));
+        // Joseph form keeps the covariance symmetric positive definite
+        const Covariance i_kh = Covariance::Identity() - gain * h;
+        covariance_ = i_kh * covariance_ * i_kh.transpose() + gain * r * gain.transpose();
+    }
+
+    PoseEkfConfig config_;
+    State state_;
+    Covariance covariance_;
+    std::int64_t stamp_ns_ = 0;
+    double acceleration_ = 0.0;
+    bool initialized_ = false;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__POSE_EKF_HPP_
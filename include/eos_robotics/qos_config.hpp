@@ -0,0 +1,64 @@
+/**
+* @file qos_config.hpp
+* @brief Per-topic QoS profiles loaded from parameters
+*/
+
+#ifndef EOS_ROBOTICS__QOS_CONFIG_HPP_
+#define EOS_ROBOTICS__QOS_CONFIG_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Depth / reliability / durability triple as written in params.yaml
+*/
+struct QosSettings
+{
+    std::size_t depth = 10;
+    std::string reliability = "reliable";   ///< "reliable" or "best_effort"
+    std::string durability = "volatile";    ///< "volatile" or "transient_local"
+};
+
+/**
+* @brief Best-effort, keep-last-1 profile used by default for /scan, /imu and /odom
+*
+* A stale scan is worth nothing to the controller, so sensors never queue.
+*/
+QosSettings sensor_qos_defaults();
+
+/**
+* @brief Build an rclcpp::QoS from settings
+*
+* @throws std::invalid_argument for an unknown reliability or durability
+*/
+rclcpp::QoS make_qos(const QosSettings& settings);
+
+/**
+* @brief Declare `ros.qos.<key>.{depth,reliability,durability}` and build the profile
+*
+* Parameters that are already declared are read instead, so publishers and
+* subscriptions can be recreated across lifecycle transitions.
+*
+* @param key Topic key, e.g. "laser_scan"
+* @param defaults Values used when the parameters are not overridden
+* @throws std::invalid_argument for a depth below 1, or an unknown
+*         reliability or durability
+*/
+rclcpp::QoS declare_topic_qos(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters,
+    const std::string& key,
+    const QosSettings& defaults);
+
+/**
+* @brief Intra-process has to be disabled for transient_local entities
+*/
+rclcpp::IntraProcessSetting intra_process_setting(const rclcpp::QoS& qos);
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__QOS_CONFIG_HPP_
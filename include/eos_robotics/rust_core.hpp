@@ -0,0 +1,119 @@
+/**
+* @file rust_core.hpp
+* @brief RAII wrappers around the C ABI of the in-process Rust core
+*
+* Only available when built with -DEOS_WITH_RUST_CORE=ON, which links the
+* `eos` crate's staticlib into the target.
+*/
+
+#ifndef EOS_ROBOTICS__RUST_CORE_HPP_
+#define EOS_ROBOTICS__RUST_CORE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "eos_robotics/eos_core.h"
+
+namespace eos
+{
+
+/**
+* @brief Throw for a failed core call, with the core's message
+*
+* @throws std::invalid_argument for EOS_STATUS_INVALID_ARGUMENT
+* @throws std::runtime_error for any other failure
+*/
+void check_core_status(EosStatus status, const char* call);
+
+/**
+* @brief The Rust NavigationPlanner and MotionController, stepped together
+*
+* step() borrows the scan ranges for the duration of the call: nothing is
+* copied across the boundary. Planning allocates on the Rust heap, which the
+* allocation guard does not see.
+*/
+class RustNavigator
+{
+public:
+    /**
+     * @throws std::runtime_error if the core rejects the parameters
+     */
+    explicit RustNavigator(const EosNavigationParams& params);
+
+    RustNavigator(const RustNavigator&) = delete;
+    RustNavigator& operator=(const RustNavigator&) = delete;
+
+    void set_goal(const EosPose2D& goal);
+    void clear_goal();
+
+    /**
+     * @brief Plan on one scan and return this tick's velocity command
+     *
+     * @param neural Firing rates guiding the planner, or nullptr
+     * @param pose Current pose, or nullptr for the origin
+     *
+     * @throws std::runtime_error if no safe path exists or limits are exceeded
+     */
+    EosMotionCommand step(const EosScan& scan, const float* neural, std::size_t neural_count,
+                          const EosPose2D* pose);
+
+    /**
+     * @brief Zero command; resets the controller's velocity profile
+     */
+    EosMotionCommand emergency_stop();
+
+private:
+    struct Deleter
+    {
+        void operator()(EosNavigator* navigator) const { eos_navigator_free(navigator); }
+    };
+    std::unique_ptr<EosNavigator, Deleter> handle_;
+};
+
+/**
+* @brief The Rust SNNEngine on preprocessed features
+*/
+class RustSnn
+{
+public:
+    /**
+     * @brief Create the engine with the core's default model
+     *
+     * @throws std::runtime_error if the core rejects the topology
+     */
+    explicit RustSnn(const EosNeuralParams& params);
+
+    RustSnn(const RustSnn&) = delete;
+    RustSnn& operator=(const RustSnn&) = delete;
+
+    /**
+     * @brief Replace the model with a JSON model file
+     *
+     * @throws std::runtime_error if the file cannot be read or parsed
+     */
+    void load_model(const std::string& path);
+
+    /**
+     * @brief Run input_size() features into output_size() outputs
+     *
+     * @throws std::invalid_argument if a pointer is null
+     */
+    void process(const float* input, float* output) const;
+
+    std::size_t input_size() const { return input_size_; }
+    std::size_t output_size() const { return output_size_; }
+
+private:
+    struct Deleter
+    {
+        void operator()(EosSnn* snn) const { eos_snn_free(snn); }
+    };
+    std::unique_ptr<EosSnn, Deleter> handle_;
+    std::size_t input_size_;
+    std::size_t output_size_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__RUST_CORE_HPP_
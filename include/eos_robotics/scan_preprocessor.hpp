@@ -0,0 +1,96 @@
+/**
+* @file scan_preprocessor.hpp
+* @brief LaserScan -> network input: sanitise, bin and normalise the ranges
+*/
+
+#ifndef EOS_ROBOTICS__SCAN_PREPROCESSOR_HPP_
+#define EOS_ROBOTICS__SCAN_PREPROCESSOR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+
+namespace eos
+{
+
+/**
+* @brief How beams are grouped into input bins
+*/
+enum class BinningStrategy
+{
+    Min,     ///< equal beam counts per bin, nearest return wins
+    Mean,    ///< equal beam counts per bin, average return
+    Sector,  ///< fixed angular sectors around the heading, nearest return wins
+};
+
+/**
+* @brief Parse "min" / "mean" / "sector"
+*
+* @throws std::invalid_argument for any other string
+*/
+BinningStrategy parse_binning_strategy(const std::string& name);
+
+/**
+* @brief Scan preprocessing settings
+*/
+struct ScanPreprocessorConfig
+{
+    std::size_t bins = 100;                        ///< neural.input_size
+    BinningStrategy strategy = BinningStrategy::Min;
+    float sector_fov = 6.283185307f;               ///< Sector: field of view centred on +x, radians
+};
+
+/**
+* @brief Turns raw ranges into `bins` values in [0, 1] (range / range_max)
+*
+* Invalid returns (NaN, inf, outside [range_min, range_max]) count as free
+* space. Bin boundaries are cached per scan geometry, and all buffers are
+* preallocated: process() only allocates when a scan with more beams than
+* any before it arrives.
+*/
+class ScanPreprocessor
+{
+public:
+    explicit ScanPreprocessor(const ScanPreprocessorConfig& config);
+
+    /**
+     * @brief Preprocess one scan into output()
+     */
+    void process(const float* ranges, std::size_t count, float range_min, float range_max,
+                 float angle_min, float angle_increment);
+
+    /// Aligned buffer of size() normalised bins, valid until the next process()
+    const float* output() const { return output_.data(); }
+    std::size_t size() const { return config_.bins; }
+    const ScanPreprocessorConfig& config() const { return config_; }
+
+private:
+    void update_bin_table(std::size_t count, float angle_min, float angle_increment);
+
+    ScanPreprocessorConfig config_;
+    AlignedBuffer<float> sanitized_;
+    AlignedBuffer<float> output_;
+
+    /// Contiguous run of beams [begin, end) that belongs to one bin
+    struct Segment
+    {
+        std::uint32_t begin;
+        std::uint32_t end;
+    };
+
+    // Segments of bin b are segments_[bin_segments_[b] .. bin_segments_[b + 1]).
+    // Min/Mean bins are one segment each; a sector that straddles the
+    // scan's wrap-around point is two.
+    std::vector<Segment> segments_;
+    std::vector<std::uint32_t> bin_segments_;
+    std::size_t table_count_ = 0;
+    float table_angle_min_ = 0.0f;
+    float table_angle_increment_ = 0.0f;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__SCAN_PREPROCESSOR_HPP_
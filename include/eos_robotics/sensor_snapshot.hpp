@@ -0,0 +1,157 @@
+/**
+* @file sensor_snapshot.hpp
+* @brief Lock-free hand-off of the latest laser / IMU / odometry tuple
+*/
+
+#ifndef EOS_ROBOTICS__SENSOR_SNAPSHOT_HPP_
+#define EOS_ROBOTICS__SENSOR_SNAPSHOT_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "sensor_msgs/msg/laser_scan.hpp"
+#include "sensor_msgs/msg/imu.hpp"
+#include "nav_msgs/msg/odometry.hpp"
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/pose2d.hpp"
+#include "eos_robotics/triple_buffer.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Consistent set of the most recent sensor messages
+*
+* Messages are shared, never copied: the frame only holds const pointers to
+* what the subscriptions delivered. The preprocessed scan features are
+* copied into storage preallocated in every slot.
+*/
+struct SensorFrame
+{
+    sensor_msgs::msg::LaserScan::ConstSharedPtr laser;
+    sensor_msgs::msg::Imu::ConstSharedPtr imu;
+    nav_msgs::msg::Odometry::ConstSharedPtr odom;
+
+    AlignedBuffer<float> features;  ///< preprocessed laser (ScanPreprocessor output)
+    PoseEstimate pose;              ///< fused odometry + IMU, as of the latest IMU or odom
+    std::int64_t imu_stamp_near_laser_ns = 0;  ///< IMU sample closest to the scan's stamp
+
+    std::uint64_t laser_sequence = 0;  ///< incremented for every new scan
+    std::uint64_t sequence = 0;        ///< incremented for every publish
+
+    bool complete() const { return laser && imu && odom; }
+};
+
+/**
+* @brief Consumers of the snapshot; each gets its own wait-free channel
+*/
+enum class SnapshotReader : std::size_t
+{
+    Inference = 0,
+    Control,
+};
+
+/**
+* @brief Single-producer, multi-reader sensor snapshot
+*
+* The sensor callbacks are the only producer and must not run concurrently
+* with each other (keep them in one mutually exclusive callback group). Each
+* publish fans the updated frame out to one TripleBuffer per reader, so
+* readers on other threads never see a half-updated tuple and never take a
+* lock.
+*/
+class SensorSnapshot
+{
+public:
+    static constexpr std::size_t kReaderCount = 2;
+
+    /**
+     * @brief Allocate room for @p size scan features in every slot
+     *
+     * Must be called before the snapshot is shared between threads.
+     */
+    explicit SensorSnapshot(std::size_t feature_size = 0)
+    {
+        working_.features = AlignedBuffer<float>(feature_size);
+        for (auto& channel : channels_) {
+            channel.initialize([feature_size](SensorFrame& frame) {
+                frame.features = AlignedBuffer<float>(feature_size);
+            });
+        }
+    }
+
+    /**
+     * @brief Publish a new scan together with its preprocessed features
+     *
+     * @param features feature_size() values, copied into the snapshot
+     */
+    void publish_laser(sensor_msgs::msg::LaserScan::ConstSharedPtr msg, const float* features)
+    {
+        working_.laser = std::move(msg);
+        std::copy(features, features + working_.features.size(), working_.features.begin());
+        ++working_.laser_sequence;
+        publish();
+    }
+
+    /// Pose estimate carried by every publish from now on
+    void stage_pose(const PoseEstimate& pose) { working_.pose = pose; }
+
+    /// Stamp of the IMU sample closest to the current scan, carried likewise
+    void stage_imu_match(std::int64_t stamp_ns) { working_.imu_stamp_near_laser_ns = stamp_ns; }
+
+    void publish_imu(sensor_msgs::msg::Imu::ConstSharedPtr msg)
+    {
+        working_.imu = std::move(msg);
+        publish();
+    }
+
+    void publish_odom(nav_msgs::msg::Odometry::ConstSharedPtr msg)
+    {
+        working_.odom = std::move(msg);
+        publish();
+    }
+
+    /**
+     * @brief Latest frame for @p reader
+     *
+     * The reference stays valid until the same reader calls acquire() again.
+     * Only one thread may act as a given reader at a time.
+     */
+    const SensorFrame& acquire(SnapshotReader reader)
+    {
+        auto& channel = channels_[static_cast<std::size_t>(reader)];
+        channel.update();
+        return channel.read_buffer();
+    }
+
+    std::size_t feature_size() const { return working_.features.size(); }
+
+private:
+    void publish()
+    {
+        ++working_.sequence;
+        for (auto& channel : channels_) {
+            SensorFrame& slot = channel.write_buffer();
+            slot.laser = working_.laser;
+            slot.imu = working_.imu;
+            slot.odom = working_.odom;
+            slot.pose = working_.pose;
+            slot.imu_stamp_near_laser_ns = working_.imu_stamp_near_laser_ns;
+            std::copy(working_.features.begin(), working_.features.end(), slot.features.begin());
+            slot.laser_sequence = working_.laser_sequence;
+            slot.sequence = working_.sequence;
+            channel.publish();
+        }
+    }
+
+    SensorFrame working_;
+    std::array<TripleBuffer<SensorFrame>, kReaderCount> channels_;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__SENSOR_SNAPSHOT_HPP_
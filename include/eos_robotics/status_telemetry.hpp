@@ -0,0 +1,117 @@
+/**
+* @file status_telemetry.hpp
+* @brief Delta encoding of per-stage latencies and process CPU/memory sampling for /eos/status
+*/
+
+#ifndef EOS_ROBOTICS__STATUS_TELEMETRY_HPP_
+#define EOS_ROBOTICS__STATUS_TELEMETRY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "eos_robotics/latency_histogram.hpp"
+
+namespace eos
+{
+
+/**
+* @brief Latency of one stage as it goes on the wire, in microseconds
+*/
+struct StageLatencySample
+{
+    std::uint8_t stage = 0;   ///< eos::LatencyMetric of the stage
+    std::uint32_t p50_us = 0;
+    std::uint32_t p99_us = 0;
+    std::uint32_t max_us = 0;
+
+    /// Wire form of a histogram summary; saturates at ~71 minutes
+    static StageLatencySample from_summary(std::uint8_t stage, const HistogramSummary& summary);
+};
+
+/**
+* @brief status.* parameters that shape the stage list of each message
+*/
+struct StatusEncoderConfig
+{
+    bool delta = false;                   ///< status.delta_encoding
+    std::uint32_t keyframe_interval = 10; ///< status.keyframe_interval, messages per keyframe
+    std::uint32_t deadband_us = 50;       ///< status.latency_deadband_us
+};
+
+/**
+* @brief Picks the stages each status message carries
+*
+* Without delta encoding every message is a keyframe and carries all stages.
+* With it, a keyframe goes out every keyframe_interval messages (and on
+* force_keyframe()); the messages in between only carry the stages that are
+* new or whose p50, p99 or max moved by more than the deadband since the
+* value last sent. A receiver that keeps the last value per stage therefore
+* never drifts by more than the deadband, and a gap in the sequence numbers
+* is repaired by the next keyframe. Owned by the status callback group.
+*/
+class StatusDeltaEncoder
+{
+public:
+    /**
+     * @throws std::invalid_argument for a keyframe interval of 0
+     */
+    explicit StatusDeltaEncoder(const StatusEncoderConfig& config = StatusEncoderConfig{});
+
+    /**
+     * @brief Encode the next message from the @p count current stage samples
+     *
+     * @param out Cleared and filled with the stages to send
+     * @return true if the message is a keyframe
+     */
+    bool encode(const StageLatencySample* current, std::size_t count,
+                std::vector<StageLatencySample>& out);
+
+    /// Make the next message a keyframe, e.g. after a lifecycle transition
+    void force_keyframe() { force_keyframe_ = true; }
+
+    /// Sequence number of the message encode() last produced; the first is 0
+    std::uint32_t sequence() const { return sequence_ - 1; }
+
+    const StatusEncoderConfig& config() const { return config_; }
+
+private:
+    bool changed(const StageLatencySample& sample) const;
+
+    StatusEncoderConfig config_;
+    std::vector<StageLatencySample> sent_;   ///< indexed by stage
+    std::vector<bool> has_sent_;
+    std::uint32_t sequence_ = 0;
+    std::uint32_t since_keyframe_ = 0;
+    bool force_keyframe_ = true;
+};
+
+/**
+* @brief CPU usage and resident memory of this process
+*/
+struct ProcessUsageSample
+{
+    double cpu_percent = 0.0;  ///< CPU time over wall time since the previous sample, 100 = one core
+    std::uint64_t rss_kib = 0; ///< resident set size; 0 where /proc is unavailable
+};
+
+/**
+* @brief Samples getrusage() and /proc/self/statm; not thread-safe
+*/
+class ProcessUsage
+{
+public:
+    /**
+     * @brief Usage since the previous call; the first call reports 0% CPU
+     */
+    ProcessUsageSample sample();
+
+private:
+    bool started_ = false;
+    std::int64_t last_cpu_us_ = 0;
+    std::int64_t last_wall_us_ = 0;
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__STATUS_TELEMETRY_HPP_
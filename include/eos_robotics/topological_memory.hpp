@@ -0,0 +1,195 @@
+/**
+* @file topological_memory.hpp
+* @brief Topological map and trajectory memory with a spatial-hash index and an append-only journal
+*
+* The C++ counterpart of the Rust core's Memory. Map nodes are laid every
+* node_spacing metres along the path and indexed in a uniform grid whose
+* cells are loop_closure_radius wide, so a loop-closure query looks at the
+* nine cells around the pose instead of every node. A revisit merges into
+* the node it closes on rather than laying a new one, so the map grows with
+* the area explored, not with run time.
+*
+* Persistence is an append-only log of fixed-size checksummed records:
+* every flush writes only the nodes and closures added since the previous
+* one, and loading replays the log, ignoring a record torn by a crash.
+*/
+
+#ifndef EOS_ROBOTICS__TOPOLOGICAL_MEMORY_HPP_
+#define EOS_ROBOTICS__TOPOLOGICAL_MEMORY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "eos_robotics/pose2d.hpp"
+
+namespace eos
+{
+
+struct TopologicalMemoryConfig
+{
+    std::size_t trajectory_length = 100;          ///< recent poses kept
+    float node_spacing = 0.5f;                    ///< path length between map nodes, m
+    float loop_closure_radius = 0.5f;             ///< also the index cell size, m
+    float loop_closure_heading = 0.1f;            ///< rad
+    std::size_t loop_closure_min_separation = 20; ///< node steps before a node can be closed on
+    std::size_t max_nodes = 50000;                ///< no new nodes beyond this
+};
+
+/**
+* @brief A familiar place
+*/
+struct MapNode
+{
+    std::uint64_t id = 0;
+    Pose2D pose;
+    std::int64_t stamp_ns = 0;  ///< when it was laid
+    std::uint32_t visits = 1;
+};
+
+/**
+* @brief A revisit: the robot came from node @p from back to node @p to
+*/
+struct LoopClosure
+{
+    std::uint64_t from = 0;
+    std::uint64_t to = 0;
+    std::int64_t stamp_ns = 0;
+};
+
+struct TrajectoryPoint
+{
+    Pose2D pose;
+    std::int64_t stamp_ns = 0;
+};
+
+/**
+* @brief What one observe() call changed
+*/
+struct MemoryUpdate
+{
+    bool node_added = false;
+    bool loop_closed = false;
+    std::uint64_t node_id = 0;  ///< the node the robot is at, if it has reached one
+};
+
+/**
+* @brief Map nodes, loop closures and the recent trajectory of one robot
+*
+* Not thread-safe; owned by one callback group.
+*/
+class TopologicalMemory
+{
+public:
+    /**
+     * @throws std::invalid_argument for a non-positive spacing or radius, a
+     *         negative heading tolerance or an empty trajectory
+     */
+    explicit TopologicalMemory(const TopologicalMemoryConfig& config);
+
+    /**
+     * @brief Record a pose; lays a node or closes a loop once the robot is
+     *        node_spacing from the node it was last at
+     */
+    MemoryUpdate observe(const Pose2D& pose, std::int64_t stamp_ns);
+
+    /**
+     * @brief Closest node within loop_closure_radius and loop_closure_heading
+     *        of @p pose, skipping nodes visited within the last
+     *        loop_closure_min_separation node steps
+     *
+     * @return The node's index in nodes(), or -1
+     */
+    std::int64_t find_loop_closure(const Pose2D& pose) const;
+
+    /**
+     * @brief Append the indices into nodes() of every node within @p radius of (x, y)
+     */
+    void query_radius(float x, float y, float radius, std::vector<std::size_t>& out) const;
+
+    /// Recent poses, oldest first
+    void trajectory(std::vector<TrajectoryPoint>& out) const;
+
+    const std::vector<MapNode>& nodes() const { return nodes_; }
+    const std::vector<LoopClosure>& loop_closures() const { return closures_; }
+    bool full() const { return nodes_.size() >= config_.max_nodes; }
+    const TopologicalMemoryConfig& config() const { return config_; }
+
+    /// Replay a node from a journal; nodes must arrive in id order
+    void restore_node(const MapNode& node);
+
+    /// Replay a closure from a journal; counts a visit of its target
+    void restore_closure(const LoopClosure& closure);
+
+private:
+    std::uint64_t cell_key(float x, float y) const;
+    void index_node(std::size_t index);
+
+    TopologicalMemoryConfig config_;
+    float inverse_cell_size_;
+
+    std::vector<MapNode> nodes_;
+    std::vector<LoopClosure> closures_;
+    std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> grid_;
+    // Node step (see min_separation) at which each node was last visited
+    std::vector<std::uint64_t> visited_step_;
+    std::uint64_t step_ = 0;
+
+    std::int64_t current_ = -1;  ///< index of the node the robot is at
+    std::vector<TrajectoryPoint> trajectory_;
+    std::size_t trajectory_head_ = 0;
+    std::size_t trajectory_size_ = 0;
+};
+
+/**
+* @brief Append-only persistence of a TopologicalMemory
+*/
+class MemoryJournal
+{
+public:
+    /**
+     * @brief Replay @p path into @p memory, if it exists, and open it for appending
+     *
+     * A torn record at the end, e.g. from a crash mid-flush, is cut off.
+     *
+     * @throws std::runtime_error if the file is not a memory journal or
+     *         cannot be opened
+     */
+    MemoryJournal(const std::string& path, TopologicalMemory& memory);
+    ~MemoryJournal();
+
+    MemoryJournal(const MemoryJournal&) = delete;
+    MemoryJournal& operator=(const MemoryJournal&) = delete;
+
+    /**
+     * @brief Write the nodes and closures added since the last append and flush them
+     *
+     * A batch is written whole or not at all: on a write error the file is
+     * cut back to the end of the previous batch and the next append retries
+     * it. If the cut or reopening fails, every later append throws.
+     *
+     * @return Records written
+     * @throws std::runtime_error on a write error
+     */
+    std::size_t append(const TopologicalMemory& memory);
+
+    /// Records replayed when the journal was opened
+    std::size_t restored() const { return restored_; }
+
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+    std::FILE* file_ = nullptr;
+    std::size_t written_nodes_ = 0;
+    std::size_t written_closures_ = 0;
+    std::size_t restored_ = 0;
+    bool failed_ = false;  ///< a failed batch could not be cut off the file
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__TOPOLOGICAL_MEMORY_HPP_
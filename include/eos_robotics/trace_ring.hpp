@@ -0,0 +1,196 @@
+/**
+* @file trace_ring.hpp
+* @brief Per-thread lock-free trace rings, dumped as Chrome/Perfetto trace JSON
+*
+* Every thread that records gets its own fixed-size ring of TraceEvents on
+* its first event; recording is a clock read and four 8-byte stores into
+* that ring, with no lock, no allocation and no system call. The rings are
+* never freed, so events of threads that have exited are still in the dump.
+* Old events are overwritten once a ring is full: the dump shows the last
+* trace.buffer_events events of every thread, which is the window a
+* post-mortem of a stutter needs.
+*
+* write_chrome_trace() may run on any thread while the others keep
+* recording; it drops the few events that could have been overwritten while
+* it copied them. The output loads in chrome://tracing and ui.perfetto.dev.
+*/
+
+#ifndef EOS_ROBOTICS__TRACE_RING_HPP_
+#define EOS_ROBOTICS__TRACE_RING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace eos
+{
+namespace trace
+{
+
+/**
+* @brief One recorded span or instant
+*/
+struct TraceEvent
+{
+    std::int64_t start_ns = 0;     ///< steady clock
+    std::int64_t duration_ns = -1; ///< negative for an instant
+    const char* name = nullptr;    ///< string literal; only the pointer is stored
+    std::uint64_t arg = 0;         ///< e.g. the stamp of the scan being processed
+};
+
+static_assert(sizeof(TraceEvent) == 32, "TraceEvent must stay 32 bytes");
+
+/**
+* @brief Single-writer ring of the most recent events of one thread
+*/
+class ThreadRing
+{
+public:
+    /**
+     * @param capacity Rounded up to a power of two, at least 16
+     * @param tid Kernel thread id, used as the trace's tid
+     * @param thread_name Shown as the track name
+     */
+    ThreadRing(std::size_t capacity, std::int64_t tid, std::string thread_name);
+
+    ThreadRing(const ThreadRing&) = delete;
+    ThreadRing& operator=(const ThreadRing&) = delete;
+
+    /**
+     * @brief Owner thread only
+     *
+     * The standard seqlock writer ordering: the release fence keeps the
+     * relaxed slot stores from becoming visible before the previous head
+     * increment, so a snapshot() that reads a rewritten slot also re-reads
+     * the head that marks it torn, on aarch64 as well as x86.
+     */
+    void push(const TraceEvent& event)
+    {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Slot& slot = slots_[head & mask_];
+        slot.start_ns.store(event.start_ns, std::memory_order_relaxed);
+        slot.duration_ns.store(event.duration_ns, std::memory_order_relaxed);
+        slot.name.store(event.name, std::memory_order_relaxed);
+        slot.arg.store(event.arg, std::memory_order_relaxed);
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Append the events still in the ring, oldest first; any thread
+     *
+     * The oldest slot of a full ring is left out, since the owner may be
+     * overwriting it, as is anything it laps during the copy.
+     *
+     * @return Number of events appended
+     */
+    std::size_t snapshot(std::vector<TraceEvent>& out) const;
+
+    std::size_t capacity() const { return mask_ + 1; }
+    std::uint64_t recorded() const { return head_.load(std::memory_order_acquire); }
+    std::int64_t tid() const { return tid_; }
+    const std::string& thread_name() const { return thread_name_; }
+
+private:
+    // Relaxed atomics cost plain stores and make concurrent snapshots well-defined
+    struct Slot
+    {
+        std::atomic<std::int64_t> start_ns{0};
+        std::atomic<std::int64_t> duration_ns{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::uint64_t> arg{0};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t mask_;
+    std::int64_t tid_;
+    std::string thread_name_;
+    std::atomic<std::uint64_t> head_{0};
+};
+
+/// Steady clock in nanoseconds, the time base of every event
+std::int64_t now_ns();
+
+/// Recording on or off for every thread (trace.enabled); on by default
+void set_enabled(bool enabled);
+bool enabled();
+
+/**
+* @brief Ring size of threads that record their first event from now on
+* (trace.buffer_events); existing rings keep theirs
+*/
+void set_buffer_events(std::size_t events);
+
+/**
+* @brief Record a span that started at @p start_ns and lasted @p duration_ns
+*
+* The first event of a thread allocates its ring; afterwards recording
+* never allocates.
+*/
+void complete(const char* name, std::int64_t start_ns, std::int64_t duration_ns,
+              std::uint64_t arg = 0);
+
+/**
+* @brief Record a point in time, e.g. a pipeline stage finishing
+*/
+void instant(const char* name, std::uint64_t arg = 0);
+
+/**
+* @brief Record the lifetime of the scope as a span
+*/
+class Scope
+{
+public:
+    explicit Scope(const char* name, std::uint64_t arg = 0)
+        : name_(name), arg_(arg), start_ns_(now_ns())
+    {
+    }
+
+    ~Scope() { complete(name_, start_ns_, now_ns() - start_ns_, arg_); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* name_;
+    std::uint64_t arg_;
+    std::int64_t start_ns_;
+};
+
+/**
+* @brief Write every thread's ring as Chrome trace event JSON
+*
+* Spans become "X" events and instants "i" events, timestamps in
+* microseconds; each thread is a track named after it.
+*
+* @return Number of events written
+*/
+std::size_t write_chrome_trace(std::ostream& out);
+
+/**
+* @brief Write the trace to @p path
+*
+* @return Number of events written
+* @throws std::runtime_error if the file cannot be written
+*/
+std::size_t write_chrome_trace(const std::string& path);
+
+/**
+* @brief Signal handler that only flags a dump; install for e.g. SIGUSR1
+*
+* Formatting JSON is not async-signal-safe, so the dump itself is done by
+* whoever polls take_dump_request().
+*/
+void request_dump_from_signal(int signal);
+
+/// True once per request_dump_from_signal() since the last call
+bool take_dump_request();
+
+}  // namespace trace
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__TRACE_RING_HPP_
@@ -0,0 +1,92 @@
+/**
+* @file triple_buffer.hpp
+* @brief Wait-free single-producer / single-consumer triple buffer
+*/
+
+#ifndef EOS_ROBOTICS__TRIPLE_BUFFER_HPP_
+#define EOS_ROBOTICS__TRIPLE_BUFFER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace eos
+{
+
+/**
+* @brief Latest-value channel between one writer and one reader
+*
+* The writer fills write_buffer() in place and calls publish(); the reader
+* calls update() and then reads read_buffer(), which stays valid and
+* untouched until its next update(). Neither side ever blocks or waits for
+* the other: the only shared state is one atomic byte holding the index of
+* the middle slot plus a "fresh" flag.
+*/
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Apply @p init to all three slots, e.g. to preallocate storage
+     *
+     * Only valid before the buffer is shared between threads.
+     */
+    template <typename Init>
+    void initialize(const Init& init)
+    {
+        for (auto& slot : slots_) {
+            init(slot.value);
+        }
+    }
+
+    /// Writer: slot owned exclusively by the writer until publish()
+    T& write_buffer() { return slots_[back_].value; }
+
+    /// Writer: make the contents of write_buffer() the latest value
+    void publish()
+    {
+        const std::uint8_t previous =
+            state_.exchange(static_cast<std::uint8_t>(back_ | kFresh), std::memory_order_acq_rel);
+        back_ = previous & kIndexMask;
+    }
+
+    /**
+     * @brief Reader: adopt the latest published value if there is one
+     *
+     * @return true if read_buffer() changed
+     */
+    bool update()
+    {
+        if ((state_.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return false;
+        }
+        const std::uint8_t previous = state_.exchange(front_, std::memory_order_acq_rel);
+        front_ = previous & kIndexMask;
+        return true;
+    }
+
+    /// Reader: slot owned exclusively by the reader until update()
+    const T& read_buffer() const { return slots_[front_].value; }
+
+private:
+    static constexpr std::uint8_t kIndexMask = 0x3;
+    static constexpr std::uint8_t kFresh = 0x4;
+
+    struct alignas(64) Slot
+    {
+        T value{};
+    };
+
+    std::array<Slot, 3> slots_;
+    alignas(64) std::atomic<std::uint8_t> state_{1};  ///< middle slot index | kFresh
+    alignas(64) std::uint8_t back_ = 2;               ///< writer-owned
+    alignas(64) std::uint8_t front_ = 0;              ///< reader-owned
+};
+
+}  // namespace eos
+
+#endif  // EOS_ROBOTICS__TRIPLE_BUFFER_HPP_
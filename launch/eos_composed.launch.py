@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Eos Robotics OS Composed Launch File
+
+Loads the eos::EosRosNode component into one multi-threaded container,
+optionally next to the LiDAR and IMU driver components, so scans and IMU
+samples reach Eos over intra-process communication instead of the DDS
+loopback.
+"""
+
+from launch import LaunchDescription
+from launch.actions import DeclareLaunchArgument, OpaqueFunction
+from launch.substitutions import LaunchConfiguration, PathJoinSubstitution
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+from launch_ros.substitutions import FindPackageShare
+
+# Every component in the container shares the intra-process manager
+INTRA_PROCESS = [{'use_intra_process_comms': True}]
+
+
+def driver_component(context, prefix):
+    """
+    Build the driver component named by the <prefix>_package and
+    <prefix>_plugin launch arguments, or None when no plugin is given.
+    """
+    plugin = LaunchConfiguration(prefix + '_plugin').perform(context)
+    if not plugin:
+        return None
+    params_file = LaunchConfiguration(prefix + '_params').perform(context)
+    return ComposableNode(
+        package=LaunchConfiguration(prefix + '_package').perform(context),
+        plugin=plugin,
+        name=prefix + '_driver',
+        parameters=[params_file] if params_file else [],
+        extra_arguments=INTRA_PROCESS,
+    )
+
+
+def launch_container(context):
+    """
+    Assemble the container with Eos and whichever drivers were requested.
+    """
+    eos_pkg_share = FindPackageShare('eos_robotics').find('eos_robotics')
+    use_sim_time = LaunchConfiguration('use_sim_time').perform(context) == 'true'
+    params_file = LaunchConfiguration('params_file').perform(context)
+
+    eos_node = ComposableNode(
+        package='eos_robotics',
+        plugin='eos::EosRosNode',
+        name='eos_ros_node',
+        parameters=[params_file or eos_pkg_share + '/config/params.yaml', {
+            'use_sim_time': use_sim_time,
+            'neural.model_path': PathJoinSubstitution([
+                eos_pkg_share, 'models', 'default_snn.eosm'
+            ])
+        }],
+        extra_arguments=INTRA_PROCESS,
+    )
+
+    drivers = [driver_component(context, prefix) for prefix in ('lidar', 'imu')]
+
+    # The container's executor runs every component; Eos's executor.*
+    # parameters only apply to the standalone eos_ros_node executable
+    container = ComposableNodeContainer(
+        name=LaunchConfiguration('container_name'),
+        namespace='',
+        package='rclcpp_components',
+        executable='component_container_mt',
+        composable_node_descriptions=[d for d in drivers if d] + [eos_node],
+        output='screen',
+    )
+    return [container]
+
+
+def generate_launch_description():
+    """
+    Generate launch description for the composed Eos container.
+
+    Returns:
+        LaunchDescription: Complete launch configuration
+    """
+    arguments = [
+        DeclareLaunchArgument(
+            'use_sim_time',
+            default_value='false',
+            description='Use simulation clock if true'
+        ),
+        DeclareLaunchArgument(
+            'params_file',
+            default_value='',
+            description='Parameter file for Eos; empty for the packaged config/params.yaml'
+        ),
+        DeclareLaunchArgument(
+            'container_name',
+            default_value='eos_container',
+            description='Name of the component container'
+        ),
+    ]
+    for prefix, sensor in (('lidar', 'LiDAR'), ('imu', 'IMU')):
+        arguments += [
+            DeclareLaunchArgument(
+                prefix + '_package',
+                default_value='',
+                description='Package providing the ' + sensor + ' driver component'
+            ),
+            DeclareLaunchArgument(
+                prefix + '_plugin',
+                default_value='',
+                description=sensor + ' driver component class; empty to run without it'
+            ),
+            DeclareLaunchArgument(
+                prefix + '_params',
+                default_value='',
+                description='Parameter file for the ' + sensor + ' driver'
+            ),
+        ]
+
+    return LaunchDescription(arguments + [OpaqueFunction(function=launch_container)])
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Eos Robotics OS Fleet Launch File
+
+Hosts one eos::EosRosNode per robot, each in its own namespace
+(/robot_0 ... /robot_<n-1>), in a single multi-threaded component
+container. The robots share the process's DDS participant, its thread pool
+and the read-only model weights; each keeps its own membrane state, memory
+journal and topics (/robot_<i>/scan, /robot_<i>/cmd_vel, ...).
+"""
+
+from launch import LaunchDescription
+from launch.actions import DeclareLaunchArgument, OpaqueFunction
+from launch.substitutions import LaunchConfiguration
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+from launch_ros.substitutions import FindPackageShare
+
+# Every component in the container shares the intra-process manager
+INTRA_PROCESS = [{'use_intra_process_comms': True}]
+
+
+def robot_component(context, index, eos_pkg_share):
+    """
+    Build the Eos component of robot @p index in its namespace.
+    """
+    prefix = LaunchConfiguration('namespace_prefix').perform(context)
+    namespace = prefix + str(index)
+    model_path = LaunchConfiguration('model_path').perform(context)
+    params_file = LaunchConfiguration('params_file').perform(context)
+    return ComposableNode(
+        package='eos_robotics',
+        plugin='eos::EosRosNode',
+        name='eos_ros_node',
+        namespace=namespace,
+        # The file's /** section applies in every robot's namespace; the
+        # per-robot entries after it take precedence
+        parameters=[params_file or eos_pkg_share + '/config/params.yaml', {
+            'use_sim_time': LaunchConfiguration('use_sim_time').perform(context) == 'true',
+            # One path for all robots: the weights are mapped once and shared
+            'neural.model_path': model_path or eos_pkg_share + '/models/default_snn.eosm',
+            'memory.journal_path': 'eos_memory_' + namespace + '.journal',
+            'debug.profile_output_file': 'eos_performance_' + namespace + '.log',
+            'trace.dump_path': 'eos_trace_' + namespace + '.json',
+        }],
+        extra_arguments=INTRA_PROCESS,
+    )
+
+
+def launch_container(context):
+    """
+    Assemble the container with one Eos component per robot.
+    """
+    eos_pkg_share = FindPackageShare('eos_robotics').find('eos_robotics')
+    robots = int(LaunchConfiguration('robots').perform(context))
+    if robots < 1:
+        raise ValueError('robots must be at least 1')
+
+    # The container's executor threads take ready callbacks from every
+    # robot, so the pool is sized for the fleet, not per robot
+    threads = int(LaunchConfiguration('threads').perform(context))
+    container = ComposableNodeContainer(
+        name=LaunchConfiguration('container_name'),
+        namespace='',
+        package='rclcpp_components',
+        executable='component_container_mt',
+        parameters=[{'thread_num': threads}] if threads > 0 else [],
+        composable_node_descriptions=[
+            robot_component(context, i, eos_pkg_share) for i in range(robots)
+        ],
+        output='screen',
+    )
+    return [container]
+
+
+def generate_launch_description():
+    """
+    Generate launch description for the Eos fleet container.
+
+    Returns:
+        LaunchDescription: Complete launch configuration
+    """
+    arguments = [
+        DeclareLaunchArgument(
+            'robots',
+            default_value='4',
+            description='Number of robots hosted in the process'
+        ),
+        DeclareLaunchArgument(
+            'namespace_prefix',
+            default_value='robot_',
+            description='Robot i runs in namespace <prefix><i>'
+        ),
+        DeclareLaunchArgument(
+            'threads',
+            default_value='0',
+            description='Executor threads shared by all robots; 0 for one per core'
+        ),
+        DeclareLaunchArgument(
+            'model_path',
+            default_value='',
+            description='.eosm model shared by every robot; empty for the packaged default'
+        ),
+        DeclareLaunchArgument(
+            'params_file',
+            default_value='',
+            description='Parameter file of every robot; empty for the packaged config/params.yaml'
+        ),
+        DeclareLaunchArgument(
+            'use_sim_time',
+            default_value='true',
+            description='Use simulation clock if true'
+        ),
+        DeclareLaunchArgument(
+            'container_name',
+            default_value='eos_fleet',
+            description='Name of the component container'
+        ),
+    ]
+
+    return LaunchDescription(arguments + [OpaqueFunction(function=launch_container)])
@@ -40,6 +40,7 @@ def generate_launch_description():
     robot_model = LaunchConfiguration('robot_model', default='waffle_pi')
     enable_rviz = LaunchConfiguration('enable_rviz', default='true')
     enable_neural = LaunchConfiguration('enable_neural', default='true')
+    params_file = LaunchConfiguration('params_file')
     
     # =========================================================================
     # Launch Arguments
@@ -75,6 +76,12 @@ def generate_launch_description():
         description='Enable Eos neural network processing'
     )
     
+    declare_params_file = DeclareLaunchArgument(
+        'params_file',
+        default_value=os.path.join(eos_pkg_share, 'config', 'params.yaml'),
+        description='Parameter file for the Eos node'
+    )
+    
     # =========================================================================
     # Gazebo Simulation
     # =========================================================================
@@ -112,14 +119,14 @@ def generate_launch_description():
         executable='eos_ros_node',
         name='eos_ros_node',
         output='screen',
-        parameters=[{
+        parameters=[params_file, {
             'use_sim_time': use_sim_time,
-            'neural_update_rate': 10.0,
-            'navigation_update_rate': 15.0,
-            'safety_distance': 0.5,
-            'max_velocity': 0.5,
-            'neural_model_path': PathJoinSubstitution([
-                eos_pkg_share, 'models', 'default_snn.json'
+            'neural.update_rate': 10.0,
+            'navigation.planning_rate': 15.0,
+            'navigation.safety_distance': 0.5,
+            'navigation.max_linear_velocity': 0.5,
+            'neural.model_path': PathJoinSubstitution([
+                eos_pkg_share, 'models', 'default_snn.eosm'
             ])
         }],
         condition=IfCondition(enable_neural),
@@ -253,6 +260,7 @@ def generate_launch_description():
         declare_robot_model,
         declare_enable_rviz,
         declare_enable_neural,
+        declare_params_file,
         
         # Simulation
         gazebo_launch,
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Convert JSON neural models to the memory-mapped .eosm format
+
+Accepts either the JSON written by the Rust SNNEngine::save_model
+(``weights[input][output]``, a single input -> output layer) or a layered
+form ``{"layers": [{"weights": [[...inputs] x neurons]}, ...]}`` with one
+row per postsynaptic neuron. The output matches include/eos_robotics/lif_model.hpp:
+a 64-byte header, a 32-byte record per layer and 64-byte aligned,
+zero-padded row-major weight blobs.
+
+Usage:
+    convert_model.py models/default_snn.json models/default_snn.eosm
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+from array import array
+from typing import List
+
+MAGIC = b'EOSSNN\0\0'
+FORMAT_VERSION = 1
+HEADER_SIZE = 64
+LAYER_RECORD_SIZE = 32
+BLOB_ALIGNMENT = 64
+ROW_FLOATS = 16
+
+
+def round_up(value: int, multiple: int) -> int:
+    """Round value up to the next multiple."""
+    return (value + multiple - 1) // multiple * multiple
+
+
+def load_layers(model: dict) -> List[List[List[float]]]:
+    """Return the weight matrices as [layer][neuron][input]."""
+    if 'layers' in model:
+        layers = [layer['weights'] for layer in model['layers']]
+    elif 'weights' in model:
+        # Rust NeuralModel: weights[j][i] connects input j to output i
+        weights = model['weights']
+        layers = [[list(column) for column in zip(*weights)]]
+    else:
+        raise ValueError("model has neither 'layers' nor 'weights'")
+
+    for index, matrix in enumerate(layers):
+        if not matrix or not matrix[0]:
+            raise ValueError(f'layer {index} is empty')
+        width = len(matrix[0])
+        if any(len(row) != width for row in matrix):
+            raise ValueError(f'layer {index} has rows of different lengths')
+        if index > 0 and width != len(layers[index - 1]):
+            raise ValueError(f'layer {index} inputs do not match the previous layer')
+    return layers
+
+
+def write_eosm(layers: List[List[List[float]]], path: str) -> int:
+    """Write the layers in .eosm format and return the file size."""
+    offset = round_up(HEADER_SIZE + LAYER_RECORD_SIZE * len(layers), BLOB_ALIGNMENT)
+    records = []
+    for matrix in layers:
+        inputs, neurons = len(matrix[0]), len(matrix)
+        stride = round_up(inputs, ROW_FLOATS)
+        weight_bytes = neurons * stride * 4
+        records.append((inputs, neurons, stride, offset, weight_bytes))
+        offset = round_up(offset + weight_bytes, BLOB_ALIGNMENT)
+    file_size = offset
+
+    # Running nodes map the model MAP_SHARED: write a new file and rename it
+    # over the old one instead of rewriting the mapped file in place
+    temp_path = path + '.tmp'
+    with open(temp_path, 'wb') as out:
+        out.write(struct.pack('<8sIIIIQQ24x', MAGIC, FORMAT_VERSION, HEADER_SIZE,
+                              len(layers), 0, file_size, HEADER_SIZE))
+        for inputs, neurons, stride, weight_offset, weight_bytes in records:
+            out.write(struct.pack('<IIIIQQ', inputs, neurons, stride, 0,
+                                  weight_offset, weight_bytes))
+
+        for matrix, (inputs, _, stride, weight_offset, _) in zip(layers, records):
+            out.write(b'\0' * (weight_offset - out.tell()))
+            blob = array('f')
+            for row in matrix:
+                blob.extend(float(w) for w in row)
+                blob.extend([0.0] * (stride - inputs))
+            if sys.byteorder != 'little':
+                blob.byteswap()
+            out.write(blob.tobytes())
+        out.write(b'\0' * (file_size - out.tell()))
+        out.flush()
+        os.fsync(out.fileno())
+    os.replace(temp_path, path)
+    return file_size
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument('input', help='JSON model')
+    parser.add_argument('output', help='.eosm file to write')
+    args = parser.parse_args()
+
+    with open(args.input, 'r') as f:
+        model = json.load(f)
+    try:
+        layers = load_layers(model)
+    except (KeyError, TypeError, ValueError) as e:
+        print(f'{args.input}: {e}', file=sys.stderr)
+        return 1
+
+    size = write_eosm(layers, args.output)
+    topology = ' -> '.join([str(len(layers[0][0]))] + [str(len(m)) for m in layers])
+    print(f'Wrote {args.output}: {topology}, {size} bytes')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
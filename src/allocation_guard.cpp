@@ -0,0 +1,129 @@
+/**
+* @file allocation_guard.cpp
+* @brief Heap allocation counting for the allocation-free hot path
+*/
+
+#include "eos_robotics/allocation_guard.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+thread_local std::uint64_t thread_allocations = 0;
+std::atomic<std::uint64_t> total_allocations{0};
+
+}  // namespace
+
+namespace eos
+{
+
+bool allocation_hooks_enabled()
+{
+#if defined(EOS_ALLOCATION_HOOKS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint64_t thread_allocation_count()
+{
+    return thread_allocations;
+}
+
+std::uint64_t total_allocation_count()
+{
+    return total_allocations.load(std::memory_order_relaxed);
+}
+
+AllocationGuard::AllocationGuard(const char* scope)
+    : scope_(scope),
+      start_(thread_allocations)
+{
+}
+
+AllocationGuard::~AllocationGuard()
+{
+    const std::uint64_t allocations = thread_allocations - start_;
+    if (allocation_hooks_enabled() && allocations != 0) {
+        std::fprintf(stderr, "[eos] %llu heap allocation(s) inside allocation-free scope '%s'\n",
+                     static_cast<unsigned long long>(allocations), scope_);
+        std::abort();
+    }
+}
+
+}  // namespace eos
+
+#if defined(EOS_ALLOCATION_HOOKS)
+
+namespace
+{
+
+void* counted_allocate(std::size_t size)
+{
+    ++thread_allocations;
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size != 0 ? size : 1);
+}
+
+void* counted_allocate_aligned(std::size_t size, std::align_val_t alignment)
+{
+    ++thread_allocations;
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    const std::size_t rounded = (size + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded != 0 ? rounded : align);
+}
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = counted_allocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* ptr = counted_allocate_aligned(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+#endif  // EOS_ALLOCATION_HOOKS
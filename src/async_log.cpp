@@ -0,0 +1,283 @@
+/**
+* @file async_log.cpp
+* @brief Throttled, sampled logging for hot callbacks, formatted on a background thread
+*/
+
+#include "eos_robotics/async_log.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace eos
+{
+
+namespace
+{
+
+// Idle poll of the logger thread; producers never wake it, so logging
+// costs no system call on the hot path
+constexpr std::chrono::milliseconds kPollInterval{10};
+
+bool is_conversion(char c)
+{
+    return std::strchr("diouxXeEfFgGaAcsp", c) != nullptr;
+}
+
+bool is_length_modifier(char c)
+{
+    return std::strchr("hljztL", c) != nullptr;
+}
+
+// Print one argument with the flags, width and precision of @p spec
+// ("%-8.2", no length modifier or conversion) and the conversion @p conversion
+void append_arg(std::string& out, const std::string& spec, char conversion, const LogArg& arg)
+{
+    char buffer[128];
+    std::string full = spec;
+    int written = 0;
+    switch (arg.type) {
+        case LogArg::Type::Int:
+            if (std::strchr("eEfFgGaA", conversion)) {
+                full += conversion;
+                written = std::snprintf(buffer, sizeof(buffer), full.c_str(),
+                                        static_cast<double>(arg.i));
+            } else if (conversion == 'c') {
+                full += 'c';
+                written = std::snprintf(buffer, sizeof(buffer), full.c_str(), static_cast<int>(arg.i));
+            } else {
+                full += std::strchr("ouxX", conversion) ? std::string("ll") + conversion : "lld";
+                written = std::snprintf(buffer, sizeof(buffer), full.c_str(), arg.i);
+            }
+            break;
+        case LogArg::Type::Uint:
+            if (std::strchr("eEfFgGaA", conversion)) {
+                full += conversion;
+                written = std::snprintf(buffer, sizeof(buffer), full.c_str(),
+                                        static_cast<double>(arg.u));
+            } else {
+                full += std::strchr("ouxX", conversion) ? std::string("ll") + conversion : "llu";
+                written = std::snprintf(buffer, sizeof(buffer), full.c_str(), arg.u);
+            }
+            break;
+        case LogArg::Type::Double:
+            full += std::strchr("eEfFgGaA", conversion) ? conversion : 'g';
+            written = std::snprintf(buffer, sizeof(buffer), full.c_str(), arg.d);
+            break;
+        case LogArg::Type::String:
+            full += 's';
+            written = std::snprintf(buffer, sizeof(buffer), full.c_str(), arg.s ? arg.s : "(null)");
+            break;
+    }
+    if (written > 0) {
+        out.append(buffer, std::min<std::size_t>(static_cast<std::size_t>(written), sizeof(buffer) - 1));
+    }
+}
+
+}  // namespace
+
+const char* to_string(LogSubsystem subsystem)
+{
+    switch (subsystem) {
+        case LogSubsystem::Perception: return "perception";
+        case LogSubsystem::Neural: return "neural";
+        case LogSubsystem::Navigation: return "navigation";
+        case LogSubsystem::Count: break;
+    }
+    return "unknown";
+}
+
+LogLevel parse_log_level(const std::string& name)
+{
+    if (name == "debug") {
+        return LogLevel::Debug;
+    }
+    if (name == "info") {
+        return LogLevel::Info;
+    }
+    if (name == "warn") {
+        return LogLevel::Warn;
+    }
+    if (name == "error") {
+        return LogLevel::Error;
+    }
+    if (name == "off") {
+        return LogLevel::Off;
+    }
+    throw std::invalid_argument("Unknown log level '" + name +
+                                "' (expected debug, info, warn, error or off)");
+}
+
+std::string format_record(const LogRecord& record)
+{
+    std::string out;
+    std::size_t next_arg = 0;
+    for (const char* p = record.format ? record.format : ""; *p; ++p) {
+        if (*p != '%') {
+            out += *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            out += '%';
+            ++p;
+            continue;
+        }
+        // Flags, width and precision are kept; the length modifier is not
+        std::string spec = "%";
+        const char* q = p + 1;
+        while (*q && std::strchr("-+ #0123456789.", *q)) {
+            spec += *q++;
+        }
+        while (*q && is_length_modifier(*q)) {
+            ++q;
+        }
+        if (!is_conversion(*q)) {
+            out.append(p, q);
+            p = *q ? q : q - 1;
+            continue;
+        }
+        if (next_arg < record.arg_count) {
+            append_arg(out, spec, *q, record.args[next_arg++]);
+        } else {
+            out += '?';
+        }
+        p = q;
+    }
+    if (record.suppressed > 0) {
+        out += " [" + std::to_string(record.suppressed) + " suppressed]";
+    }
+    return out;
+}
+
+bool LogSiteState::admit(std::int64_t now_ns, std::int64_t throttle_ns, std::uint32_t sample_every,
+                         std::uint64_t& suppressed)
+{
+    const std::uint64_t call = calls.fetch_add(1, std::memory_order_relaxed);
+    if (call % sample_every != 0) {
+        skipped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (throttle_ns > 0) {
+        std::int64_t last = last_ns.load(std::memory_order_relaxed);
+        if (last != 0 && now_ns - last < throttle_ns) {
+            skipped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        // Another thread passing at the same moment wins; this call is skipped
+        if (!last_ns.compare_exchange_strong(last, now_ns, std::memory_order_relaxed)) {
+            skipped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    suppressed = skipped.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
+std::size_t AsyncLog::register_site()
+{
+    static std::atomic<std::size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+AsyncLog::AsyncLog(std::size_t capacity, Sink sink)
+    : sink_(std::move(sink))
+{
+    std::size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    cells_ = std::make_unique<Cell[]>(rounded);
+    mask_ = rounded - 1;
+    for (std::size_t i = 0; i < rounded; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    for (auto& level : levels_) {
+        level.store(LogLevel::Info, std::memory_order_relaxed);
+    }
+    worker_ = std::thread([this] { run(); });
+}
+
+AsyncLog::~AsyncLog()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+std::int64_t AsyncLog::now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool AsyncLog::push(const LogRecord& record)
+{
+    std::uint64_t position = enqueue_.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells_[position & mask_];
+        const std::uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<std::int64_t>(sequence - position);
+        if (lag == 0) {
+            if (enqueue_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.record = record;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (lag < 0) {
+            // The consumer has not freed this cell yet: the queue is full
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = enqueue_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLog::pop(LogRecord& record)
+{
+    Cell& cell = cells_[dequeue_ & mask_];
+    if (cell.sequence.load(std::memory_order_acquire) != dequeue_ + 1) {
+        return false;
+    }
+    record = cell.record;
+    cell.sequence.store(dequeue_ + mask_ + 1, std::memory_order_release);
+    ++dequeue_;
+    return true;
+}
+
+void AsyncLog::flush()
+{
+    const std::uint64_t target = enqueue_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.notify_one();
+    drained_.wait(lock, [&] { return delivered_.load(std::memory_order_acquire) >= target; });
+}
+
+void AsyncLog::run()
+{
+    LogRecord record;
+    for (;;) {
+        while (pop(record)) {
+            sink_(record.level, record.subsystem, format_record(record));
+            delivered_.fetch_add(1, std::memory_order_release);
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        drained_.notify_all();
+        if (stopping_) {
+            // Producers are gone; anything they queued last is still delivered
+            lock.unlock();
+            while (pop(record)) {
+                sink_(record.level, record.subsystem, format_record(record));
+            }
+            return;
+        }
+        wake_.wait_for(lock, kPollInterval);
+    }
+}
+
+}  // namespace eos
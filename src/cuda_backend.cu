@@ -0,0 +1,342 @@
+/**
+* @file cuda_backend.cu
+* @brief CUDA implementation of NeuralBackend, built with EOS_ENABLE_CUDA
+*/
+
+#include "eos_robotics/cuda_backend.hpp"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eos
+{
+
+namespace
+{
+
+constexpr int kWarpSize = 32;
+constexpr int kBlockThreads = 256;
+
+void check(cudaError_t status, const char* what)
+{
+    if (status != cudaSuccess) {
+        throw std::runtime_error(std::string("CUDA backend: ") + what + ": " +
+                                 cudaGetErrorString(status));
+    }
+}
+
+int blocks_for(std::size_t threads)
+{
+    return static_cast<int>((threads + kBlockThreads - 1) / kBlockThreads);
+}
+
+/// y = W x with one warp per row; rows are padded to @p stride
+__global__ void matvec_kernel(const float* weights, int rows, int stride,
+                              const float* x, float* y)
+{
+    const int row = (blockIdx.x * blockDim.x + threadIdx.x) / kWarpSize;
+    const int lane = threadIdx.x % kWarpSize;
+    if (row >= rows) {
+        return;
+    }
+    const float* w = weights + static_cast<std::size_t>(row) * stride;
+    float acc = 0.0f;
+    for (int i = lane; i < stride; i += kWarpSize) {
+        acc = fmaf(w[i], x[i], acc);
+    }
+    for (int offset = kWarpSize / 2; offset > 0; offset /= 2) {
+        acc += __shfl_down_sync(0xffffffffu, acc, offset);
+    }
+    if (lane == 0) {
+        y[row] = acc;
+    }
+}
+
+/// Same update as kernels::lif_step
+__global__ void lif_step_kernel(float* membrane, const float* current, float* spikes,
+                                int count, float decay, float threshold)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count) {
+        return;
+    }
+    const float v = membrane[i] * decay + current[i];
+    const bool spike = v >= threshold;
+    spikes[i] = spike ? 1.0f : 0.0f;
+    membrane[i] = spike ? 0.0f : v;
+}
+
+__global__ void accumulate_kernel(float* acc, const float* x, int count)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < count) {
+        acc[i] += x[i];
+    }
+}
+
+__global__ void scale_kernel(const float* x, float* y, int count, float factor)
+{
+    const int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < count) {
+        y[i] = x[i] * factor;
+    }
+}
+
+/// cudaMalloc'd array, freed on destruction
+template <typename T>
+class DeviceBuffer
+{
+public:
+    DeviceBuffer() = default;
+    explicit DeviceBuffer(std::size_t count) : count_(count)
+    {
+        void* raw = nullptr;
+        check(cudaMalloc(&raw, count * sizeof(T)), "cudaMalloc");
+        data_ = static_cast<T*>(raw);
+    }
+    ~DeviceBuffer() { cudaFree(data_); }
+    DeviceBuffer(DeviceBuffer&& other) noexcept : data_(other.data_), count_(other.count_)
+    {
+        other.data_ = nullptr;
+    }
+    DeviceBuffer& operator=(DeviceBuffer&& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(count_, other.count_);
+        return *this;
+    }
+    DeviceBuffer(const DeviceBuffer&) = delete;
+    DeviceBuffer& operator=(const DeviceBuffer&) = delete;
+
+    T* data() const { return data_; }
+    std::size_t bytes() const { return count_ * sizeof(T); }
+
+private:
+    T* data_ = nullptr;
+    std::size_t count_ = 0;
+};
+
+/// cudaHostAlloc'd (page-locked) array, so async copies need no staging
+class PinnedBuffer
+{
+public:
+    PinnedBuffer() = default;
+    explicit PinnedBuffer(std::size_t count)
+    {
+        void* raw = nullptr;
+        check(cudaHostAlloc(&raw, count * sizeof(float), cudaHostAllocDefault), "cudaHostAlloc");
+        data_ = static_cast<float*>(raw);
+    }
+    ~PinnedBuffer() { cudaFreeHost(data_); }
+    PinnedBuffer& operator=(PinnedBuffer&& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        return *this;
+    }
+    PinnedBuffer(const PinnedBuffer&) = delete;
+
+    float* data() const { return data_; }
+
+private:
+    float* data_ = nullptr;
+};
+
+class CudaBackend : public NeuralBackend
+{
+public:
+    CudaBackend(std::shared_ptr<const LifModel> model, const LifConfig& config);
+    ~CudaBackend() override;
+
+    void run(const float* inputs, float* outputs) override;
+
+    std::size_t input_size() const override { return model_->input_size(); }
+    std::size_t output_size() const override { return model_->output_size(); }
+    const std::shared_ptr<const LifModel>& model() const override { return model_; }
+    BackendType type() const override { return BackendType::Cuda; }
+
+private:
+    struct Layer
+    {
+        int neurons;
+        int stride;
+        float* weights;       ///< in weights_
+        float* membrane;      ///< in state_
+        float* spikes;        ///< in state_, zero-padded to the next layer's stride
+    };
+
+    /// Record one complete inference on stream_ into graph_exec_
+    void capture();
+
+    LifConfig config_;
+    std::shared_ptr<const LifModel> model_;
+    std::vector<Layer> layers_;
+
+    cudaStream_t stream_ = nullptr;
+    cudaGraphExec_t graph_exec_ = nullptr;
+
+    DeviceBuffer<float> weights_;
+    DeviceBuffer<float> state_;        ///< membranes then spikes of every layer
+    DeviceBuffer<float> input_;        ///< padded to the first layer's stride
+    DeviceBuffer<float> drive_;
+    DeviceBuffer<float> current_;
+    DeviceBuffer<float> spike_counts_;
+    DeviceBuffer<float> rates_;
+    PinnedBuffer host_input_;
+    PinnedBuffer host_output_;
+};
+
+CudaBackend::CudaBackend(std::shared_ptr<const LifModel> model, const LifConfig& config)
+    : config_(config),
+      model_(std::move(model))
+{
+    if (!model_ || config_.time_steps == 0) {
+        throw std::invalid_argument("CUDA backend needs a model and non-zero time_steps");
+    }
+    int devices = 0;
+    if (cudaGetDeviceCount(&devices) != cudaSuccess || devices == 0) {
+        throw std::runtime_error("CUDA backend: no CUDA device available");
+    }
+
+    // Weights are uploaded once, pruned the same way LifEngine prunes its copy
+    const auto& model_layers = model_->layers();
+    std::vector<float> host_weights(model_->weight_bytes() / sizeof(float));
+    std::size_t weight_total = 0;
+    std::size_t state_total = 0;
+    std::size_t widest = 0;
+    std::vector<std::size_t> weight_offsets;
+    std::vector<std::size_t> state_offsets;
+    for (std::size_t i = 0; i < model_layers.size(); ++i) {
+        const ModelLayer& source = model_layers[i];
+        const std::size_t count = source.neurons * source.stride;
+        for (std::size_t k = 0; k < count; ++k) {
+            const float w = source.weights[k];
+            host_weights[weight_total + k] =
+                std::fabs(w) < config_.synapse_prune_threshold ? 0.0f : w;
+        }
+        weight_offsets.push_back(weight_total);
+        weight_total += count;
+
+        std::size_t slot = source.neurons;
+        if (i + 1 < model_layers.size()) {
+            slot = std::max(slot, model_layers[i + 1].stride);
+        }
+        state_offsets.push_back(state_total);
+        state_total += slot;
+        widest = std::max(widest, source.neurons);
+    }
+
+    weights_ = DeviceBuffer<float>(weight_total);
+    state_ = DeviceBuffer<float>(2 * state_total);
+    input_ = DeviceBuffer<float>(model_layers.front().stride);
+    drive_ = DeviceBuffer<float>(model_layers.front().neurons);
+    current_ = DeviceBuffer<float>(widest);
+    spike_counts_ = DeviceBuffer<float>(output_size());
+    rates_ = DeviceBuffer<float>(output_size());
+    host_input_ = PinnedBuffer(model_layers.front().stride);
+    host_output_ = PinnedBuffer(output_size());
+    std::memset(host_input_.data(), 0, model_layers.front().stride * sizeof(float));
+
+    check(cudaMemcpy(weights_.data(), host_weights.data(), weight_total * sizeof(float),
+                     cudaMemcpyHostToDevice), "upload weights");
+    // Padding of input_ and of the spike slots is never written, only read
+    check(cudaMemset(input_.data(), 0, input_.bytes()), "cudaMemset");
+
+    for (std::size_t i = 0; i < model_layers.size(); ++i) {
+        Layer layer;
+        layer.neurons = static_cast<int>(model_layers[i].neurons);
+        layer.stride = static_cast<int>(model_layers[i].stride);
+        layer.weights = weights_.data() + weight_offsets[i];
+        layer.membrane = state_.data() + state_offsets[i];
+        layer.spikes = state_.data() + state_total + state_offsets[i];
+        layers_.push_back(layer);
+    }
+
+    check(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking), "cudaStreamCreate");
+    capture();
+}
+
+CudaBackend::~CudaBackend()
+{
+    if (graph_exec_) {
+        cudaGraphExecDestroy(graph_exec_);
+    }
+    if (stream_) {
+        cudaStreamDestroy(stream_);
+    }
+}
+
+void CudaBackend::capture()
+{
+    const Layer& first = layers_.front();
+    const Layer& last = layers_.back();
+    const int outputs = static_cast<int>(output_size());
+    const int matvec_blocks_first = blocks_for(static_cast<std::size_t>(first.neurons) * kWarpSize);
+
+    check(cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal), "begin capture");
+
+    cudaMemcpyAsync(input_.data(), host_input_.data(), input_size() * sizeof(float),
+                    cudaMemcpyHostToDevice, stream_);
+    cudaMemsetAsync(state_.data(), 0, state_.bytes(), stream_);
+    cudaMemsetAsync(spike_counts_.data(), 0, spike_counts_.bytes(), stream_);
+
+    // The input is constant over the window, so its projection is computed once
+    matvec_kernel<<<matvec_blocks_first, kBlockThreads, 0, stream_>>>(
+        first.weights, first.neurons, first.stride, input_.data(), drive_.data());
+
+    for (std::size_t t = 0; t < config_.time_steps; ++t) {
+        for (std::size_t l = 0; l < layers_.size(); ++l) {
+            const Layer& layer = layers_[l];
+            const float* current = drive_.data();
+            if (l > 0) {
+                matvec_kernel<<<blocks_for(static_cast<std::size_t>(layer.neurons) * kWarpSize),
+                                kBlockThreads, 0, stream_>>>(
+                    layer.weights, layer.neurons, layer.stride, layers_[l - 1].spikes,
+                    current_.data());
+                current = current_.data();
+            }
+            lif_step_kernel<<<blocks_for(layer.neurons), kBlockThreads, 0, stream_>>>(
+                layer.membrane, current, layer.spikes, layer.neurons,
+                config_.membrane_decay, config_.spike_threshold);
+        }
+        accumulate_kernel<<<blocks_for(outputs), kBlockThreads, 0, stream_>>>(
+            spike_counts_.data(), last.spikes, outputs);
+    }
+
+    scale_kernel<<<blocks_for(outputs), kBlockThreads, 0, stream_>>>(
+        spike_counts_.data(), rates_.data(), outputs,
+        1.0f / static_cast<float>(config_.time_steps));
+    cudaMemcpyAsync(host_output_.data(), rates_.data(), output_size() * sizeof(float),
+                    cudaMemcpyDeviceToHost, stream_);
+
+    cudaGraph_t graph = nullptr;
+    check(cudaStreamEndCapture(stream_, &graph), "end capture");
+    check(cudaGetLastError(), "kernel launch during capture");
+    const cudaError_t status = cudaGraphInstantiateWithFlags(&graph_exec_, graph, 0);
+    cudaGraphDestroy(graph);
+    check(status, "instantiate graph");
+}
+
+void CudaBackend::run(const float* inputs, float* outputs)
+{
+    std::memcpy(host_input_.data(), inputs, input_size() * sizeof(float));
+    check(cudaGraphLaunch(graph_exec_, stream_), "cudaGraphLaunch");
+    check(cudaStreamSynchronize(stream_), "cudaStreamSynchronize");
+    std::memcpy(outputs, host_output_.data(), output_size() * sizeof(float));
+}
+
+}  // namespace
+
+std::unique_ptr<NeuralBackend> make_cuda_backend(
+    std::shared_ptr<const LifModel> model, const LifConfig& config)
+{
+    return std::make_unique<CudaBackend>(std::move(model), config);
+}
+
+}  // namespace eos
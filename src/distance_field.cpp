@@ -0,0 +1,194 @@
+/**
+* @file distance_field.cpp
+* @brief Patch-wise exact distance transform over the rolling occupancy grid
+*/
+
+#include "eos_robotics/distance_field.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace eos
+{
+
+DistanceField::DistanceField(OccupancyGrid& grid, float max_distance)
+    : grid_(&grid), max_distance_(max_distance)
+{
+    if (!(max_distance_ > 0.0f)) {
+        throw std::invalid_argument("Distance field range must be positive");
+    }
+
+    const std::size_t cells = grid_->cells();
+    reach_ = static_cast<long>(std::ceil(max_distance_ / grid_->resolution()));
+    // Anything past reach saturates, so "no obstacle" only needs to be beyond it
+    far_ = 2.0f * static_cast<float>((reach_ + 1) * (reach_ + 1));
+    mask_ = cells - 1;
+
+    distances_ = AlignedBuffer<float>(cells * cells);
+    columns_ = AlignedBuffer<float>(cells * cells);
+    line_in_.resize(cells);
+    line_out_.resize(cells);
+    envelope_sites_.resize(cells);
+    envelope_bounds_.resize(cells + 1);
+
+    // Start from whatever the grid already holds
+    origin_x_ = grid_->origin_x();
+    origin_y_ = grid_->origin_y();
+    const long size = static_cast<long>(cells);
+    CellRegion window;
+    window.include(origin_x_, origin_y_, origin_x_ + size - 1, origin_y_ + size - 1);
+    refresh(window);
+    grid_->clear_dirty();
+}
+
+std::size_t DistanceField::update()
+{
+    const long size = static_cast<long>(grid_->cells());
+    const long origin_x = grid_->origin_x();
+    const long origin_y = grid_->origin_y();
+    const long last_x = origin_x + size - 1;
+    const long last_y = origin_y + size - 1;
+    const long dx = origin_x - origin_x_;
+    const long dy = origin_y - origin_y_;
+    origin_x_ = origin_x;
+    origin_y_ = origin_y;
+
+    std::size_t recomputed = 0;
+    if (std::labs(dx) >= size || std::labs(dy) >= size) {
+        CellRegion window;
+        window.include(origin_x, origin_y, last_x, last_y);
+        recomputed = refresh(window);
+        grid_->clear_dirty();
+        return recomputed;
+    }
+
+    // A move changes the strip that entered the window, whose storage held
+    // other cells, and the edge it left, which lost the obstacles beyond it
+    CellRegion entered;
+    CellRegion left;
+    if (dx > 0) {
+        entered.include(last_x - dx + 1, origin_y, last_x, last_y);
+        left.include(origin_x - 1, origin_y, origin_x - 1, last_y);
+    } else if (dx < 0) {
+        entered.include(origin_x, origin_y, origin_x - dx - 1, last_y);
+        left.include(last_x + 1, origin_y, last_x + 1, last_y);
+    }
+    if (!entered.empty()) {
+        recomputed += refresh(entered);
+        recomputed += refresh(left);
+    }
+
+    entered = CellRegion{};
+    left = CellRegion{};
+    if (dy > 0) {
+        entered.include(origin_x, last_y - dy + 1, last_x, last_y);
+        left.include(origin_x, origin_y - 1, last_x, origin_y - 1);
+    } else if (dy < 0) {
+        entered.include(origin_x, origin_y, last_x, origin_y - dy - 1);
+        left.include(origin_x, last_y + 1, last_x, last_y + 1);
+    }
+    if (!entered.empty()) {
+        recomputed += refresh(entered);
+        recomputed += refresh(left);
+    }
+
+    if (!grid_->dirty_region().empty()) {
+        recomputed += refresh(grid_->dirty_region());
+    }
+    grid_->clear_dirty();
+    return recomputed;
+}
+
+CellRegion DistanceField::clip(const CellRegion& region, long margin) const
+{
+    const long size = static_cast<long>(grid_->cells());
+    CellRegion clipped;
+    clipped.min_x = std::max(region.min_x - margin, origin_x_);
+    clipped.min_y = std::max(region.min_y - margin, origin_y_);
+    clipped.max_x = std::min(region.max_x + margin, origin_x_ + size - 1);
+    clipped.max_y = std::min(region.max_y + margin, origin_y_ + size - 1);
+    return clipped;
+}
+
+std::size_t DistanceField::refresh(const CellRegion& changed)
+{
+    // Cells within reach of a change are rewritten; their nearest obstacle
+    // lies within reach of them in turn
+    const CellRegion target = clip(changed, reach_);
+    if (target.empty()) {
+        return 0;
+    }
+    const CellRegion source = clip(changed, 2 * reach_);
+    const std::size_t width = static_cast<std::size_t>(source.max_x - source.min_x + 1);
+    const std::size_t height = static_cast<std::size_t>(source.max_y - source.min_y + 1);
+
+    // Column pass over the source patch, kept for the target rows only
+    for (long cx = source.min_x; cx <= source.max_x; ++cx) {
+        for (std::size_t row = 0; row < height; ++row) {
+            const long cy = source.min_y + static_cast<long>(row);
+            line_in_[row] = grid_->occupied_cell(cx, cy) ? 0.0f : far_;
+        }
+        transform_line(line_in_.data(), height, line_out_.data());
+        const std::size_t column = static_cast<std::size_t>(cx - source.min_x);
+        for (long cy = target.min_y; cy <= target.max_y; ++cy) {
+            columns_[static_cast<std::size_t>(cy - target.min_y) * width + column] =
+                line_out_[static_cast<std::size_t>(cy - source.min_y)];
+        }
+    }
+
+    // Row pass, written back for the target cells
+    const float resolution = grid_->resolution();
+    for (long cy = target.min_y; cy <= target.max_y; ++cy) {
+        const float* row = columns_.data() + static_cast<std::size_t>(cy - target.min_y) * width;
+        transform_line(row, width, line_out_.data());
+        for (long cx = target.min_x; cx <= target.max_x; ++cx) {
+            const float squared = line_out_[static_cast<std::size_t>(cx - source.min_x)];
+            distances_[index(cx, cy)] = std::min(std::sqrt(squared) * resolution, max_distance_);
+        }
+    }
+
+    return static_cast<std::size_t>(target.max_x - target.min_x + 1) *
+           static_cast<std::size_t>(target.max_y - target.min_y + 1);
+}
+
+void DistanceField::transform_line(const float* input, std::size_t count, float* output)
+{
+    // Lower envelope of the parabolas (q - site)^2 + input[site]
+    long* sites = envelope_sites_.data();
+    float* bounds = envelope_bounds_.data();
+    std::size_t k = 0;
+    sites[0] = 0;
+    bounds[0] = -std::numeric_limits<float>::infinity();
+    bounds[1] = std::numeric_limits<float>::infinity();
+    for (std::size_t q = 1; q < count; ++q) {
+        const float fq = input[q] + static_cast<float>(q * q);
+        float s;
+        while (true) {
+            const long v = sites[k];
+            s = (fq - (input[v] + static_cast<float>(v * v))) /
+                static_cast<float>(2 * (static_cast<long>(q) - v));
+            if (s > bounds[k]) {
+                break;
+            }
+            --k;
+        }
+        ++k;
+        sites[k] = static_cast<long>(q);
+        bounds[k] = s;
+        bounds[k + 1] = std::numeric_limits<float>::infinity();
+    }
+
+    k = 0;
+    for (std::size_t q = 0; q < count; ++q) {
+        while (bounds[k + 1] < static_cast<float>(q)) {
+            ++k;
+        }
+        const float offset = static_cast<float>(static_cast<long>(q) - sites[k]);
+        output[q] = offset * offset + input[sites[k]];
+    }
+}
+
+}  // namespace eos
@@ -0,0 +1,105 @@
+/**
+* @file emergency_stop.cpp
+* @brief Sector minimum-range check behind the latched obstacle stop
+*/
+
+#include "eos_robotics/emergency_stop.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "eos_robotics/kernels.hpp"
+
+namespace eos
+{
+
+namespace
+{
+
+constexpr float kPi = 3.14159265358979f;
+
+}  // namespace
+
+EmergencyStop::EmergencyStop(const EmergencyStopConfig& config)
+    : config_(config), nearest_(std::numeric_limits<float>::infinity())
+{
+    if (!(config_.stop_distance > 0.0f) || !(config_.release_distance >= config_.stop_distance)) {
+        throw std::invalid_argument(
+            "Emergency stop distance must be positive and no larger than the release distance");
+    }
+    if (!(config_.half_angle > 0.0f) || config_.half_angle > kPi) {
+        throw std::invalid_argument("Emergency stop sector half-angle must be in (0, pi]");
+    }
+    if (!(config_.recovery_turn_rate > 0.0f)) {
+        throw std::invalid_argument("Emergency stop recovery turn rate must be positive");
+    }
+}
+
+float EmergencyStop::sector_min(const float* ranges, std::size_t count, float range_min,
+                                float angle_min, float angle_increment, float from, float to) const
+{
+    if (count == 0) {
+        return std::numeric_limits<float>::infinity();
+    }
+    if (angle_increment == 0.0f) {
+        return kernels::min_valid_range(ranges, count, range_min);
+    }
+
+    // The sector, in whichever turn the scan covers it
+    float nearest = std::numeric_limits<float>::infinity();
+    const float last_beam = static_cast<float>(count - 1);
+    for (const float turn : {-2.0f * kPi, 0.0f, 2.0f * kPi}) {
+        const float a = (turn + from - angle_min) / angle_increment;
+        const float b = (turn + to - angle_min) / angle_increment;
+        const float first = std::max(std::ceil(std::min(a, b)), 0.0f);
+        const float last = std::min(std::floor(std::max(a, b)), last_beam);
+        if (first > last) {
+            continue;
+        }
+        const std::size_t begin = static_cast<std::size_t>(first);
+        const std::size_t beams = static_cast<std::size_t>(last) - begin + 1;
+        nearest = std::min(nearest, kernels::min_valid_range(ranges + begin, beams, range_min));
+    }
+    return nearest;
+}
+
+bool EmergencyStop::check_scan(const float* ranges, std::size_t count, float range_min,
+                               float angle_min, float angle_increment)
+{
+    nearest_ = sector_min(ranges, count, range_min, angle_min, angle_increment,
+                          -config_.half_angle, config_.half_angle);
+    const bool stopped = stopped_.load(std::memory_order_relaxed);
+    if (stopped || nearest_ <= config_.stop_distance) {
+        // Recovery turns towards whichever half of the sector has more room
+        const float left = sector_min(ranges, count, range_min, angle_min, angle_increment, 0.0f,
+                                      config_.half_angle);
+        const float right = sector_min(ranges, count, range_min, angle_min, angle_increment,
+                                       -config_.half_angle, 0.0f);
+        recovery_side_.store(left >= right ? 1.0f : -1.0f, std::memory_order_relaxed);
+    }
+    if (!stopped && nearest_ <= config_.stop_distance) {
+        stopped_.store(true, std::memory_order_release);
+        triggers_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    if (stopped && nearest_ > config_.release_distance) {
+        stopped_.store(false, std::memory_order_release);
+        return false;
+    }
+    return stopped;
+}
+
+void EmergencyStop::limit(double& linear, double& angular) const
+{
+    if (!stopped()) {
+        return;
+    }
+    linear = std::min(linear, 0.0);
+    if (linear == 0.0 && angular == 0.0) {
+        angular = recovery_side_.load(std::memory_order_relaxed) * config_.recovery_turn_rate;
+    }
+}
+
+}  // namespace eos
@@ -0,0 +1,218 @@
+/**
+* @file eos_inference_server.cpp
+* @brief Shared SNN inference for several robots on one edge computer
+*
+* Hosts a single copy of the model and serves every robot namespace listed
+* in server.robots: each robot's eos_ros_node (neural.mode: client) publishes
+* preprocessed scan features on <robot>/eos/neural_input and receives firing
+* rates on <robot>/eos/neural_result. Requests are micro-batched within
+* server.latency_budget so the weights are streamed once per batch instead
+* of once per robot.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "eos_robotics/msg/neural_input.hpp"
+#include "eos_robotics/msg/neural_output.hpp"
+
+#include "eos_robotics/inference_batcher.hpp"
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+#include "eos_robotics/qos_config.hpp"
+
+/**
+* @brief Subscribes to every robot's requests and answers them in batches
+*/
+class EosInferenceServer : public rclcpp::Node
+{
+public:
+    explicit EosInferenceServer(const rclcpp::NodeOptions& options = rclcpp::NodeOptions())
+    : Node("eos_inference_server", options)
+    {
+        // Robots served, as namespaces; "" is the root namespace
+        this->declare_parameter<std::vector<std::string>>("server.robots", {""});
+        this->declare_parameter<double>("server.latency_budget", 0.002);
+        this->declare_parameter<double>("server.stats_interval", 10.0);
+
+        // Model and dynamics, named as in eos_ros_node so both read one params.yaml
+        // neural.model_path falls back to the older top-level neural_model_path
+        const std::string model_path = this->declare_parameter<std::string>(
+            "neural.model_path",
+            this->declare_parameter<std::string>("neural_model_path", "models/default_snn.eosm"));
+        this->declare_parameter<int>("neural.input_size", 100);
+        this->declare_parameter<int>("neural.output_size", 10);
+        this->declare_parameter<int>("neural.hidden_layers", 2);
+        this->declare_parameter<int>("neural.hidden_neurons", 64);
+        this->declare_parameter<int>("neural.time_steps", 10);
+        this->declare_parameter<double>("neural.spike_threshold", 0.5);
+        this->declare_parameter<double>("neural.membrane_decay", 0.9);
+        this->declare_parameter<std::string>("neural.propagation_mode", "auto");
+        this->declare_parameter<double>("neural.sparse_density_threshold", 0.15);
+        this->declare_parameter<double>("neural.synapse_prune_threshold", 0.0);
+
+        const auto robots = this->get_parameter("server.robots").as_string_array();
+        if (robots.empty()) {
+            throw std::invalid_argument("server.robots lists no robots");
+        }
+
+        eos::LifConfig config;
+        config.input_size = size_parameter("neural.input_size");
+        config.output_size = size_parameter("neural.output_size");
+        config.hidden_layers = size_parameter("neural.hidden_layers", 0);
+        config.hidden_neurons = size_parameter("neural.hidden_neurons");
+        config.time_steps = size_parameter("neural.time_steps");
+        config.spike_threshold = this->get_parameter("neural.spike_threshold").as_double();
+        config.membrane_decay = this->get_parameter("neural.membrane_decay").as_double();
+        config.propagation = eos::parse_propagation_mode(
+            this->get_parameter("neural.propagation_mode").as_string());
+        config.sparse_density_threshold =
+            this->get_parameter("neural.sparse_density_threshold").as_double();
+        config.synapse_prune_threshold =
+            this->get_parameter("neural.synapse_prune_threshold").as_double();
+        config.max_batch = robots.size();
+
+        auto engine = std::make_unique<eos::LifEngine>(eos::LifModel::open(model_path, config), config);
+        const std::size_t input_size = engine->input_size();
+
+        const auto params = this->get_node_parameters_interface();
+        const auto request_qos = eos::declare_topic_qos(params, "neural_input", eos::sensor_qos_defaults());
+        const auto result_qos = eos::declare_topic_qos(params, "neural_result", eos::sensor_qos_defaults());
+
+        // Publishers exist before the batcher starts replying on them
+        for (const auto& robot : robots) {
+            result_publishers_.push_back(this->create_publisher<eos_robotics::msg::NeuralOutput>(
+                topic(robot, "eos/neural_result"), result_qos));
+        }
+
+        const auto budget = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double>(this->get_parameter("server.latency_budget").as_double()));
+        batcher_ = std::make_unique<eos::InferenceBatcher>(
+            std::move(engine), robots.size(), budget,
+            [this](std::size_t client, std::int64_t tag, const float* output, std::size_t batch_size) {
+                this->publish_result(client, tag, output, batch_size);
+            });
+
+        for (std::size_t client = 0; client < robots.size(); ++client) {
+            request_subscriptions_.push_back(
+                this->create_subscription<eos_robotics::msg::NeuralInput>(
+                    topic(robots[client], "eos/neural_input"), request_qos,
+                    [this, client, input_size](eos_robotics::msg::NeuralInput::ConstSharedPtr msg) {
+                        if (msg->features.size() != input_size) {
+                            RCLCPP_WARN_THROTTLE(this->get_logger(), *this->get_clock(), 5000,
+                                                 "Dropping request with %zu features, model takes %zu",
+                                                 msg->features.size(), input_size);
+                            return;
+                        }
+                        batcher_->submit(client, rclcpp::Time(msg->header.stamp).nanoseconds(),
+                                         msg->features.data());
+                    }));
+            RCLCPP_INFO(this->get_logger(), "Serving %s", topic(robots[client], "eos").c_str());
+        }
+
+        const double stats_interval = this->get_parameter("server.stats_interval").as_double();
+        if (stats_interval > 0.0) {
+            stats_timer_ = this->create_wall_timer(
+                std::chrono::duration<double>(stats_interval), [this]() { this->log_stats(); });
+        }
+
+        RCLCPP_INFO(this->get_logger(),
+                    "Inference server: %zu robots, %zu -> %zu model (%s), %.1f ms latency budget",
+                    robots.size(), batcher_->input_size(), batcher_->output_size(),
+                    batcher_->engine().model()->memory_mapped() ? "mapped" : "seeded",
+                    budget.count() / 1e6);
+    }
+
+    /**
+     * @brief Stop batching before the publishers it replies on go away
+     */
+    ~EosInferenceServer()
+    {
+        request_subscriptions_.clear();
+        batcher_.reset();
+    }
+
+private:
+    /**
+     * @brief Read an integer parameter that sizes the network
+     * 
+     * @throws std::invalid_argument if it is below @p minimum
+     */
+    std::size_t size_parameter(const std::string& name, std::int64_t minimum = 1) const
+    {
+        const std::int64_t value = this->get_parameter(name).as_int();
+        if (value < minimum) {
+            throw std::invalid_argument(name + " must be at least " + std::to_string(minimum) +
+                                        ", got " + std::to_string(value));
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+    /**
+     * @brief <robot>/<name> as an absolute topic; the root namespace for ""
+     */
+    static std::string topic(std::string robot, const std::string& name)
+    {
+        while (!robot.empty() && robot.front() == '/') {
+            robot.erase(0, 1);
+        }
+        while (!robot.empty() && robot.back() == '/') {
+            robot.pop_back();
+        }
+        return robot.empty() ? "/" + name : "/" + robot + "/" + name;
+    }
+
+    /**
+     * @brief Batcher thread: answer one request
+     */
+    void publish_result(std::size_t client, std::int64_t tag, const float* output,
+                        std::size_t batch_size)
+    {
+        auto msg = std::make_unique<eos_robotics::msg::NeuralOutput>();
+        msg->header.stamp = rclcpp::Time(tag, RCL_ROS_TIME);
+        msg->rates.assign(output, output + batcher_->output_size());
+        msg->batch_size = static_cast<std::uint32_t>(batch_size);
+        result_publishers_[client]->publish(std::move(msg));
+    }
+
+    void log_stats()
+    {
+        const std::uint64_t batches = batcher_->batches();
+        const std::uint64_t requests = batcher_->requests();
+        RCLCPP_INFO(this->get_logger(),
+                    "%lu requests in %lu batches (%.2f per batch), %lu superseded before running",
+                    static_cast<unsigned long>(requests), static_cast<unsigned long>(batches),
+                    batches > 0 ? static_cast<double>(requests) / batches : 0.0,
+                    static_cast<unsigned long>(batcher_->superseded()));
+    }
+
+    std::vector<rclcpp::Publisher<eos_robotics::msg::NeuralOutput>::SharedPtr> result_publishers_;
+    std::vector<rclcpp::Subscription<eos_robotics::msg::NeuralInput>::SharedPtr> request_subscriptions_;
+    std::unique_ptr<eos::InferenceBatcher> batcher_;
+    rclcpp::TimerBase::SharedPtr stats_timer_;
+};
+
+/**
+* @brief Main function for the Eos inference server
+*/
+int main(int argc, char** argv)
+{
+    rclcpp::init(argc, argv);
+
+    try {
+        auto node = std::make_shared<EosInferenceServer>();
+        rclcpp::spin(node);
+        rclcpp::shutdown();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        RCLCPP_FATAL(rclcpp::get_logger("eos_inference_server"),
+                     "Fatal error in Eos inference server: %s", e.what());
+        return 1;
+    }
+}
@@ -9,101 +9,304 @@
 * - System status monitoring
 */
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <chrono>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <mutex>
 #include <thread>
 #include <vector>
+#include <stdexcept>
 #include <string>
 
 #include "rclcpp/rclcpp.hpp"
-#include "std_msgs/msg/string.hpp"
+#include "rclcpp_components/register_node_macro.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include "rclcpp_lifecycle/lifecycle_publisher.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "std_msgs/msg/float32_multi_array.hpp"
 #include "sensor_msgs/msg/laser_scan.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 #include "nav_msgs/msg/odometry.hpp"
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
+#include "diagnostic_msgs/msg/diagnostic_array.hpp"
+#include "eos_robotics/msg/neural_input.hpp"
+#include "eos_robotics/msg/eos_status.hpp"
+#include "eos_robotics/msg/neural_output.hpp"
+#include "eos_robotics/srv/dump_trace.hpp"
+#include "eos_robotics/srv/load_model.hpp"
 
-// Simple placeholder classes to replace the undefined ones
-class NeuralBridge {
-public:
-    NeuralBridge(const std::string& model_path) {
-        // Constructor implementation
-    }
-    
-    std::vector<float> process(
-        const sensor_msgs::msg::LaserScan& laser,
-        const sensor_msgs::msg::Imu& imu,
-        const nav_msgs::msg::Odometry& odom) {
-        
-        // Placeholder neural processing
-        return {0.5f, 0.3f, 0.2f}; // Example output
-    }
-};
+#include "eos_robotics/allocation_guard.hpp"
+#include "eos_robotics/async_log.hpp"
+#include "eos_robotics/executor_setup.hpp"
+#include "eos_robotics/inference_trigger.hpp"
+#include "eos_robotics/kernels.hpp"
+#include "eos_robotics/model_loader.hpp"
+#include "eos_robotics/distance_field.hpp"
+#include "eos_robotics/emergency_stop.hpp"
+#include "eos_robotics/eos_ros_node.hpp"
+#include "eos_robotics/navigation_controller.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+#include "eos_robotics/pose_ekf.hpp"
+#include "eos_robotics/neural_bridge.hpp"
+#include "eos_robotics/node_metrics.hpp"
+#include "eos_robotics/qos_config.hpp"
+#include "eos_robotics/scan_preprocessor.hpp"
+#include "eos_robotics/sensor_snapshot.hpp"
+#include "eos_robotics/status_telemetry.hpp"
+#include "eos_robotics/topological_memory.hpp"
+#include "eos_robotics/trace_ring.hpp"
 
-class NavigationController {
-public:
-    NavigationController() = default;
-    
-    geometry_msgs::msg::Twist compute_command() {
-        geometry_msgs::msg::Twist cmd;
-        cmd.linear.x = 0.1; // Slow forward
-        cmd.angular.z = 0.0;
-        return cmd;
-    }
-    
-    void set_goal(const geometry_msgs::msg::PoseStamped& goal) {
-        // Placeholder implementation
-    }
-};
+#if defined(EOS_WITH_RUST_CORE)
+#include "eos_robotics/rust_core.hpp"
+#endif
+
+namespace eos
+{
 
 /**
 * @brief Main Eos ROS2 node class
 * 
 * Handles all ROS2 communication and coordinates between neural processing
 * and navigation control systems.
+* 
+* Managed lifecycle: the constructor only reads parameters and (optionally)
+* starts loading the model in the background; on_configure builds the
+* components, publishers and timers, and on_activate creates subscriptions
+* and starts the timers, so a configured node switches between standby and
+* active without reloading anything.
+* 
+* With neural.mode set to client the node holds no model: it publishes the
+* preprocessed scan on eos/neural_input (relative, so it follows the node's
+* namespace) and takes the firing rates from eos_inference_server on
+* eos/neural_result, letting several robots share one batched engine.
+*
+* The node is also the eos::EosRosNode component: loaded into a container
+* next to the sensor drivers, with intra-process comms on, scans reach it
+* without being serialized. The container's executor then spins every
+* callback group, so the executor.* parameters only apply to the
+* standalone eos_ros_node.
 */
-class EosRosNode : public rclcpp::Node
+class EosRosNode : public rclcpp_lifecycle::LifecycleNode
 {
 public:
+    using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
     /**
      * @brief Construct a new Eos Ros Node object
+     * 
+     * Intra-process communication is on by default, and /cmd_vel and
+     * /eos/neural_output are published as unique_ptrs: a co-located
+     * subscriber is handed the message itself, neither serialized nor
+     * copied. The price is one message allocation per publish, made outside
+     * the allocation guards. Loaned messages would avoid it for an
+     * out-of-process subscriber but rclcpp refuses loans on intra-process
+     * publishers, and co-located consumers are the case this node is built for.
      */
-    EosRosNode() : Node("eos_ros_node")
+    explicit EosRosNode(
+        const rclcpp::NodeOptions& options = rclcpp::NodeOptions().use_intra_process_comms(true))
+    : LifecycleNode("eos_ros_node", options)
     {
-        // Declare parameters with descriptions
-        this->declare_parameter<double>("neural_update_rate", 10.0);
-        this->declare_parameter<double>("navigation_update_rate", 15.0);
-        this->declare_parameter<double>("safety_distance", 0.5);
-        this->declare_parameter<double>("max_velocity", 0.5);
-        this->declare_parameter<std::string>("neural_model_path", "models/default_snn.json");
+        // Model, rates and planner limits as params.yaml names them; the old
+        // top-level names still work where the grouped ones are unset
+        model_path_ = declare_renamed<std::string>("neural.model_path", "neural_model_path",
+                                                   "models/default_snn.eosm");
+        neural_update_rate_ = declare_renamed<double>("neural.update_rate", "neural_update_rate", 10.0);
+        navigation_update_rate_ =
+            declare_renamed<double>("navigation.planning_rate", "navigation_update_rate", 15.0);
+        safety_distance_ = declare_renamed<double>("navigation.safety_distance", "safety_distance", 0.5);
+        max_velocity_ = declare_renamed<double>("navigation.max_linear_velocity", "max_velocity", 0.5);
+        
+        // Network topology (mirrors the neural block of params.yaml)
+        this->declare_parameter<int>("neural.input_size", 100);
+        this->declare_parameter<int>("neural.output_size", 10);
+        this->declare_parameter<int>("neural.hidden_layers", 2);
+        this->declare_parameter<int>("neural.hidden_neurons", 64);
+        this->declare_parameter<int>("neural.time_steps", 10);
+        this->declare_parameter<double>("neural.spike_threshold", 0.5);
+        this->declare_parameter<double>("neural.membrane_decay", 0.9);
+        this->declare_parameter<std::string>("neural.propagation_mode", "auto");
+        this->declare_parameter<double>("neural.sparse_density_threshold", 0.15);
+        this->declare_parameter<double>("neural.synapse_prune_threshold", 0.0);
+        this->declare_parameter<std::string>("neural.binning", "min");
+        this->declare_parameter<double>("neural.sector_fov", 2.0 * M_PI);
+        // local runs the engine in-process, client sends features to eos_inference_server
+        this->declare_parameter<std::string>("neural.mode", "local");
+        // Device the local engine runs on: cpu, or cuda in builds with EOS_ENABLE_CUDA
+        this->declare_parameter<std::string>("neural.backend", "cpu");
+        
+        // Planner behind /cmd_vel: native C++, or the in-process Rust core in
+        // builds with EOS_WITH_RUST_CORE
+        this->declare_parameter<std::string>("navigation.core", "native");
+        this->declare_parameter<double>("navigation.max_angular_velocity", 1.0);
+        this->declare_parameter<double>("navigation.max_acceleration", 0.3);
+        this->declare_parameter<double>("navigation.goal_tolerance", 0.1);
+        this->declare_parameter<double>("navigation.obstacle_inflation", 0.3);
+        
+        // Latched stop checked in the laser callback on the beams ahead
+        this->declare_parameter<double>("navigation.emergency_stop_distance", 0.2);
+        this->declare_parameter<double>("navigation.emergency_release_distance", 0.3);
+        this->declare_parameter<double>("navigation.emergency_stop_half_angle", 1.0);
+        this->declare_parameter<double>("navigation.emergency_stop_recovery_turn_rate", 0.4);
+        
+        // Native dynamic-window planner: acceleration window, velocity lattice and scoring
+        this->declare_parameter<double>("navigation.max_angular_acceleration", 1.0);
+        this->declare_parameter<int>("navigation.dwa.linear_samples", 31);
+        this->declare_parameter<int>("navigation.dwa.angular_samples", 101);
+        this->declare_parameter<double>("navigation.dwa.horizon", 1.5);
+        this->declare_parameter<double>("navigation.dwa.rollout_step", 0.1);
+        this->declare_parameter<int>("navigation.dwa.obstacle_sectors", 120);
+        this->declare_parameter<double>("navigation.dwa.goal_weight", 1.0);
+        this->declare_parameter<double>("navigation.dwa.clearance_weight", 0.6);
+        this->declare_parameter<double>("navigation.dwa.velocity_weight", 0.2);
+        
+        // Odometry + IMU pose filter; planners act on its pose extrapolated to now
+        this->declare_parameter<double>("localization.max_extrapolation", 0.25);
+        this->declare_parameter<double>("localization.odom_position_stddev", 0.02);
+        this->declare_parameter<double>("localization.odom_heading_stddev", 0.02);
+        this->declare_parameter<double>("localization.odom_velocity_stddev", 0.05);
+        this->declare_parameter<double>("localization.gyro_stddev", 0.02);
+        
+        // Rolling occupancy grid the native planner checks rollouts against
+        this->declare_parameter<double>("navigation.map.resolution", 0.05);
+        this->declare_parameter<int>("navigation.map.cells", 256);
+        this->declare_parameter<double>("navigation.map.max_range", 5.0);
+        
+        // Topological map and trajectory memory, journalled append-only
+        this->declare_parameter<bool>("memory.enabled", true);
+        this->declare_parameter<double>("memory.update_rate", 5.0);
+        this->declare_parameter<int>("memory.trajectory_length", 100);
+        this->declare_parameter<double>("memory.node_spacing", 0.5);
+        this->declare_parameter<double>("memory.loop_closure_radius", 0.5);
+        this->declare_parameter<double>("memory.loop_closure_heading", 0.1);
+        this->declare_parameter<int>("memory.loop_closure_min_separation", 20);
+        this->declare_parameter<int>("memory.max_nodes", 50000);
+        this->declare_parameter<std::string>("memory.journal_path", "eos_memory.journal");
+        this->declare_parameter<double>("memory.persistence_interval", 30.0);
         
         // Get parameter values
-        neural_update_rate_ = this->get_parameter("neural_update_rate").as_double();
-        navigation_update_rate_ = this->get_parameter("navigation_update_rate").as_double();
-        safety_distance_ = this->get_parameter("safety_distance").as_double();
-        max_velocity_ = this->get_parameter("max_velocity").as_double();
-        std::string model_path = this->get_parameter("neural_model_path").as_string();
+        
+        // A negative size would wrap to a huge std::size_t, so sizes are
+        // rejected here, before the preload below can act on them
+        neural_config_.input_size = size_parameter("neural.input_size");
+        neural_config_.output_size = size_parameter("neural.output_size");
+        neural_config_.hidden_layers = size_parameter("neural.hidden_layers", 0);
+        neural_config_.hidden_neurons = size_parameter("neural.hidden_neurons");
+        neural_config_.time_steps = size_parameter("neural.time_steps");
+        neural_config_.spike_threshold = this->get_parameter("neural.spike_threshold").as_double();
+        neural_config_.membrane_decay = this->get_parameter("neural.membrane_decay").as_double();
+        neural_config_.sparse_density_threshold =
+            this->get_parameter("neural.sparse_density_threshold").as_double();
+        neural_config_.synapse_prune_threshold =
+            this->get_parameter("neural.synapse_prune_threshold").as_double();
+        propagation_mode_name_ = this->get_parameter("neural.propagation_mode").as_string();
+        binning_name_ = this->get_parameter("neural.binning").as_string();
+        scan_config_.bins = neural_config_.input_size;
+        scan_config_.sector_fov = this->get_parameter("neural.sector_fov").as_double();
+        neural_config_.propagation = eos::parse_propagation_mode(propagation_mode_name_);
+        scan_config_.strategy = eos::parse_binning_strategy(binning_name_);
+        const std::string neural_mode = this->get_parameter("neural.mode").as_string();
+        if (neural_mode != "local" && neural_mode != "client") {
+            throw std::invalid_argument(
+                "Unknown neural.mode '" + neural_mode + "', expected local or client");
+        }
+        client_mode_ = neural_mode == "client";
+        backend_type_ = eos::parse_backend_type(this->get_parameter("neural.backend").as_string());
+        const std::string navigation_core = this->get_parameter("navigation.core").as_string();
+        if (navigation_core != "native" && navigation_core != "rust") {
+            throw std::invalid_argument(
+                "Unknown navigation.core '" + navigation_core + "', expected native or rust");
+        }
+#if !defined(EOS_WITH_RUST_CORE)
+        if (navigation_core == "rust") {
+            throw std::invalid_argument(
+                "navigation.core rust needs a build with -DEOS_WITH_RUST_CORE=ON");
+        }
+#endif
+        rust_navigation_ = navigation_core == "rust";
+        
+        // Inference triggering: fixed-rate timer or on every new scan
+        this->declare_parameter<std::string>("neural.trigger_mode", "timer");
+        this->declare_parameter<double>("neural.max_trigger_rate", 30.0);
+        this->declare_parameter<double>("neural.deadline", 0.2);
+        this->declare_parameter<bool>("neural.sync_imu", false);
+        this->declare_parameter<double>("neural.sync_slop", 0.02);
+        initialize_inference_trigger();
+
+        // Executor and per-callback-group scheduling, consumed by main()
+        declare_executor_parameters();
+        
+        // Node-wide QoS defaults; per-topic overrides live under ros.qos.<topic>
+        this->declare_parameter<int>("ros.qos_depth", 10);
+        this->declare_parameter<std::string>("ros.qos_reliability", "reliable");
+        this->declare_parameter<std::string>("ros.qos_durability", "volatile");
+        default_qos_.depth = size_parameter("ros.qos_depth");
+        default_qos_.reliability = this->get_parameter("ros.qos_reliability").as_string();
+        default_qos_.durability = this->get_parameter("ros.qos_durability").as_string();
+        
+        // Latency metrics are always collected; profiling also dumps them to a file
+        this->declare_parameter<bool>("debug.enable_profiling", false);
+        this->declare_parameter<std::string>("debug.profile_output_file", "eos_performance.log");
+        this->declare_parameter<double>("debug.metrics_rate", 1.0);
+        enable_profiling_ = this->get_parameter("debug.enable_profiling").as_bool();
+        profile_output_file_ = this->get_parameter("debug.profile_output_file").as_string();
+        metrics_rate_ = this->get_parameter("debug.metrics_rate").as_double();
+        
+        // Hot callbacks log through a throttled queue formatted off-thread;
+        // enable_<subsystem>_debug lowers that subsystem to debug
+        this->declare_parameter<std::string>("debug.log_level", "info");
+        this->declare_parameter<bool>("debug.enable_perception_debug", false);
+        this->declare_parameter<bool>("debug.enable_neural_debug", false);
+        this->declare_parameter<bool>("debug.enable_navigation_debug", false);
+        this->declare_parameter<int>("debug.log_queue_size", 1024);
+        initialize_hot_log();
+        
+        // Typed fleet telemetry on /eos/status, optionally delta-encoded
+        this->declare_parameter<double>("status.rate", 1.0);
+        this->declare_parameter<bool>("status.delta_encoding", false);
+        this->declare_parameter<int>("status.keyframe_interval", 10);
+        this->declare_parameter<int>("status.latency_deadband_us", 50);
+        status_rate_ = this->get_parameter("status.rate").as_double();
+        
+        // Per-thread trace rings, dumped by /eos/dump_trace or SIGUSR1; set
+        // before any callback runs so every thread's ring gets this size
+        this->declare_parameter<bool>("trace.enabled", true);
+        this->declare_parameter<int>("trace.buffer_events", 8192);
+        this->declare_parameter<std::string>("trace.dump_path", "eos_trace.json");
+        eos::trace::set_enabled(this->get_parameter("trace.enabled").as_bool());
+        eos::trace::set_buffer_events(static_cast<std::size_t>(
+            std::max<std::int64_t>(this->get_parameter("trace.buffer_events").as_int(), 0)));
+        trace_dump_path_ = this->get_parameter("trace.dump_path").as_string();
+        
+        // Lifecycle: autostart walks configure -> activate once spinning;
+        // preloading builds the engine while the process is still starting up
+        this->declare_parameter<bool>("lifecycle.autostart", true);
+        this->declare_parameter<bool>("lifecycle.preload_model", true);
 
         RCLCPP_INFO(this->get_logger(), 
                     "Eos ROS Node starting with neural rate: %.1fHz, navigation rate: %.1fHz", 
                     neural_update_rate_, navigation_update_rate_);
 
-        // Initialize components
-        initialize_components(model_path);
-        
-        // Create publishers
-        initialize_publishers();
-        
-        // Create subscribers  
-        initialize_subscribers();
+        initialize_callback_groups();
         
-        // Create timers for periodic processing
-        initialize_timers();
+        if (!client_mode_ && this->get_parameter("lifecycle.preload_model").as_bool()) {
+            start_model_preload();
+        }
         
-        // Create services for external control
-        initialize_services();
+        if (this->get_parameter("lifecycle.autostart").as_bool()) {
+            // One-shot: transitions run on the executor, so construction never blocks
+            autostart_timer_ = this->create_wall_timer(
+                std::chrono::milliseconds(0), [this]() { this->autostart(); });
+        }
 
-        RCLCPP_INFO(this->get_logger(), "Eos ROS Node initialized successfully");
+        RCLCPP_INFO(this->get_logger(), "Eos ROS Node created, waiting for configure");
     }
 
     /**
@@ -112,156 +315,1074 @@ public:
     ~EosRosNode()
     {
         RCLCPP_INFO(this->get_logger(), "Shutting down Eos ROS Node");
-        // Cleanup would happen here
+        is_operational_ = false;
+        // The preload reads configuration members; let it finish first
+        if (preloaded_bridge_.valid()) {
+            preloaded_bridge_.wait();
+        }
+        if (enable_profiling_) {
+            write_profile();
+        }
+    }
+
+    /**
+     * @brief Build components, publishers and (stopped) timers
+     * 
+     * Waits for the background model preload if one was started.
+     */
+    CallbackReturn on_configure(const rclcpp_lifecycle::State&) override
+    {
+        if (!standalone_ && executor_settings_customized()) {
+            RCLCPP_WARN(this->get_logger(),
+                        "Running as a component: executor.* settings are ignored, the "
+                        "container's executor spins every callback group");
+        }
+        try {
+            initialize_components();
+            initialize_publishers();
+            declare_subscription_qos();
+            initialize_timers();
+            initialize_services();
+        }
+        catch (const std::exception& e) {
+            RCLCPP_ERROR(this->get_logger(), "Configuration failed: %s", e.what());
+            release_resources();
+            return CallbackReturn::FAILURE;
+        }
+        accepting_callbacks_ = true;
+        
+        RCLCPP_INFO(this->get_logger(), "Configured");
+        return CallbackReturn::SUCCESS;
+    }
+
+    /**
+     * @brief Subscribe to sensors and start the timers
+     */
+    CallbackReturn on_activate(const rclcpp_lifecycle::State&) override
+    {
+        for_each_publisher([](auto& publisher) { publisher->on_activate(); });
+        configure_loop_monitors();
+        initialize_subscribers();
+        for (auto* timer : {&neural_timer_, &navigation_timer_, &status_timer_, &metrics_timer_,
+                             &memory_timer_}) {
+            if (*timer) {
+                (*timer)->reset();
+            }
+        }
+        is_operational_ = true;
+        status_encoder_->force_keyframe();
+        
+        RCLCPP_INFO(this->get_logger(), "Activated");
+        return CallbackReturn::SUCCESS;
+    }
+
+    /**
+     * @brief Stop the robot, the timers and the sensor subscriptions
+     */
+    CallbackReturn on_deactivate(const rclcpp_lifecycle::State&) override
+    {
+        is_operational_ = false;
+        stop_timers();
+        release_subscriptions();
+        publish_cmd_vel(0.0, 0.0);
+        for_each_publisher([](auto& publisher) { publisher->on_deactivate(); });
+        
+        RCLCPP_INFO(this->get_logger(), "Deactivated");
+        return CallbackReturn::SUCCESS;
+    }
+
+    /**
+     * @brief Release everything on_configure created
+     */
+    CallbackReturn on_cleanup(const rclcpp_lifecycle::State&) override
+    {
+        release_resources();
+        RCLCPP_INFO(this->get_logger(), "Cleaned up");
+        return CallbackReturn::SUCCESS;
+    }
+
+    CallbackReturn on_shutdown(const rclcpp_lifecycle::State& state) override
+    {
+        if (state.id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+            on_deactivate(state);
+        }
+        release_resources();
+        return CallbackReturn::SUCCESS;
+    }
+
+    CallbackReturn on_error(const rclcpp_lifecycle::State&) override
+    {
+        is_operational_ = false;
+        release_resources();
+        RCLCPP_ERROR(this->get_logger(), "Error during transition, resources released");
+        return CallbackReturn::SUCCESS;
+    }
+
+    /**
+     * @brief Executor settings from the executor.* parameters
+     */
+    const eos::ExecutorConfig& executor_config() const
+    {
+        return executor_config_;
+    }
+
+    /**
+     * @brief Callback groups with their thread pinning and priority
+     */
+    std::vector<eos::CallbackGroupSchedule> callback_group_schedules() const
+    {
+        return group_schedules_;
+    }
+
+    /**
+     * @brief Spin on the executor.* configuration until shutdown
+     *
+     * Only for the standalone executable; in a container the container spins.
+     */
+    void spin_standalone()
+    {
+        standalone_ = true;
+        eos::spin(this->get_node_base_interface(), executor_config_, group_schedules_);
     }
 
 private:
     // ROS2 Publishers
-    rclcpp::Publisher<geometry_msgs::msg::Twist>::SharedPtr cmd_vel_publisher_;
-    rclcpp::Publisher<std_msgs::msg::String>::SharedPtr status_publisher_;
-    rclcpp::Publisher<geometry_msgs::msg::PoseStamped>::SharedPtr goal_publisher_;
+    template <typename T>
+    using LifecyclePublisher = typename rclcpp_lifecycle::LifecyclePublisher<T>::SharedPtr;
+    LifecyclePublisher<geometry_msgs::msg::Twist> cmd_vel_publisher_;
+    LifecyclePublisher<eos_robotics::msg::EosStatus> status_publisher_;
+    LifecyclePublisher<geometry_msgs::msg::PoseStamped> goal_publisher_;
+    LifecyclePublisher<std_msgs::msg::Float32MultiArray> neural_output_publisher_;
+    LifecyclePublisher<diagnostic_msgs::msg::DiagnosticArray> metrics_publisher_;
+    LifecyclePublisher<eos_robotics::msg::NeuralInput> server_request_publisher_;
     
     // ROS2 Subscribers
     rclcpp::Subscription<sensor_msgs::msg::LaserScan>::SharedPtr laser_subscription_;
     rclcpp::Subscription<sensor_msgs::msg::Imu>::SharedPtr imu_subscription_;
     rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr odom_subscription_;
     rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr goal_subscription_;
+    rclcpp::Subscription<eos_robotics::msg::NeuralOutput>::SharedPtr server_result_subscription_;
+    // Their profiles, declared on configure
+    rclcpp::QoS laser_qos_{1};
+    rclcpp::QoS imu_qos_{1};
+    rclcpp::QoS odom_qos_{1};
+    rclcpp::QoS set_goal_qos_{1};
+    rclcpp::QoS result_qos_{1};
+    
+    // Callback groups: each stage is mutually exclusive internally but runs
+    // independently of the others under a multi-threaded or isolated executor
+    rclcpp::CallbackGroup::SharedPtr sensing_group_;
+    rclcpp::CallbackGroup::SharedPtr inference_group_;
+    rclcpp::CallbackGroup::SharedPtr control_group_;
+    rclcpp::CallbackGroup::SharedPtr status_group_;
+    std::vector<eos::CallbackGroupSchedule> group_schedules_;
+    eos::ExecutorConfig executor_config_;
+    eos::QosSettings default_qos_;
     
     // Timers for periodic processing
     rclcpp::TimerBase::SharedPtr neural_timer_;
     rclcpp::TimerBase::SharedPtr navigation_timer_;
     rclcpp::TimerBase::SharedPtr status_timer_;
+    rclcpp::TimerBase::SharedPtr metrics_timer_;
+    rclcpp::TimerBase::SharedPtr memory_timer_;
+    rclcpp::TimerBase::SharedPtr autostart_timer_;
+    
+    // Hot model reload; the ids outlive the loader, whose thread sets staged_model_id_
+    std::mutex model_id_mutex_;
+    std::string model_id_;         ///< running model, for /eos/status
+    std::string staged_model_id_;  ///< staged by the last successful load
+    rclcpp::Service<eos_robotics::srv::LoadModel>::SharedPtr load_model_service_;
+    
+    // Post-mortem trace dumps
+    rclcpp::Service<eos_robotics::srv::DumpTrace>::SharedPtr dump_trace_service_;
+    std::string trace_dump_path_;
+    std::unique_ptr<eos::ModelLoader> model_loader_;
     
     // Component interfaces
-    std::unique_ptr<NeuralBridge> neural_bridge_;
-    std::unique_ptr<NavigationController> navigation_controller_;
+    std::unique_ptr<eos::NeuralBridge> neural_bridge_;
+    std::future<std::unique_ptr<eos::NeuralBridge>> preloaded_bridge_;
+    std::string model_path_;
+    std::unique_ptr<eos::NavigationController> navigation_controller_;
+    std::unique_ptr<eos::OccupancyGrid> occupancy_grid_;
+    std::unique_ptr<eos::DistanceField> distance_field_;
+    std::unique_ptr<eos::EmergencyStop> emergency_stop_;
+    // Fed by the sensing group; its estimate reaches readers through the snapshot
+    std::unique_ptr<eos::PoseEkf> pose_ekf_;
+    // Map nodes and loop closures from the fused pose, on the control group
+    std::unique_ptr<eos::TopologicalMemory> memory_;
+    std::unique_ptr<eos::MemoryJournal> memory_journal_;
+    std::int64_t memory_persisted_ns_ = 0;
+    std::int64_t memory_persistence_interval_ns_ = 0;
+    float max_extrapolation_ = 0.25f;
+    std::uint64_t navigation_scan_sequence_ = 0;
+#if defined(EOS_WITH_RUST_CORE)
+    // NavigationPlanner/MotionController from the Rust crate, on the control group
+    std::unique_ptr<eos::RustNavigator> rust_navigator_;
+#endif
+    
+    // Firing rates per /eos/neural_output; the network writes straight into
+    // each message's data, which is then handed to the publisher
+    std::size_t neural_output_size_ = 0;
+    geometry_msgs::msg::Twist cmd_vel_command_;
+    eos_robotics::msg::EosStatus status_msg_;
+    
+    // /eos/status: stage list encoding, process sampling and the counters
+    // the callbacks bump; the model id changes on the inference thread
+    std::unique_ptr<eos::StatusDeltaEncoder> status_encoder_;
+    eos::ProcessUsage process_usage_;
+    std::vector<eos::StageLatencySample> stage_samples_;
+    std::vector<eos::StageLatencySample> stage_delta_;
+    std::atomic<std::uint64_t> scans_received_{0};
+    std::atomic<std::uint64_t> scans_inferred_{0};
+    std::atomic<std::uint64_t> inferences_completed_{0};
+    std::uint64_t reported_inferences_ = 0;
+    std::int64_t reported_inferences_ns_ = 0;
+    std::string sent_model_id_;
+    double status_rate_ = 1.0;
+    
+    // Latest sensor data, written by the sensor callbacks and read by the timers
+    std::unique_ptr<eos::SensorSnapshot> sensor_snapshot_;
     
-    // Current sensor data
-    sensor_msgs::msg::LaserScan::SharedPtr current_laser_scan_;
-    sensor_msgs::msg::Imu::SharedPtr current_imu_;
-    nav_msgs::msg::Odometry::SharedPtr current_odometry_;
+    // Scan preprocessing, owned by the sensing callback group
+    std::unique_ptr<eos::ScanPreprocessor> scan_preprocessor_;
+    
+    // Client mode: the inference server runs the model
+    bool client_mode_ = false;
+    eos_robotics::msg::NeuralInput server_request_;
+    
+    // Gate in front of inference (dedup, rate limit, deadline, IMU sync)
+    eos::InferenceTrigger inference_trigger_;
+    // Recent IMU stamps and the latest scan's, on the sensing group, so each
+    // scan is synchronised with the IMU sample closest to it
+    eos::StampHistory imu_stamps_;
+    std::int64_t laser_stamp_ns_ = 0;
+    bool scan_triggered_inference_ = false;
+    
+    // Callback latency, sensor age and timer jitter; lock-free, shared by all groups
+    eos::NodeMetrics metrics_;
+    // Stamp of the scan behind the latest inference, for sense-to-cmd_vel latency
+    std::atomic<std::int64_t> inference_scan_stamp_ns_{0};
+    std::array<std::uint64_t, static_cast<std::size_t>(eos::MonitoredLoop::Count)> reported_overruns_{};
+    bool enable_profiling_ = false;
+    std::string profile_output_file_;
+    double metrics_rate_ = 1.0;
+    
+    // Per-message debug output of the hot callbacks; formatted on its own thread
+    std::unique_ptr<eos::AsyncLog> hot_log_;
     
     // Parameters
     double neural_update_rate_;
     double navigation_update_rate_;
     double safety_distance_;
     double max_velocity_;
-    bool is_operational_ = false;
+    eos::LifConfig neural_config_;
+    std::string propagation_mode_name_;
+    eos::BackendType backend_type_ = eos::BackendType::Cpu;
+    bool rust_navigation_ = false;
+    eos::ScanPreprocessorConfig scan_config_;
+    std::string binning_name_;
+    // True only while active; read by every callback group
+    std::atomic<bool> is_operational_{false};
+    // Between a successful configure and release_resources(); see CallbackGuard
+    std::atomic<bool> accepting_callbacks_{false};
+    std::atomic<int> callbacks_in_flight_{0};
 
     /**
-     * @brief Initialize neural and navigation components
+     * @brief Counts a callback in for release_resources() to wait on
+     *
+     * The count goes up before accepting_callbacks_ is read, so once
+     * release_resources() has cleared the flag and seen the count at zero,
+     * no callback can still reach the components it resets.
      */
-    void initialize_components(const std::string& model_path)
+    class CallbackGuard
+    {
+    public:
+        explicit CallbackGuard(EosRosNode& node) : node_(node)
+        {
+            node_.callbacks_in_flight_.fetch_add(1);
+            entered_ = node_.accepting_callbacks_.load();
+        }
+
+        ~CallbackGuard() { node_.callbacks_in_flight_.fetch_sub(1); }
+
+        CallbackGuard(const CallbackGuard&) = delete;
+        CallbackGuard& operator=(const CallbackGuard&) = delete;
+
+        explicit operator bool() const { return entered_; }
+
+    private:
+        EosRosNode& node_;
+        bool entered_;
+    };
+
+    /// @p callback as a subscription callback, behind a CallbackGuard
+    template <typename Message>
+    std::function<void(std::shared_ptr<const Message>)> guarded(
+        void (EosRosNode::*callback)(std::shared_ptr<const Message>))
+    {
+        return [this, callback](std::shared_ptr<const Message> msg) {
+            const CallbackGuard guard(*this);
+            if (guard) {
+                (this->*callback)(std::move(msg));
+            }
+        };
+    }
+
+    /// @p callback as a timer callback, behind a CallbackGuard
+    std::function<void()> guarded(void (EosRosNode::*callback)())
+    {
+        return [this, callback]() {
+            const CallbackGuard guard(*this);
+            if (guard) {
+                (this->*callback)();
+            }
+        };
+    }
+
+    bool standalone_ = false;  ///< spun by spin_standalone(), not a container
+
+    /**
+     * @brief Create the hot-path logger with one child logger per subsystem
+     *
+     * A subsystem logs at debug if its enable_*_debug flag is set and at
+     * debug.log_level otherwise; its child logger is set to match so the
+     * records the queue lets through are not filtered again.
+     */
+    void initialize_hot_log()
+    {
+        const eos::LogLevel base_level =
+            eos::parse_log_level(this->get_parameter("debug.log_level").as_string());
+        const std::array<std::pair<eos::LogSubsystem, const char*>, 3> flags{{
+            {eos::LogSubsystem::Perception, "debug.enable_perception_debug"},
+            {eos::LogSubsystem::Neural, "debug.enable_neural_debug"},
+            {eos::LogSubsystem::Navigation, "debug.enable_navigation_debug"},
+        }};
+        
+        std::array<rclcpp::Logger, static_cast<std::size_t>(eos::LogSubsystem::Count)> loggers{{
+            this->get_logger().get_child(eos::to_string(eos::LogSubsystem::Perception)),
+            this->get_logger().get_child(eos::to_string(eos::LogSubsystem::Neural)),
+            this->get_logger().get_child(eos::to_string(eos::LogSubsystem::Navigation)),
+        }};
+        std::array<eos::LogLevel, static_cast<std::size_t>(eos::LogSubsystem::Count)> levels{};
+        for (const auto& [subsystem, flag] : flags) {
+            const auto index = static_cast<std::size_t>(subsystem);
+            levels[index] = this->get_parameter(flag).as_bool() ? eos::LogLevel::Debug : base_level;
+            loggers[index].set_level(to_rclcpp_level(levels[index]));
+        }
+        
+        const auto queue_size = static_cast<std::size_t>(
+            std::max<std::int64_t>(this->get_parameter("debug.log_queue_size").as_int(), 2));
+        hot_log_ = std::make_unique<eos::AsyncLog>(
+            queue_size,
+            [loggers](eos::LogLevel level, eos::LogSubsystem subsystem, const std::string& text) {
+                const rclcpp::Logger& logger = loggers[static_cast<std::size_t>(subsystem)];
+                switch (level) {
+                    case eos::LogLevel::Debug: RCLCPP_DEBUG(logger, "%s", text.c_str()); break;
+                    case eos::LogLevel::Info: RCLCPP_INFO(logger, "%s", text.c_str()); break;
+                    case eos::LogLevel::Warn: RCLCPP_WARN(logger, "%s", text.c_str()); break;
+                    case eos::LogLevel::Error: RCLCPP_ERROR(logger, "%s", text.c_str()); break;
+                    case eos::LogLevel::Off: break;
+                }
+            });
+        for (const auto& [subsystem, flag] : flags) {
+            hot_log_->set_level(subsystem, levels[static_cast<std::size_t>(subsystem)]);
+        }
+    }
+
+    static rclcpp::Logger::Level to_rclcpp_level(eos::LogLevel level)
+    {
+        switch (level) {
+            case eos::LogLevel::Debug: return rclcpp::Logger::Level::Debug;
+            case eos::LogLevel::Info: return rclcpp::Logger::Level::Info;
+            case eos::LogLevel::Warn: return rclcpp::Logger::Level::Warn;
+            case eos::LogLevel::Error: return rclcpp::Logger::Level::Error;
+            case eos::LogLevel::Off: break;
+        }
+        return rclcpp::Logger::Level::Fatal;
+    }
+
+    /**
+     * @brief Declare executor parameters and read the executor type
+     */
+    void declare_executor_parameters()
+    {
+        this->declare_parameter<std::string>("executor.type", "single_threaded");
+        this->declare_parameter<int>("executor.threads", 0);
+        for (const char* group : {"sensing", "inference", "control", "status"}) {
+            this->declare_parameter<int>(std::string("executor.") + group + ".cpu_affinity", -1);
+            this->declare_parameter<int>(std::string("executor.") + group + ".priority", 0);
+        }
+        
+        executor_config_.type = eos::parse_executor_type(
+            this->get_parameter("executor.type").as_string());
+        executor_config_.threads = size_parameter("executor.threads", 0);
+    }
+
+    /**
+     * @brief Declare @p name, falling back to the older key @p legacy
+     * 
+     * @p legacy is declared too and its value becomes the default of
+     * @p name, so launch files that still set it keep working and a value
+     * given for @p name wins over it.
+     */
+    template <typename T>
+    T declare_renamed(const std::string& name, const std::string& legacy, const T& default_value)
+    {
+        const T fallback = this->declare_parameter<T>(legacy, default_value);
+        return this->declare_parameter<T>(name, fallback);
+    }
+
+    /**
+     * @brief Read an integer parameter that sizes something, e.g. a layer or a queue
+     * 
+     * @throws std::invalid_argument if it is below @p minimum
+     */
+    std::size_t size_parameter(const std::string& name, std::int64_t minimum = 1) const
+    {
+        const std::int64_t value = this->get_parameter(name).as_int();
+        if (value < minimum) {
+            throw std::invalid_argument(name + " must be at least " + std::to_string(minimum) +
+                                        ", got " + std::to_string(value));
+        }
+        return static_cast<std::size_t>(value);
+    }
+
+    /// Scan stamps identify the scan an event belongs to in the trace
+    static std::uint64_t trace_stamp(const builtin_interfaces::msg::Time& stamp)
+    {
+        return static_cast<std::uint64_t>(rclcpp::Time(stamp).nanoseconds());
+    }
+
+    /**
+     * @brief Write the trace rings to @p path, logging the outcome
+     */
+    bool dump_trace(const std::string& path, std::uint32_t& events, std::string& message)
     {
         try {
-            // Initialize neural bridge
-            neural_bridge_ = std::make_unique<NeuralBridge>(model_path);
-            
-            // Initialize navigation controller
-            navigation_controller_ = std::make_unique<NavigationController>();
-            
-            RCLCPP_INFO(this->get_logger(), "Components initialized successfully");
-            is_operational_ = true;
+            events = static_cast<std::uint32_t>(eos::trace::write_chrome_trace(path));
+            message = "Wrote " + std::to_string(events) + " trace events to " + path;
+            RCLCPP_INFO(this->get_logger(), "%s", message.c_str());
+            return true;
         }
         catch (const std::exception& e) {
-            RCLCPP_ERROR(this->get_logger(), "Failed to initialize components: %s", e.what());
-            is_operational_ = false;
+            message = e.what();
+            RCLCPP_ERROR(this->get_logger(), "Trace dump failed: %s", message.c_str());
+            return false;
+        }
+    }
+
+    /// Model id reported on /eos/status: the file name of the .eosm path
+    static std::string model_id_of(const std::string& path)
+    {
+        const std::size_t slash = path.find_last_of('/');
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    void set_model_id(const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(model_id_mutex_);
+        model_id_ = id;
+        staged_model_id_ = id;
+    }
+
+    /// True if executor.* asks for more than the default single-threaded executor
+    bool executor_settings_customized() const
+    {
+        if (executor_config_.type != eos::ExecutorType::SingleThreaded) {
+            return true;
+        }
+        return std::any_of(group_schedules_.begin(), group_schedules_.end(),
+                           [](const eos::CallbackGroupSchedule& schedule) {
+                               return schedule.cpu >= 0 || schedule.priority != 0;
+                           });
+    }
+
+    /**
+     * @brief Read the neural.trigger_mode / rate / deadline / sync parameters
+     */
+    void initialize_inference_trigger()
+    {
+        const std::string mode = this->get_parameter("neural.trigger_mode").as_string();
+        if (mode != "timer" && mode != "scan") {
+            throw std::invalid_argument(
+                "Unknown neural.trigger_mode '" + mode + "', expected timer or scan");
+        }
+        scan_triggered_inference_ = mode == "scan";
+        
+        const auto to_ns = [](double seconds) {
+            return static_cast<std::int64_t>(seconds * 1e9);
+        };
+        const double max_rate = this->get_parameter("neural.max_trigger_rate").as_double();
+        
+        eos::InferenceTriggerConfig config;
+        config.min_interval_ns = max_rate > 0.0 ? to_ns(1.0 / max_rate) : 0;
+        config.deadline_ns = to_ns(this->get_parameter("neural.deadline").as_double());
+        config.sync_imu = this->get_parameter("neural.sync_imu").as_bool();
+        config.sync_slop_ns = to_ns(this->get_parameter("neural.sync_slop").as_double());
+        inference_trigger_ = eos::InferenceTrigger(config);
+        
+        RCLCPP_INFO(this->get_logger(), "Inference triggered by %s (max %.1f Hz, deadline %.0f ms)",
+                    scan_triggered_inference_ ? "scan arrival" : "timer", max_rate,
+                    config.deadline_ns / 1e6);
+    }
+
+    /**
+     * @brief Create one mutually exclusive callback group per pipeline stage
+     */
+    void initialize_callback_groups()
+    {
+        const auto make_group = [this](const std::string& name) {
+            auto group = this->create_callback_group(
+                rclcpp::CallbackGroupType::MutuallyExclusive);
+            eos::CallbackGroupSchedule schedule;
+            schedule.name = name;
+            schedule.group = group;
+            schedule.cpu = this->get_parameter("executor." + name + ".cpu_affinity").as_int();
+            schedule.priority = this->get_parameter("executor." + name + ".priority").as_int();
+            group_schedules_.push_back(schedule);
+            return group;
+        };
+        
+        sensing_group_ = make_group("sensing");
+        inference_group_ = make_group("inference");
+        control_group_ = make_group("control");
+        status_group_ = make_group("status");
+    }
+
+    /**
+     * @brief Build the engine and its buffers; the expensive part of configuring
+     */
+    std::unique_ptr<eos::NeuralBridge> make_neural_bridge() const
+    {
+        return std::make_unique<eos::NeuralBridge>(model_path_, neural_config_, scan_config_,
+                                                   backend_type_);
+    }
+
+    /**
+     * @brief Start building the engine on a background thread
+     * 
+     * on_configure collects the result, so loading overlaps with the rest
+     * of process startup and with other nodes coming up.
+     */
+    void start_model_preload()
+    {
+        preloaded_bridge_ = std::async(std::launch::async, [this]() {
+            return make_neural_bridge();
+        });
+    }
+
+    /**
+     * @brief Configure then activate, for deployments without a lifecycle manager
+     */
+    void autostart()
+    {
+        autostart_timer_->cancel();
+        autostart_timer_.reset();
+        
+        if (this->configure().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+            RCLCPP_ERROR(this->get_logger(), "Autostart: configure failed, staying unconfigured");
+            return;
+        }
+        this->activate();
+    }
+
+    /**
+     * @brief Initialize neural and navigation components
+     * 
+     * Throws if the engine cannot be built.
+     */
+    void initialize_components()
+    {
+        eos::StatusEncoderConfig status_config;
+        status_config.delta = this->get_parameter("status.delta_encoding").as_bool();
+        status_config.keyframe_interval = static_cast<std::uint32_t>(
+            std::max<std::int64_t>(this->get_parameter("status.keyframe_interval").as_int(), 0));
+        status_config.deadband_us = static_cast<std::uint32_t>(
+            std::max<std::int64_t>(this->get_parameter("status.latency_deadband_us").as_int(), 0));
+        status_encoder_ = std::make_unique<eos::StatusDeltaEncoder>(status_config);
+        
+        // Initialize scan preprocessing and the snapshot that carries its output
+        scan_preprocessor_ = std::make_unique<eos::ScanPreprocessor>(scan_config_);
+        sensor_snapshot_ = std::make_unique<eos::SensorSnapshot>(scan_config_.bins);
+        
+        eos::PoseEkfConfig ekf_config;
+        ekf_config.odom_position_stddev =
+            this->get_parameter("localization.odom_position_stddev").as_double();
+        ekf_config.odom_heading_stddev =
+            this->get_parameter("localization.odom_heading_stddev").as_double();
+        ekf_config.odom_velocity_stddev =
+            this->get_parameter("localization.odom_velocity_stddev").as_double();
+        ekf_config.gyro_stddev = this->get_parameter("localization.gyro_stddev").as_double();
+        pose_ekf_ = std::make_unique<eos::PoseEkf>(ekf_config);
+        max_extrapolation_ = this->get_parameter("localization.max_extrapolation").as_double();
+        
+        eos::EmergencyStopConfig stop_config;
+        stop_config.stop_distance = this->get_parameter("navigation.emergency_stop_distance").as_double();
+        stop_config.release_distance =
+            this->get_parameter("navigation.emergency_release_distance").as_double();
+        stop_config.half_angle = this->get_parameter("navigation.emergency_stop_half_angle").as_double();
+        stop_config.recovery_turn_rate =
+            this->get_parameter("navigation.emergency_stop_recovery_turn_rate").as_double();
+        emergency_stop_ = std::make_unique<eos::EmergencyStop>(stop_config);
+        
+        if (this->get_parameter("memory.enabled").as_bool()) {
+            initialize_memory();
+        }
+        
+        // Initialize navigation controller
+        if (!rust_navigation_) {
+            navigation_controller_ = std::make_unique<eos::NavigationController>(navigation_config());
+            occupancy_grid_ = std::make_unique<eos::OccupancyGrid>(map_config());
+            // Clearance scores saturate at safety_distance beyond the radius
+            const auto& planner = navigation_controller_->config();
+            distance_field_ = std::make_unique<eos::DistanceField>(
+                *occupancy_grid_, planner.robot_radius + planner.safety_distance);
+            navigation_controller_->use_map(distance_field_.get());
+            RCLCPP_INFO(this->get_logger(),
+                        "Navigation: dynamic window over %zu precomputed rollouts, %.1f s horizon; "
+                        "%zu x %zu cell map at %.2f m",
+                        navigation_controller_->lattice_size(),
+                        navigation_controller_->config().horizon, occupancy_grid_->cells(),
+                        occupancy_grid_->cells(), occupancy_grid_->resolution());
+        }
+#if defined(EOS_WITH_RUST_CORE)
+        if (rust_navigation_) {
+            EosNavigationParams params{};
+            params.max_linear_velocity = static_cast<float>(max_velocity_);
+            params.max_angular_velocity =
+                this->get_parameter("navigation.max_angular_velocity").as_double();
+            params.max_acceleration = this->get_parameter("navigation.max_acceleration").as_double();
+            params.safety_distance = static_cast<float>(safety_distance_);
+            params.goal_tolerance = this->get_parameter("navigation.goal_tolerance").as_double();
+            params.obstacle_inflation =
+                this->get_parameter("navigation.obstacle_inflation").as_double();
+            rust_navigator_ = std::make_unique<eos::RustNavigator>(params);
+            RCLCPP_INFO(this->get_logger(), "Navigation: Rust core, linked in-process");
+        }
+#endif
+        
+        RCLCPP_INFO(this->get_logger(), "Scan preprocessing: %zu %s bins, %s kernels",
+                    scan_config_.bins, binning_name_.c_str(), eos::kernels::instruction_set());
+        
+        if (client_mode_) {
+            server_request_.features.assign(scan_config_.bins, 0.0f);
+            size_neural_output(neural_config_.output_size);
+            RCLCPP_INFO(this->get_logger(), "Inference delegated to eos_inference_server (%zu -> %zu)",
+                        neural_config_.input_size, neural_config_.output_size);
+            set_model_id("eos_inference_server");
+            RCLCPP_INFO(this->get_logger(), "Components initialized successfully");
+            return;
+        }
+        
+        // Initialize neural bridge, from the preload if one is running
+        neural_bridge_ = preloaded_bridge_.valid() ? preloaded_bridge_.get() : make_neural_bridge();
+        size_neural_output(neural_bridge_->output_size());
+        
+        RCLCPP_INFO(this->get_logger(),
+                    "LIF engine on %s: %zu inputs, %zu x %zu hidden, %zu outputs, %zu time steps, %s propagation",
+                    eos::to_string(backend_type_), neural_config_.input_size,
+                    neural_config_.hidden_layers, neural_config_.hidden_neurons,
+                    neural_config_.output_size, neural_config_.time_steps,
+                    propagation_mode_name_.c_str());
+        const auto& model = neural_bridge_->backend().model();
+        if (model->memory_mapped()) {
+            RCLCPP_INFO(this->get_logger(), "Model %s mapped in place (%zu KiB of weights)",
+                        model_path_.c_str(), model->weight_bytes() / 1024);
+            set_model_id(model_id_of(model_path_));
+        } else {
+            RCLCPP_WARN(this->get_logger(), "Model %s not found, using weights seeded from %u",
+                        model_path_.c_str(), neural_config_.seed);
+            set_model_id("seeded-" + std::to_string(neural_config_.seed));
+        }
+        RCLCPP_INFO(this->get_logger(), "Components initialized successfully");
+    }
+
+    /**
+     * @brief Create the topological memory and replay its journal, if any
+     *
+     * A journal that cannot be opened leaves the memory running without
+     * persistence rather than failing configuration.
+     */
+    void initialize_memory()
+    {
+        eos::TopologicalMemoryConfig config;
+        config.trajectory_length = static_cast<std::size_t>(
+            std::max<std::int64_t>(this->get_parameter("memory.trajectory_length").as_int(), 0));
+        config.node_spacing = this->get_parameter("memory.node_spacing").as_double();
+        config.loop_closure_radius = this->get_parameter("memory.loop_closure_radius").as_double();
+        config.loop_closure_heading = this->get_parameter("memory.loop_closure_heading").as_double();
+        config.loop_closure_min_separation = static_cast<std::size_t>(std::max<std::int64_t>(
+            this->get_parameter("memory.loop_closure_min_separation").as_int(), 0));
+        config.max_nodes = static_cast<std::size_t>(
+            std::max<std::int64_t>(this->get_parameter("memory.max_nodes").as_int(), 0));
+        memory_ = std::make_unique<eos::TopologicalMemory>(config);
+        
+        const std::string journal_path = this->get_parameter("memory.journal_path").as_string();
+        memory_persistence_interval_ns_ = static_cast<std::int64_t>(
+            this->get_parameter("memory.persistence_interval").as_double() * 1e9);
+        if (!journal_path.empty()) {
+            try {
+                memory_journal_ = std::make_unique<eos::MemoryJournal>(journal_path, *memory_);
+            }
+            catch (const std::exception& e) {
+                RCLCPP_WARN(this->get_logger(), "Memory not persisted: %s", e.what());
+            }
+        }
+        memory_persisted_ns_ = eos::trace::now_ns();
+        RCLCPP_INFO(this->get_logger(),
+                    "Memory: %zu nodes and %zu loop closures restored, node every %.2f m, "
+                    "journal %s",
+                    memory_->nodes().size(), memory_->loop_closures().size(), config.node_spacing,
+                    memory_journal_ ? journal_path.c_str() : "off");
+    }
+
+    /**
+     * @brief Drop the sensor and goal subscriptions
+     */
+    void release_subscriptions()
+    {
+        laser_subscription_.reset();
+        imu_subscription_.reset();
+        odom_subscription_.reset();
+        goal_subscription_.reset();
+        server_result_subscription_.reset();
+    }
+
+    void stop_timers()
+    {
+        for (auto* timer : {&neural_timer_, &navigation_timer_, &status_timer_, &metrics_timer_,
+                             &memory_timer_}) {
+            if (*timer) {
+                (*timer)->cancel();
+            }
+        }
+    }
+
+    /**
+     * @brief Undo on_configure (and on_activate, if still active)
+     */
+    void release_resources()
+    {
+        is_operational_ = false;
+        accepting_callbacks_ = false;
+        stop_timers();
+        release_subscriptions();
+        // A multi-threaded executor may still be running callbacks that
+        // passed their checks; everything below is only torn down once they
+        // have returned
+        while (callbacks_in_flight_.load() != 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        // The loader answers its queued requests through the service, so it goes first
+        model_loader_.reset();
+        load_model_service_.reset();
+        dump_trace_service_.reset();
+        neural_timer_.reset();
+        navigation_timer_.reset();
+        status_timer_.reset();
+        metrics_timer_.reset();
+        memory_timer_.reset();
+        persist_memory();
+        memory_journal_.reset();
+        memory_.reset();
+        cmd_vel_publisher_.reset();
+        status_publisher_.reset();
+        goal_publisher_.reset();
+        neural_output_publisher_.reset();
+        metrics_publisher_.reset();
+        server_request_publisher_.reset();
+        navigation_controller_.reset();
+        emergency_stop_.reset();
+        pose_ekf_.reset();
+        distance_field_.reset();
+        occupancy_grid_.reset();
+        navigation_scan_sequence_ = 0;
+#if defined(EOS_WITH_RUST_CORE)
+        rust_navigator_.reset();
+#endif
+        neural_bridge_.reset();
+        sensor_snapshot_.reset();
+        scan_preprocessor_.reset();
+        status_encoder_.reset();
+        status_msg_ = eos_robotics::msg::EosStatus();
+        scans_received_ = 0;
+        scans_inferred_ = 0;
+        inferences_completed_ = 0;
+        reported_inferences_ = 0;
+        reported_inferences_ns_ = 0;
+        sent_model_id_.clear();
+        inference_scan_stamp_ns_ = 0;
+        imu_stamps_ = eos::StampHistory();
+        laser_stamp_ns_ = 0;
+    }
+
+    template <typename Function>
+    void for_each_publisher(Function&& function)
+    {
+        function(cmd_vel_publisher_);
+        function(status_publisher_);
+        function(goal_publisher_);
+        function(neural_output_publisher_);
+        function(metrics_publisher_);
+        if (server_request_publisher_) {
+            function(server_request_publisher_);
         }
     }
 
     /**
      * @brief Initialize ROS2 publishers
+     *
+     * Topic and service names are relative: in the root namespace they are
+     * /cmd_vel, /eos/status and so on, and under /robot_3 every robot of a
+     * fleet process gets its own.
      */
     void initialize_publishers()
     {
+        const auto params = this->get_node_parameters_interface();
+        
         // Command velocity publisher for robot control
+        const auto cmd_vel_qos = eos::declare_topic_qos(params, "cmd_vel", default_qos_);
         cmd_vel_publisher_ = this->create_publisher<geometry_msgs::msg::Twist>(
-            "/cmd_vel", 10);
+            "cmd_vel", cmd_vel_qos, publisher_options(cmd_vel_qos));
         
-        // Status publisher for system monitoring
-        status_publisher_ = this->create_publisher<std_msgs::msg::String>(
-            "/eos/status", 10);
+        // Typed status for fleet telemetry
+        const auto status_qos = eos::declare_topic_qos(params, "status", default_qos_);
+        status_publisher_ = this->create_publisher<eos_robotics::msg::EosStatus>(
+            "eos/status", status_qos, publisher_options(status_qos));
         
         // Goal publisher for navigation (optional)
+        const auto goal_qos = eos::declare_topic_qos(params, "goal", default_qos_);
         goal_publisher_ = this->create_publisher<geometry_msgs::msg::PoseStamped>(
-            "/eos/goal", 10);
+            "eos/goal", goal_qos, publisher_options(goal_qos));
+        
+        // Neural output publisher for co-located consumers (bridge, RViz tooling)
+        const auto neural_output_qos = eos::declare_topic_qos(params, "neural_output", default_qos_);
+        neural_output_publisher_ = this->create_publisher<std_msgs::msg::Float32MultiArray>(
+            "eos/neural_output", neural_output_qos, publisher_options(neural_output_qos));
+        
+        // Latency histograms and loop overruns for diagnostics tooling
+        const auto metrics_qos = eos::declare_topic_qos(params, "metrics", default_qos_);
+        metrics_publisher_ = this->create_publisher<diagnostic_msgs::msg::DiagnosticArray>(
+            "eos/metrics", metrics_qos, publisher_options(metrics_qos));
+        
+        // Client mode: requests to the shared inference server
+        if (client_mode_) {
+            const auto request_qos = eos::declare_topic_qos(params, "neural_input", eos::sensor_qos_defaults());
+            server_request_publisher_ = this->create_publisher<eos_robotics::msg::NeuralInput>(
+                "eos/neural_input", request_qos, publisher_options(request_qos));
+        }
 
         RCLCPP_INFO(this->get_logger(), "Publishers initialized");
     }
 
+    /**
+     * @brief Declare the subscription profiles
+     * 
+     * Subscriptions are only created on activate; their profiles are read on
+     * configure so that a bad ros.qos.* entry fails configuring instead.
+     */
+    void declare_subscription_qos()
+    {
+        const auto params = this->get_node_parameters_interface();
+        
+        // Sensors default to best-effort keep-last-1 so stale data never queues
+        laser_qos_ = eos::declare_topic_qos(params, "laser_scan", eos::sensor_qos_defaults());
+        imu_qos_ = eos::declare_topic_qos(params, "imu", eos::sensor_qos_defaults());
+        odom_qos_ = eos::declare_topic_qos(params, "odometry", eos::sensor_qos_defaults());
+        set_goal_qos_ = eos::declare_topic_qos(params, "set_goal", default_qos_);
+        if (client_mode_) {
+            result_qos_ = eos::declare_topic_qos(params, "neural_result", eos::sensor_qos_defaults());
+        }
+    }
+
     /**
      * @brief Initialize ROS2 subscribers
      */
     void initialize_subscribers()
     {
+        // Sensor callbacks share one group so SensorSnapshot has a single producer;
+        // goals update controller state, so they run alongside the control loop
+        
         // Laser scan subscriber for obstacle detection
         laser_subscription_ = this->create_subscription<sensor_msgs::msg::LaserScan>(
-            "/scan", 10,
-            [this](const sensor_msgs::msg::LaserScan::SharedPtr msg) {
-                this->laser_callback(msg);
-            });
+            "scan", laser_qos_,
+            guarded(&EosRosNode::laser_callback),
+            subscription_options(sensing_group_, laser_qos_));
         
         // IMU subscriber for orientation and acceleration
         imu_subscription_ = this->create_subscription<sensor_msgs::msg::Imu>(
-            "/imu", 10,
-            [this](const sensor_msgs::msg::Imu::SharedPtr msg) {
-                this->imu_callback(msg);
-            });
+            "imu", imu_qos_,
+            guarded(&EosRosNode::imu_callback),
+            subscription_options(sensing_group_, imu_qos_));
         
         // Odometry subscriber for position tracking
         odom_subscription_ = this->create_subscription<nav_msgs::msg::Odometry>(
-            "/odom", 10,
-            [this](const nav_msgs::msg::Odometry::SharedPtr msg) {
-                this->odom_callback(msg);
-            });
+            "odom", odom_qos_,
+            guarded(&EosRosNode::odom_callback),
+            subscription_options(sensing_group_, odom_qos_));
         
         // Goal subscriber for receiving navigation goals
         goal_subscription_ = this->create_subscription<geometry_msgs::msg::PoseStamped>(
-            "/eos/set_goal", 10,
-            [this](const geometry_msgs::msg::PoseStamped::SharedPtr msg) {
-                this->goal_callback(msg);
-            });
+            "eos/set_goal", set_goal_qos_,
+            guarded(&EosRosNode::goal_callback),
+            subscription_options(control_group_, set_goal_qos_));
+        
+        // Client mode: results from the inference server are handled like a
+        // local inference finishing, on the inference group
+        if (client_mode_) {
+            server_result_subscription_ = this->create_subscription<eos_robotics::msg::NeuralOutput>(
+                "eos/neural_result", result_qos_,
+                guarded(&EosRosNode::server_result_callback),
+                subscription_options(inference_group_, result_qos_));
+        }
 
         RCLCPP_INFO(this->get_logger(), "Subscribers initialized");
     }
 
+    /**
+     * @brief Publisher options matching a QoS profile
+     */
+    rclcpp::PublisherOptions publisher_options(const rclcpp::QoS& qos) const
+    {
+        rclcpp::PublisherOptions options;
+        options.use_intra_process_comm = eos::intra_process_setting(qos);
+        return options;
+    }
+
+    /**
+     * @brief Subscription options for a callback group and QoS profile
+     */
+    rclcpp::SubscriptionOptions subscription_options(
+        const rclcpp::CallbackGroup::SharedPtr& group, const rclcpp::QoS& qos) const
+    {
+        rclcpp::SubscriptionOptions options;
+        options.callback_group = group;
+        options.use_intra_process_comm = eos::intra_process_setting(qos);
+        return options;
+    }
+
     /**
      * @brief Initialize timers for periodic processing
      */
     void initialize_timers()
     {
-        // Neural processing timer
-        auto neural_interval = std::chrono::duration<double>(1.0 / neural_update_rate_);
-        neural_timer_ = this->create_wall_timer(
-            neural_interval,
-            [this]() { this->neural_processing_callback(); });
+        // Neural processing timer; when scans trigger inference it is a
+        // cancelled zero-period timer that laser_callback resets, so the
+        // inference group wakes once per scan without subscribing to it
+        if (!scan_triggered_inference_) {
+            auto neural_interval = std::chrono::duration<double>(1.0 / neural_update_rate_);
+            neural_timer_ = this->create_wall_timer(
+                neural_interval,
+                guarded(&EosRosNode::neural_processing_callback),
+                inference_group_);
+        } else {
+            neural_timer_ = this->create_wall_timer(
+                std::chrono::nanoseconds(0),
+                guarded(&EosRosNode::scan_trigger_callback),
+                inference_group_);
+            neural_timer_->cancel();
+        }
         
         // Navigation control timer
         auto nav_interval = std::chrono::duration<double>(1.0 / navigation_update_rate_);
         navigation_timer_ = this->create_wall_timer(
             nav_interval,
-            [this]() { this->navigation_control_callback(); });
+            guarded(&EosRosNode::navigation_control_callback),
+            control_group_);
         
-        // Status publishing timer (1Hz)
+        // Status publishing at status.rate; it also reclaims swapped-out models
         status_timer_ = this->create_wall_timer(
-            std::chrono::seconds(1),
-            [this]() { this->status_publishing_callback(); });
+            std::chrono::duration<double>(1.0 / (status_rate_ > 0.0 ? status_rate_ : 1.0)),
+            guarded(&EosRosNode::status_publishing_callback),
+            status_group_);
+        
+        // Memory updates share the control group, so they read its snapshot channel
+        if (memory_) {
+            const double memory_rate = this->get_parameter("memory.update_rate").as_double();
+            memory_timer_ = this->create_wall_timer(
+                std::chrono::duration<double>(1.0 / (memory_rate > 0.0 ? memory_rate : 5.0)),
+                guarded(&EosRosNode::memory_update_callback),
+                control_group_);
+        }
+        
+        // Metrics publishing (and profile dumps) alongside status
+        if (metrics_rate_ > 0.0) {
+            metrics_timer_ = this->create_wall_timer(
+                std::chrono::duration<double>(1.0 / metrics_rate_),
+                guarded(&EosRosNode::metrics_publishing_callback),
+                status_group_);
+        }
+
+        // Timers start on activation
+        stop_timers();
 
         RCLCPP_INFO(this->get_logger(), "Timers initialized");
     }
 
+    /**
+     * @brief (Re)start jitter and overrun tracking for the periodic callbacks
+     * 
+     * Called on activation so time spent inactive is not counted as jitter.
+     */
+    void configure_loop_monitors()
+    {
+        const auto period_ns = [](double rate) {
+            return static_cast<std::int64_t>(1e9 / rate);
+        };
+        if (!scan_triggered_inference_) {
+            metrics_.configure_loop(eos::MonitoredLoop::Inference, period_ns(neural_update_rate_),
+                                    eos::LatencyMetric::InferenceJitter);
+        }
+        metrics_.configure_loop(eos::MonitoredLoop::Navigation, period_ns(navigation_update_rate_),
+                                eos::LatencyMetric::NavigationJitter);
+    }
+
     /**
      * @brief Initialize ROS2 services for external control
      */
     void initialize_services()
     {
-        // Services would be implemented here for:
-        // - Starting/stopping navigation
-        // - Loading new neural models
-        // - Emergency stop
-        // - System configuration
+        // Trace dumps run on the status group, never on a pipeline thread
+        dump_trace_service_ = this->create_service<eos_robotics::srv::DumpTrace>(
+            "eos/dump_trace",
+            [this](const std::shared_ptr<eos_robotics::srv::DumpTrace::Request> request,
+                   std::shared_ptr<eos_robotics::srv::DumpTrace::Response> response) {
+                const CallbackGuard guard(*this);
+                if (!guard) {
+                    response->success = false;
+                    response->message = "node is shutting down";
+                    return;
+                }
+                const std::string& path = request->path.empty() ? trace_dump_path_ : request->path;
+                response->success = dump_trace(path, response->events, response->message);
+            },
+            rmw_qos_profile_services_default,
+            status_group_);
+        
+        // Hot model reload: the service only queues the request; loading runs
+        // on the loader thread and the response is sent from there. Clients
+        // have no model; the inference server owns it
+        if (client_mode_) {
+            RCLCPP_INFO(this->get_logger(), "Services initialized (no /eos/load_model in client mode)");
+            return;
+        }
+        model_loader_ = std::make_unique<eos::ModelLoader>(*neural_bridge_);
+        load_model_service_ = this->create_service<eos_robotics::srv::LoadModel>(
+            "eos/load_model",
+            [this](std::shared_ptr<rmw_request_id_t> header,
+                   std::shared_ptr<eos_robotics::srv::LoadModel::Request> request) {
+                const CallbackGuard guard(*this);
+                if (guard) {
+                    this->load_model_callback(std::move(header), std::move(request));
+                }
+            },
+            rmw_qos_profile_services_default,
+            status_group_);
         
-        RCLCPP_INFO(this->get_logger(), "Services placeholder initialized");
+        // Still to come: starting/stopping navigation, emergency stop,
+        // system configuration
+        
+        RCLCPP_INFO(this->get_logger(), "Services initialized");
     }
 
     // =========================================================================
@@ -271,24 +1392,58 @@ private:
     /**
      * @brief Callback for laser scan data
      */
-    void laser_callback(const sensor_msgs::msg::LaserScan::SharedPtr msg)
+    void laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr msg)
     {
-        current_laser_scan_ = msg;
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::LaserCallback);
         
-        // Log first and last range for debugging
+        // Log first and last range for debugging, at most once a second
         if (!msg->ranges.empty()) {
-            RCLCPP_DEBUG(this->get_logger(), 
+            EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Perception, eos::LogLevel::Debug, 1000, 1,
                         "Laser scan: %zu points, first: %.2f, last: %.2f",
                         msg->ranges.size(), msg->ranges.front(), msg->ranges.back());
         }
+        
+        if (!is_operational_) {
+            return;
+        }
+        scans_received_.fetch_add(1, std::memory_order_relaxed);
+        
+        // Safety first: a stop goes out before the scan is processed further.
+        // From then on the control loop only sends commands that the latch
+        // lets through (turning or reversing), so the robot can back out of
+        // the stop without a reset.
+        const bool was_stopped = emergency_stop_->stopped();
+        if (emergency_stop_->check_scan(msg->ranges.data(), msg->ranges.size(), msg->range_min,
+                                        msg->angle_min, msg->angle_increment)) {
+            if (!was_stopped) {
+                publish_cmd_vel(0.0, 0.0);
+                eos::trace::instant("emergency_stop", trace_stamp(msg->header.stamp));
+                RCLCPP_WARN(this->get_logger(), "Emergency stop: obstacle %.2f m ahead",
+                            emergency_stop_->nearest());
+            }
+        } else if (was_stopped) {
+            RCLCPP_INFO(this->get_logger(), "Emergency stop released: %.2f m clear ahead",
+                        emergency_stop_->nearest());
+        }
+        
+        // Sanitise, bin and normalise in place so inference gets ready input
+        scan_preprocessor_->process(msg->ranges.data(), msg->ranges.size(), msg->range_min,
+                                    msg->range_max, msg->angle_min, msg->angle_increment);
+        eos::trace::instant("scan_preprocessed", trace_stamp(msg->header.stamp));
+        laser_stamp_ns_ = rclcpp::Time(msg->header.stamp).nanoseconds();
+        sensor_snapshot_->stage_imu_match(imu_stamps_.nearest(laser_stamp_ns_));
+        sensor_snapshot_->publish_laser(std::move(msg), scan_preprocessor_->output());
+        if (scan_triggered_inference_) {
+            neural_timer_->reset();
+        }
     }
 
     /**
      * @brief Callback for IMU data
      */
-    void imu_callback(const sensor_msgs::msg::Imu::SharedPtr msg)
+    void imu_callback(sensor_msgs::msg::Imu::ConstSharedPtr msg)
     {
-        current_imu_ = msg;
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::ImuCallback);
         
         // Calculate magnitude of linear acceleration for basic activity monitoring
         double accel_magnitude = std::sqrt(
@@ -296,36 +1451,70 @@ private:
             msg->linear_acceleration.y * msg->linear_acceleration.y +
             msg->linear_acceleration.z * msg->linear_acceleration.z);
         
-        RCLCPP_DEBUG(this->get_logger(), "IMU acceleration magnitude: %.2f", accel_magnitude);
+        EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Perception, eos::LogLevel::Debug, 1000, 1,
+                    "IMU acceleration magnitude: %.2f", accel_magnitude);
+        
+        if (is_operational_) {
+            // The IMU is taken as mounted level and aligned with the base
+            const std::int64_t stamp_ns = rclcpp::Time(msg->header.stamp).nanoseconds();
+            pose_ekf_->add_imu(stamp_ns, msg->angular_velocity.z, msg->linear_acceleration.x);
+            sensor_snapshot_->stage_pose(pose_ekf_->estimate());
+            // Samples arriving after the scan may still be closer to its stamp
+            imu_stamps_.push(stamp_ns);
+            sensor_snapshot_->stage_imu_match(imu_stamps_.nearest(laser_stamp_ns_));
+            sensor_snapshot_->publish_imu(std::move(msg));
+        }
     }
 
     /**
      * @brief Callback for odometry data
      */
-    void odom_callback(const nav_msgs::msg::Odometry::SharedPtr msg)
+    void odom_callback(nav_msgs::msg::Odometry::ConstSharedPtr msg)
     {
-        current_odometry_ = msg;
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::OdomCallback);
         
         // Extract position for logging
         double x = msg->pose.pose.position.x;
         double y = msg->pose.pose.position.y;
         
-        RCLCPP_DEBUG(this->get_logger(), "Odometry position: (%.2f, %.2f)", x, y);
+        EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Perception, eos::LogLevel::Debug, 1000, 1,
+                    "Odometry position: (%.2f, %.2f)", x, y);
+        
+        if (is_operational_) {
+            const auto& twist = msg->twist.twist;
+            pose_ekf_->add_odometry(rclcpp::Time(msg->header.stamp).nanoseconds(), x, y,
+                                    yaw_of(msg->pose.pose.orientation), twist.linear.x,
+                                    twist.angular.z);
+            sensor_snapshot_->stage_pose(pose_ekf_->estimate());
+            sensor_snapshot_->publish_odom(std::move(msg));
+        }
     }
 
     /**
      * @brief Callback for navigation goals
      */
-    void goal_callback(const geometry_msgs::msg::PoseStamped::SharedPtr msg)
+    void goal_callback(geometry_msgs::msg::PoseStamped::ConstSharedPtr msg)
     {
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::GoalCallback);
+        
         RCLCPP_INFO(this->get_logger(), 
                     "Received new navigation goal: (%.2f, %.2f, %.2f)",
                     msg->pose.position.x, msg->pose.position.y, msg->pose.position.z);
         
         // Pass to navigation controller
         if (navigation_controller_) {
-            navigation_controller_->set_goal(*msg);
+            navigation_controller_->set_goal(eos::Pose2D{static_cast<float>(msg->pose.position.x),
+                                                         static_cast<float>(msg->pose.position.y),
+                                                         yaw_of(msg->pose.orientation)});
+        }
+#if defined(EOS_WITH_RUST_CORE)
+        if (rust_navigator_) {
+            const auto& position = msg->pose.position;
+            rust_navigator_->set_goal(EosPose2D{static_cast<float>(position.x),
+                                                static_cast<float>(position.y),
+                                                yaw_of(msg->pose.orientation)});
         }
+#endif
     }
 
     /**
@@ -333,95 +1522,653 @@ private:
      */
     void neural_processing_callback()
     {
-        if (!is_operational_ || !current_laser_scan_ || !current_imu_) {
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::InferenceCallback,
+                                   &metrics_.loop(eos::MonitoredLoop::Inference));
+        
+        if (!is_operational_) {
+            return;
+        }
+        
+        // Consistent laser/IMU/odom tuple, stable until the next acquire
+        const eos::SensorFrame& frame = sensor_snapshot_->acquire(eos::SnapshotReader::Inference);
+        if (!frame.complete()) {
+            return;
+        }
+        
+        run_inference(*frame.laser, frame.features.data(), *frame.imu, *frame.odom,
+                      frame.imu_stamp_near_laser_ns);
+    }
+
+    /**
+     * @brief Scan-triggered inference, woken by laser_callback once per scan
+     */
+    void scan_trigger_callback()
+    {
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::InferenceCallback);
+        
+        // Disarm before reading the snapshot: a scan arriving from here on
+        // wakes this callback again rather than being missed
+        neural_timer_->cancel();
+        if (!is_operational_) {
+            return;
+        }
+        
+        // The scan laser_callback has just preprocessed, with the latest
+        // IMU and odometry the sensing group has seen
+        const eos::SensorFrame& frame = sensor_snapshot_->acquire(eos::SnapshotReader::Inference);
+        if (!frame.complete()) {
+            return;
+        }
+        
+        run_inference(*frame.laser, frame.features.data(), *frame.imu, *frame.odom,
+                      frame.imu_stamp_near_laser_ns);
+    }
+
+    /**
+     * @brief Gate, run and publish one inference
+     * 
+     * @param features Preprocessed scan
+     * @param imu_match_ns Stamp of the IMU sample closest to the scan's, for neural.sync_imu
+     */
+    void run_inference(
+        const sensor_msgs::msg::LaserScan& laser,
+        const float* features,
+        const sensor_msgs::msg::Imu& imu,
+        const nav_msgs::msg::Odometry& odom,
+        std::int64_t imu_match_ns)
+    {
+        const std::int64_t laser_stamp_ns = rclcpp::Time(laser.header.stamp).nanoseconds();
+        const std::int64_t imu_stamp_ns = rclcpp::Time(imu.header.stamp).nanoseconds();
+        const std::int64_t now_ns = this->now().nanoseconds();
+        const auto decision = inference_trigger_.evaluate(laser_stamp_ns, imu_match_ns, now_ns);
+        if (decision != eos::TriggerDecision::Run) {
+            EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Neural, eos::LogLevel::Debug, 100, 1,
+                        "Inference skipped: %s", eos::to_string(decision));
+            return;
+        }
+        scans_inferred_.fetch_add(1, std::memory_order_relaxed);
+        
+        // How old each input is at the moment inference consumes it
+        metrics_.record(eos::LatencyMetric::LaserAgeAtInference, now_ns - laser_stamp_ns);
+        metrics_.record(eos::LatencyMetric::ImuAgeAtInference, now_ns - imu_stamp_ns);
+        metrics_.record(eos::LatencyMetric::OdomAgeAtInference,
+                        now_ns - rclcpp::Time(odom.header.stamp).nanoseconds());
+        
+        if (client_mode_) {
+            request_server_inference(laser, features);
             return;
         }
 
         try {
-            // Process sensor data through neural network
-            auto neural_output = neural_bridge_->process(
-                *current_laser_scan_, *current_imu_, *current_odometry_);
+            // Inference boundary: a model staged by /eos/load_model takes over here
+            if (neural_bridge_->swap_staged()) {
+                std::lock_guard<std::mutex> lock(model_id_mutex_);
+                model_id_ = staged_model_id_;
+                RCLCPP_INFO(this->get_logger(), "Switched to the newly loaded model");
+            }
+            
+            // Process sensor data through neural network, into the message
+            // allocated here, outside the guard, and handed over on publish
+            auto output = make_neural_output();
+            {
+                // Opened first so the span is recorded after the guard
+                // closes: a thread's first event allocates its ring
+                eos::trace::Scope trace("inference", static_cast<std::uint64_t>(laser_stamp_ns));
+                EOS_ASSERT_NO_ALLOCATIONS("neural_processing_callback");
+                neural_bridge_->process_features(features, imu, odom, output->data.data());
+            }
+            
+            publish_neural_output(std::move(output));
+            eos::trace::instant("inference_done", static_cast<std::uint64_t>(laser_stamp_ns));
+            inferences_completed_.fetch_add(1, std::memory_order_relaxed);
+            inference_scan_stamp_ns_.store(laser_stamp_ns, std::memory_order_relaxed);
             
-            RCLCPP_DEBUG(this->get_logger(), 
-                        "Neural processing completed, output size: %zu", 
-                        neural_output.size());
+            EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Neural, eos::LogLevel::Debug, 0, 10,
+                        "Neural processing completed, output size: %zu", neural_output_size_);
         }
         catch (const std::exception& e) {
             RCLCPP_ERROR(this->get_logger(), "Neural processing failed: %s", e.what());
         }
     }
 
+    /**
+     * @brief Client mode: send the scan features to the inference server
+     * 
+     * The request keeps the scan's stamp, which the server copies into its
+     * result, so the result is attributed to the right scan.
+     */
+    void request_server_inference(const sensor_msgs::msg::LaserScan& laser, const float* features)
+    {
+        server_request_.header = laser.header;
+        std::copy(features, features + server_request_.features.size(),
+                  server_request_.features.begin());
+        server_request_publisher_->publish(server_request_);
+    }
+
+    /**
+     * @brief Client mode: a result from the inference server
+     */
+    void server_result_callback(eos_robotics::msg::NeuralOutput::ConstSharedPtr msg)
+    {
+        if (!is_operational_) {
+            return;
+        }
+        if (msg->rates.size() != neural_output_size_) {
+            RCLCPP_WARN_THROTTLE(this->get_logger(), *this->get_clock(), 5000,
+                                 "Inference server returned %zu rates, expected %zu",
+                                 msg->rates.size(), neural_output_size_);
+            return;
+        }
+        
+        const std::int64_t scan_stamp_ns = rclcpp::Time(msg->header.stamp).nanoseconds();
+        metrics_.record(eos::LatencyMetric::ServerRoundTrip,
+                        this->now().nanoseconds() - scan_stamp_ns);
+        auto output = make_neural_output();
+        std::copy(msg->rates.begin(), msg->rates.end(), output->data.begin());
+        publish_neural_output(std::move(output));
+        eos::trace::instant("inference_done", static_cast<std::uint64_t>(scan_stamp_ns));
+        inferences_completed_.fetch_add(1, std::memory_order_relaxed);
+        inference_scan_stamp_ns_.store(scan_stamp_ns, std::memory_order_relaxed);
+    }
+
     /**
      * @brief Timer callback for navigation control
      */
     void navigation_control_callback()
     {
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::NavigationCallback,
+                                   &metrics_.loop(eos::MonitoredLoop::Navigation));
+        
         if (!is_operational_) {
             return;
         }
 
         try {
-            // Generate navigation commands based on current state
-            auto command = navigation_controller_->compute_command();
+            // Generate navigation commands from the latest scan and odometry
+            const eos::SensorFrame& frame = sensor_snapshot_->acquire(eos::SnapshotReader::Control);
+#if defined(EOS_WITH_RUST_CORE)
+            if (rust_navigator_) {
+                if (!rust_navigation_step(frame)) {
+                    return;
+                }
+            } else
+#endif
+            {
+                native_navigation_step(frame);
+            }
+            
+            // While the laser callback holds a stop, only motion that does
+            // not close on the obstacle goes out, and the planner's next
+            // window starts from rest rather than from its own command
+            if (emergency_stop_->stopped()) {
+                emergency_stop_->limit(cmd_vel_command_.linear.x, cmd_vel_command_.angular.z);
+                if (navigation_controller_) {
+                    navigation_controller_->stop();
+                }
+            }
+            publish_cmd_vel(cmd_vel_command_.linear.x, cmd_vel_command_.angular.z);
             
-            // Publish the command
-            cmd_vel_publisher_->publish(command);
+            // End-to-end latency from the scan behind the latest inference
+            const std::int64_t scan_stamp_ns = inference_scan_stamp_ns_.load(std::memory_order_relaxed);
+            if (scan_stamp_ns != 0) {
+                metrics_.record(eos::LatencyMetric::SenseToCmdVel,
+                                this->now().nanoseconds() - scan_stamp_ns);
+            }
             
-            RCLCPP_DEBUG(this->get_logger(), "Navigation control cycle completed");
+            EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Navigation, eos::LogLevel::Debug, 0, 20,
+                        "Navigation control cycle completed");
         }
         catch (const std::exception& e) {
             RCLCPP_ERROR(this->get_logger(), "Navigation control failed: %s", e.what());
             
             // Emergency stop on failure
-            auto emergency_stop = geometry_msgs::msg::Twist();
-            emergency_stop.linear.x = 0.0;
-            emergency_stop.angular.z = 0.0;
-            cmd_vel_publisher_->publish(emergency_stop);
+#if defined(EOS_WITH_RUST_CORE)
+            if (rust_navigator_) {
+                rust_navigator_->emergency_stop();
+            }
+#endif
+            publish_cmd_vel(0.0, 0.0);
         }
     }
 
     /**
-     * @brief Timer callback for status publishing
+     * @brief Timer callback feeding the fused pose into the topological memory
+     *
+     * Runs on the control group between navigation cycles; the journal is
+     * appended every memory.persistence_interval with what changed since.
+     */
+    void memory_update_callback()
+    {
+        if (!is_operational_) {
+            return;
+        }
+        const eos::SensorFrame& frame = sensor_snapshot_->acquire(eos::SnapshotReader::Control);
+        if (!frame.pose.valid) {
+            return;
+        }
+        const eos::MemoryUpdate update = memory_->observe(frame.pose.pose, frame.pose.stamp_ns);
+        if (update.loop_closed) {
+            EOS_HOT_LOG(*hot_log_, eos::LogSubsystem::Navigation, eos::LogLevel::Info, 1000, 1,
+                        "Loop closure at memory node %llu",
+                        static_cast<unsigned long long>(update.node_id));
+        }
+        const std::int64_t now_ns = eos::trace::now_ns();
+        if (now_ns - memory_persisted_ns_ >= memory_persistence_interval_ns_) {
+            memory_persisted_ns_ = now_ns;
+            persist_memory();
+        }
+    }
+
+    /**
+     * @brief Append the memory's new nodes and closures to its journal
+     */
+    void persist_memory()
+    {
+        if (!memory_ || !memory_journal_) {
+            return;
+        }
+        try {
+            memory_journal_->append(*memory_);
+        }
+        catch (const std::exception& e) {
+            RCLCPP_WARN(this->get_logger(), "Memory journal append failed: %s", e.what());
+        }
+    }
+
+    /**
+     * @brief Local planner limits and sampling from the navigation.* parameters
+     */
+    eos::NavigationControllerConfig navigation_config()
+    {
+        eos::NavigationControllerConfig config;
+        config.max_linear_velocity = max_velocity_;
+        config.max_angular_velocity = this->get_parameter("navigation.max_angular_velocity").as_double();
+        config.max_linear_acceleration = this->get_parameter("navigation.max_acceleration").as_double();
+        config.max_angular_acceleration =
+            this->get_parameter("navigation.max_angular_acceleration").as_double();
+        config.control_period = 1.0 / navigation_update_rate_;
+        config.robot_radius = this->get_parameter("navigation.obstacle_inflation").as_double();
+        config.safety_distance = safety_distance_;
+        config.goal_tolerance = this->get_parameter("navigation.goal_tolerance").as_double();
+        config.linear_samples = this->get_parameter("navigation.dwa.linear_samples").as_int();
+        config.angular_samples = this->get_parameter("navigation.dwa.angular_samples").as_int();
+        config.horizon = this->get_parameter("navigation.dwa.horizon").as_double();
+        config.rollout_step = this->get_parameter("navigation.dwa.rollout_step").as_double();
+        config.obstacle_sectors = this->get_parameter("navigation.dwa.obstacle_sectors").as_int();
+        config.goal_weight = this->get_parameter("navigation.dwa.goal_weight").as_double();
+        config.clearance_weight = this->get_parameter("navigation.dwa.clearance_weight").as_double();
+        config.velocity_weight = this->get_parameter("navigation.dwa.velocity_weight").as_double();
+        return config;
+    }
+
+    /**
+     * @brief Rolling map geometry from the navigation.map.* parameters
+     */
+    eos::OccupancyGridConfig map_config()
+    {
+        eos::OccupancyGridConfig config;
+        config.resolution = this->get_parameter("navigation.map.resolution").as_double();
+        config.cells = this->get_parameter("navigation.map.cells").as_int();
+        config.max_range = this->get_parameter("navigation.map.max_range").as_double();
+        return config;
+    }
+
+    /**
+     * @brief One tick of the native planner; scans are taken once each
+     *
+     * A new scan is integrated into the map, and the distance field catches
+     * up with the cells it changed, before planning. Only planning runs under
+     * the allocation guard: the map's beam table grows when a scan with more
+     * beams than any before it arrives.
+     */
+    void native_navigation_step(const eos::SensorFrame& frame)
+    {
+        const eos::Pose2D pose = robot_pose(frame, this->now().nanoseconds());
+        if (frame.laser && frame.laser_sequence != navigation_scan_sequence_) {
+            const auto& laser = *frame.laser;
+            // Rays start where the robot was when the scan was taken
+            const eos::Pose2D scan_pose =
+                robot_pose(frame, rclcpp::Time(laser.header.stamp).nanoseconds());
+            occupancy_grid_->recenter(pose.x, pose.y);
+            occupancy_grid_->integrate_scan(scan_pose, laser.ranges.data(), laser.ranges.size(),
+                                            laser.range_min, laser.range_max,
+                                            laser.angle_min, laser.angle_increment);
+            distance_field_->update();
+            navigation_controller_->update_scan(laser.ranges.data(), laser.ranges.size(),
+                                                laser.range_min, laser.range_max,
+                                                laser.angle_min, laser.angle_increment);
+            navigation_scan_sequence_ = frame.laser_sequence;
+        }
+
+        EOS_ASSERT_NO_ALLOCATIONS("navigation_control_callback");
+        const eos::VelocityCommand command = navigation_controller_->compute_command(pose);
+        cmd_vel_command_.linear.x = command.linear;
+        cmd_vel_command_.angular.z = command.angular;
+    }
+
+#if defined(EOS_WITH_RUST_CORE)
+    /**
+     * @brief Step the Rust planner on the latest scan and odometry
+     *
+     * The scan ranges are handed over by pointer; nothing is copied.
+     *
+     * @return false if no scan has arrived yet
+     */
+    bool rust_navigation_step(const eos::SensorFrame& frame)
+    {
+        if (!frame.laser) {
+            return false;
+        }
+
+        const auto& laser = *frame.laser;
+        const EosScan scan{laser.ranges.data(), laser.ranges.size(), laser.angle_min,
+                           laser.angle_increment, laser.range_min, laser.range_max};
+        const eos::Pose2D current = robot_pose(frame, this->now().nanoseconds());
+        const EosPose2D pose{current.x, current.y, current.theta};
+
+        // The firing rates belong to the inference group, so no guidance here
+        const EosMotionCommand command =
+            rust_navigator_->step(scan, nullptr, 0, frame.odom ? &pose : nullptr);
+        cmd_vel_command_.linear.x = command.linear;
+        cmd_vel_command_.angular.z = command.angular;
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Filtered pose extrapolated to @p stamp_ns, or raw odometry
+     *        until the filter has started
+     */
+    eos::Pose2D robot_pose(const eos::SensorFrame& frame, std::int64_t stamp_ns) const
+    {
+        return frame.pose.valid ? frame.pose.at(stamp_ns, max_extrapolation_) : odom_pose(frame);
+    }
+
+    /**
+     * @brief Robot pose from the frame's odometry; the origin before any arrives
+     */
+    static eos::Pose2D odom_pose(const eos::SensorFrame& frame)
+    {
+        if (!frame.odom) {
+            return eos::Pose2D{};
+        }
+        const auto& pose = frame.odom->pose.pose;
+        return eos::Pose2D{static_cast<float>(pose.position.x), static_cast<float>(pose.position.y),
+                           yaw_of(pose.orientation)};
+    }
+
+    static float yaw_of(const geometry_msgs::msg::Quaternion& q)
+    {
+        return static_cast<float>(std::atan2(2.0 * (q.w * q.z + q.x * q.y),
+                                             1.0 - 2.0 * (q.y * q.y + q.z * q.z)));
+    }
+
+    // =========================================================================
+    // Publishing Helpers
+    // =========================================================================
+
+    /**
+     * @brief Publish a velocity command
+     * 
+     * Called from both the sensing and the control group. Each command is a
+     * new message handed over as a unique_ptr, so a co-located base
+     * controller takes it without a copy.
+     */
+    void publish_cmd_vel(double linear, double angular)
+    {
+        auto msg = std::make_unique<geometry_msgs::msg::Twist>();
+        msg->linear.x = linear;
+        msg->angular.z = angular;
+        cmd_vel_publisher_->publish(std::move(msg));
+        eos::trace::instant("cmd_vel_published");
+    }
+
+    /**
+     * @brief Set the number of firing rates each /eos/neural_output carries
+     */
+    void size_neural_output(std::size_t size)
+    {
+        neural_output_size_ = size;
+    }
+
+    /**
+     * @brief A zeroed /eos/neural_output message with its layout filled in
+     */
+    std::unique_ptr<std_msgs::msg::Float32MultiArray> make_neural_output() const
+    {
+        auto msg = std::make_unique<std_msgs::msg::Float32MultiArray>();
+        msg->layout.dim.resize(1);
+        msg->layout.dim[0].label = "firing_rate";
+        msg->layout.dim[0].size = neural_output_size_;
+        msg->layout.dim[0].stride = neural_output_size_;
+        msg->data.assign(neural_output_size_, 0.0f);
+        return msg;
+    }
+
+    /**
+     * @brief Hand @p msg to co-located subscribers and the middleware on /eos/neural_output
+     */
+    void publish_neural_output(std::unique_ptr<std_msgs::msg::Float32MultiArray> msg)
+    {
+        neural_output_publisher_->publish(std::move(msg));
+    }
+
+    /**
+     * @brief /eos/load_model: queue the load and answer once it is staged or rejected
+     */
+    void load_model_callback(
+        std::shared_ptr<rmw_request_id_t> header,
+        std::shared_ptr<eos_robotics::srv::LoadModel::Request> request)
+    {
+        RCLCPP_INFO(this->get_logger(), "Loading model %s", request->model_path.c_str());
+        
+        std::weak_ptr<rclcpp::Service<eos_robotics::srv::LoadModel>> service = load_model_service_;
+        auto logger = this->get_logger();
+        const std::string model_id = model_id_of(request->model_path);
+        model_loader_->request(
+            request->model_path,
+            [this, service, header, logger, model_id](bool success, const std::string& message) {
+                if (success) {
+                    // The loader has staged it; it becomes model_id_ when swapped in
+                    {
+                        std::lock_guard<std::mutex> lock(model_id_mutex_);
+                        staged_model_id_ = model_id;
+                    }
+                    RCLCPP_INFO(logger, "%s", message.c_str());
+                } else {
+                    RCLCPP_ERROR(logger, "Model load failed: %s", message.c_str());
+                }
+                eos_robotics::srv::LoadModel::Response response;
+                response.success = success;
+                response.message = message;
+                if (auto server = service.lock()) {
+                    server->send_response(*header, response);
+                }
+            });
+    }
+
+    /**
+     * @brief Timer callback publishing the EosStatus telemetry on /eos/status
      */
     void status_publishing_callback()
     {
-        auto status_msg = std_msgs::msg::String();
+        eos::ScopedLatency latency(metrics_, eos::LatencyMetric::StatusCallback);
         
-        if (is_operational_) {
-            status_msg.data = "Eos OS: OPERATIONAL - Neural and navigation systems active";
-        } else {
-            status_msg.data = "Eos OS: DEGRADED - System initialization incomplete";
+        // An engine replaced by a model swap is freed here, off the inference thread
+        if (neural_bridge_) {
+            neural_bridge_->reclaim_retired();
+        }
+        
+        // A SIGUSR1 only flags the dump; it is written here
+        if (eos::trace::take_dump_request()) {
+            std::uint32_t events = 0;
+            std::string message;
+            dump_trace(trace_dump_path_, events, message);
+        }
+        
+        if (status_rate_ <= 0.0) {
+            return;
+        }
+        
+        const std::int64_t now_ns = eos::NodeMetrics::now_ns();
+        const std::uint64_t inferences = inferences_completed_.load(std::memory_order_relaxed);
+        const std::uint64_t received = scans_received_.load(std::memory_order_relaxed);
+        const std::uint64_t inferred = scans_inferred_.load(std::memory_order_relaxed);
+        const eos::ProcessUsageSample usage = process_usage_.sample();
+        
+        static_assert(eos_robotics::msg::StageLatency::NAVIGATION_JITTER + 1 ==
+                          static_cast<std::size_t>(eos::LatencyMetric::Count),
+                      "StageLatency.msg stage ids must follow eos::LatencyMetric");
+        stage_samples_.clear();
+        for (std::size_t i = 0; i < static_cast<std::size_t>(eos::LatencyMetric::Count); ++i) {
+            const eos::HistogramSummary summary =
+                metrics_.histogram(static_cast<eos::LatencyMetric>(i)).summarize();
+            if (summary.count > 0) {
+                stage_samples_.push_back(
+                    eos::StageLatencySample::from_summary(static_cast<std::uint8_t>(i), summary));
+            }
+        }
+        const bool keyframe =
+            status_encoder_->encode(stage_samples_.data(), stage_samples_.size(), stage_delta_);
+        
+        status_msg_.header.stamp = this->now();
+        status_msg_.header.frame_id = this->get_fully_qualified_name();
+        status_msg_.sequence = status_encoder_->sequence();
+        status_msg_.keyframe = keyframe;
+        status_msg_.state = this->get_current_state().id();
+        status_msg_.operational = is_operational_;
+        status_msg_.emergency_stop = emergency_stop_ && emergency_stop_->stopped();
+        status_msg_.inference_rate_hz = reported_inferences_ns_ > 0 && now_ns > reported_inferences_ns_
+            ? static_cast<float>(1e9 * static_cast<double>(inferences - reported_inferences_) /
+                                 static_cast<double>(now_ns - reported_inferences_ns_))
+            : 0.0f;
+        status_msg_.scans_received = received;
+        status_msg_.scans_dropped = received > inferred ? received - inferred : 0;
+        status_msg_.cpu_percent = static_cast<float>(usage.cpu_percent);
+        status_msg_.rss_kib = static_cast<std::uint32_t>(usage.rss_kib);
+        {
+            std::lock_guard<std::mutex> lock(model_id_mutex_);
+            if (keyframe || model_id_ != sent_model_id_) {
+                sent_model_id_ = model_id_;
+                status_msg_.model_id = model_id_;
+            } else {
+                status_msg_.model_id.clear();
+            }
+        }
+        status_msg_.stages.resize(stage_delta_.size());
+        for (std::size_t i = 0; i < stage_delta_.size(); ++i) {
+            auto& stage = status_msg_.stages[i];
+            stage.stage = stage_delta_[i].stage;
+            stage.p50_us = stage_delta_[i].p50_us;
+            stage.p99_us = stage_delta_[i].p99_us;
+            stage.max_us = stage_delta_[i].max_us;
         }
+        reported_inferences_ = inferences;
+        reported_inferences_ns_ = now_ns;
         
-        status_publisher_->publish(status_msg);
+        status_publisher_->publish(status_msg_);
         
-        RCLCPP_DEBUG(this->get_logger(), "Status published: %s", status_msg.data.c_str());
+        RCLCPP_DEBUG(this->get_logger(), "Status %u published: %zu stages%s",
+                     status_msg_.sequence, status_msg_.stages.size(), keyframe ? " (keyframe)" : "");
     }
-};
 
-/**
-* @brief Main function for Eos ROS2 node
-*/
-int main(int argc, char** argv)
-{
-    // Initialize ROS2
-    rclcpp::init(argc, argv);
-    
-    try {
-        // Create and spin the node
-        auto node = std::make_shared<EosRosNode>();
-        RCLCPP_INFO(node->get_logger(), "Eos ROS Node started successfully");
+    /**
+     * @brief Timer callback publishing /eos/metrics (latencies in microseconds)
+     */
+    void metrics_publishing_callback()
+    {
+        using diagnostic_msgs::msg::DiagnosticStatus;
+        using diagnostic_msgs::msg::KeyValue;
+        
+        const auto key_value = [](const char* key, const std::string& value) {
+            KeyValue kv;
+            kv.key = key;
+            kv.value = value;
+            return kv;
+        };
+        const auto us = [](double ns) { return std::to_string(ns / 1000.0); };
+        
+        diagnostic_msgs::msg::DiagnosticArray array;
+        array.header.stamp = this->now();
+        
+        for (std::size_t i = 0; i < static_cast<std::size_t>(eos::LatencyMetric::Count); ++i) {
+            const auto metric = static_cast<eos::LatencyMetric>(i);
+            const eos::HistogramSummary summary = metrics_.histogram(metric).summarize();
+            if (summary.count == 0) {
+                continue;
+            }
+            DiagnosticStatus status;
+            status.level = DiagnosticStatus::OK;
+            status.name = std::string(this->get_name()) + ": " + eos::to_string(metric);
+            status.values = {
+                key_value("count", std::to_string(summary.count)),
+                key_value("mean_us", us(summary.mean_ns)),
+                key_value("p50_us", us(summary.p50_ns)),
+                key_value("p90_us", us(summary.p90_ns)),
+                key_value("p99_us", us(summary.p99_ns)),
+                key_value("p99.9_us", us(summary.p999_ns)),
+                key_value("max_us", us(summary.max_ns)),
+            };
+            array.status.push_back(std::move(status));
+        }
+        
+        // Loops warn for one report after every new overrun
+        for (std::size_t i = 0; i < static_cast<std::size_t>(eos::MonitoredLoop::Count); ++i) {
+            const auto loop = static_cast<eos::MonitoredLoop>(i);
+            const eos::LoopMonitor& monitor = metrics_.loop(loop);
+            if (monitor.period_ns() <= 0) {
+                continue;
+            }
+            const std::uint64_t overruns = monitor.overruns();
+            DiagnosticStatus status;
+            status.name = std::string(this->get_name()) + ": " + eos::to_string(loop);
+            status.level = overruns > reported_overruns_[i] ? DiagnosticStatus::WARN : DiagnosticStatus::OK;
+            status.message = status.level == DiagnosticStatus::OK ? "on schedule" : "overrunning";
+            status.values = {
+                key_value("period_us", us(static_cast<double>(monitor.period_ns()))),
+                key_value("overruns", std::to_string(overruns)),
+                key_value("missed_periods", std::to_string(monitor.missed_periods())),
+            };
+            reported_overruns_[i] = overruns;
+            array.status.push_back(std::move(status));
+        }
         
-        // Keep the node running
-        rclcpp::spin(node);
+        metrics_publisher_->publish(array);
         
-        // Clean shutdown
-        rclcpp::shutdown();
-        return 0;
+        if (enable_profiling_) {
+            write_profile();
+        }
     }
-    catch (const std::exception& e) {
-        RCLCPP_FATAL(rclcpp::get_logger("eos_ros_node"), 
-                     "Fatal error in Eos ROS Node: %s", e.what());
-        return 1;
+
+    /**
+     * @brief Overwrite debug.profile_output_file with the current metrics table
+     */
+    void write_profile()
+    {
+        std::ofstream out(profile_output_file_, std::ios::trunc);
+        if (!out) {
+            RCLCPP_WARN_ONCE(this->get_logger(), "Cannot write profile to %s",
+                             profile_output_file_.c_str());
+            return;
+        }
+        metrics_.write_report(out);
     }
-} 
+};
+
+rclcpp_lifecycle::LifecycleNode::SharedPtr make_eos_ros_node(const rclcpp::NodeOptions& options)
+{
+    return std::make_shared<EosRosNode>(options);
+}
+
+void spin_eos_ros_node(const rclcpp_lifecycle::LifecycleNode::SharedPtr& node)
+{
+    const auto eos_node = std::dynamic_pointer_cast<EosRosNode>(node);
+    if (!eos_node) {
+        throw std::invalid_argument("spin_eos_ros_node needs a node from make_eos_ros_node");
+    }
+    eos_node->spin_standalone();
+}
+
+}  // namespace eos
+
+RCLCPP_COMPONENTS_REGISTER_NODE(eos::EosRosNode)
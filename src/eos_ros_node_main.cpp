@@ -0,0 +1,42 @@
+/**
+* @file eos_ros_node_main.cpp
+* @brief Standalone eos_ros_node: the eos::EosRosNode component in its own process
+*/
+
+#include <csignal>
+#include <exception>
+
+#include "rclcpp/rclcpp.hpp"
+
+#include "eos_robotics/eos_ros_node.hpp"
+#include "eos_robotics/trace_ring.hpp"
+
+/**
+* @brief Main function for Eos ROS2 node
+*/
+int main(int argc, char** argv)
+{
+    // Initialize ROS2
+    rclcpp::init(argc, argv);
+    
+    // kill -USR1 writes the trace rings to trace.dump_path
+    std::signal(SIGUSR1, eos::trace::request_dump_from_signal);
+    
+    try {
+        // Create and spin the node
+        auto node = eos::make_eos_ros_node(rclcpp::NodeOptions().use_intra_process_comms(true));
+        RCLCPP_INFO(node->get_logger(), "Eos ROS Node started successfully");
+        
+        // Keep the node running on the configured executor
+        eos::spin_eos_ros_node(node);
+        
+        // Clean shutdown
+        rclcpp::shutdown();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        RCLCPP_FATAL(rclcpp::get_logger("eos_ros_node"), 
+                     "Fatal error in Eos ROS Node: %s", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,137 @@
+/**
+* @file executor_setup.cpp
+* @brief Executor selection, callback group threads and real-time scheduling
+*/
+
+#include "eos_robotics/executor_setup.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace eos
+{
+
+ExecutorType parse_executor_type(const std::string& name)
+{
+    if (name == "single_threaded") {
+        return ExecutorType::SingleThreaded;
+    }
+    if (name == "static_single_threaded") {
+        return ExecutorType::StaticSingleThreaded;
+    }
+    if (name == "multi_threaded") {
+        return ExecutorType::MultiThreaded;
+    }
+    if (name == "isolated") {
+        return ExecutorType::Isolated;
+    }
+    throw std::invalid_argument(
+        "Unknown executor type '" + name +
+        "', expected single_threaded, static_single_threaded, multi_threaded or isolated");
+}
+
+void apply_thread_schedule(const CallbackGroupSchedule& schedule, const rclcpp::Logger& logger)
+{
+    const pthread_t self = pthread_self();
+
+    if (schedule.cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(schedule.cpu, &cpus);
+        const int result = pthread_setaffinity_np(self, sizeof(cpus), &cpus);
+        if (result != 0) {
+            RCLCPP_WARN(logger, "Could not pin %s thread to CPU %d: %s",
+                        schedule.name.c_str(), schedule.cpu, std::strerror(result));
+        }
+    }
+
+    if (schedule.priority > 0) {
+        sched_param param{};
+        param.sched_priority = schedule.priority;
+        const int result = pthread_setschedparam(self, SCHED_FIFO, &param);
+        if (result != 0) {
+            RCLCPP_WARN(logger, "Could not set SCHED_FIFO priority %d for %s thread: %s",
+                        schedule.priority, schedule.name.c_str(), std::strerror(result));
+        }
+    }
+
+    pthread_setname_np(self, ("eos_" + schedule.name).substr(0, 15).c_str());
+
+    RCLCPP_INFO(logger, "Callback group '%s' running on its own thread (cpu: %d, priority: %d)",
+                schedule.name.c_str(), schedule.cpu, schedule.priority);
+}
+
+namespace
+{
+
+void spin_isolated(
+    const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr& node,
+    const std::vector<CallbackGroupSchedule>& groups)
+{
+    const auto logger = rclcpp::get_logger(node->get_name());
+    std::vector<std::shared_ptr<rclcpp::executors::SingleThreadedExecutor>> executors;
+    std::vector<std::thread> threads;
+
+    for (const auto& schedule : groups) {
+        auto executor = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+        executor->add_callback_group(schedule.group, node);
+        executors.push_back(executor);
+        threads.emplace_back([executor, schedule, logger]() {
+            apply_thread_schedule(schedule, logger);
+            executor->spin();
+        });
+    }
+
+    // Anything not assigned to a named group (parameter services etc.)
+    rclcpp::executors::SingleThreadedExecutor default_executor;
+    default_executor.add_callback_group(node->get_default_callback_group(), node);
+    default_executor.spin();
+
+    for (auto& executor : executors) {
+        executor->cancel();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+void spin(
+    const rclcpp::node_interfaces::NodeBaseInterface::SharedPtr& node,
+    const ExecutorConfig& config,
+    const std::vector<CallbackGroupSchedule>& groups)
+{
+    switch (config.type) {
+        case ExecutorType::SingleThreaded: {
+            rclcpp::executors::SingleThreadedExecutor executor;
+            executor.add_node(node);
+            executor.spin();
+            break;
+        }
+        case ExecutorType::StaticSingleThreaded: {
+            rclcpp::executors::StaticSingleThreadedExecutor executor;
+            executor.add_node(node);
+            executor.spin();
+            break;
+        }
+        case ExecutorType::MultiThreaded: {
+            // A thread count of 0 lets rclcpp use the hardware concurrency
+            rclcpp::executors::MultiThreadedExecutor executor(
+                rclcpp::ExecutorOptions(), config.threads);
+            executor.add_node(node);
+            executor.spin();
+            break;
+        }
+        case ExecutorType::Isolated:
+            spin_isolated(node, groups);
+            break;
+    }
+}
+
+}  // namespace eos
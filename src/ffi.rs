@@ -0,0 +1,360 @@
+//! C ABI for linking the Eos core into eos_ros_node
+//!
+//! Exposes the navigation planner/controller and the SNN engine behind
+//! opaque handles so the C++ node can run them in-process. Sensor buffers
+//! are borrowed by pointer and length for the duration of a call and never
+//! copied. The C header is generated from this file with cbindgen (see
+//! cbindgen.toml) into include/eos_robotics/eos_core.h.
+//!
+//! Every function reports failure through [`EosStatus`]; the message of the
+//! last failure on the calling thread is available from
+//! [`eos_last_error_message`]. Panics are caught at the boundary.
+
+use std::cell::RefCell;
+use std::ffi::{CStr, CString, c_char};
+use std::panic::{self, AssertUnwindSafe};
+use std::ptr;
+
+use crate::navigation::{MotionController, NavigationConfig, NavigationPlanner, ScanView};
+use crate::neural::{NeuralConfig, SNNEngine};
+use crate::types::{MotionCommand, Pose2D};
+
+/// Result of a C ABI call
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum EosStatus {
+    /// The call succeeded
+    Ok = 0,
+    /// A required pointer was null or a buffer had the wrong length
+    InvalidArgument = 1,
+    /// The core rejected the request; see eos_last_error_message()
+    Failed = 2,
+    /// The core panicked; the handle should be freed
+    Panic = 3,
+}
+
+/// Navigation limits, mirroring the navigation block of params.yaml
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct EosNavigationParams {
+    /// Maximum linear velocity (m/s)
+    pub max_linear_velocity: f32,
+    /// Maximum angular velocity (rad/s)
+    pub max_angular_velocity: f32,
+    /// Maximum acceleration (m/s^2)
+    pub max_acceleration: f32,
+    /// Safety distance from obstacles (m)
+    pub safety_distance: f32,
+    /// Goal tolerance (m)
+    pub goal_tolerance: f32,
+    /// Obstacle inflation radius (m)
+    pub obstacle_inflation: f32,
+}
+
+/// Network topology, mirroring the neural block of params.yaml
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct EosNeuralParams {
+    /// Number of input features
+    pub input_size: usize,
+    /// Number of outputs
+    pub output_size: usize,
+    /// Number of hidden layers
+    pub hidden_layers: usize,
+    /// Neurons per hidden layer
+    pub hidden_neurons: usize,
+    /// Simulation time steps
+    pub time_steps: usize,
+    /// Spike threshold
+    pub spike_threshold: f32,
+}
+
+/// One laser scan, borrowed from the caller for the duration of a call
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct EosScan {
+    /// `count` ranges in meters
+    pub ranges: *const f32,
+    /// Number of beams
+    pub count: usize,
+    /// Angle of the first beam (rad)
+    pub angle_min: f32,
+    /// Angle between beams (rad)
+    pub angle_increment: f32,
+    /// Minimum valid range
+    pub range_min: f32,
+    /// Maximum valid range
+    pub range_max: f32,
+}
+
+/// Planner and controller driven together, one step per control tick
+pub struct EosNavigator {
+    planner: NavigationPlanner,
+    controller: MotionController,
+}
+
+/// SNN engine handle
+pub struct EosSnn {
+    engine: SNNEngine,
+}
+
+thread_local! {
+    static LAST_ERROR: RefCell<CString> = RefCell::new(CString::default());
+}
+
+fn set_last_error(message: impl Into<Vec<u8>>) {
+    let mut bytes = message.into();
+    bytes.retain(|&b| b != 0);
+    let message = CString::new(bytes).unwrap_or_default();
+    LAST_ERROR.with(|last| *last.borrow_mut() = message);
+}
+
+/// Run `body`, turning an `Err` or a panic into a status and a last error
+fn guard(body: impl FnOnce() -> Result<(), (EosStatus, String)>) -> EosStatus {
+    match panic::catch_unwind(AssertUnwindSafe(body)) {
+        Ok(Ok(())) => EosStatus::Ok,
+        Ok(Err((status, message))) => {
+            set_last_error(message);
+            status
+        }
+        Err(payload) => {
+            let message = payload
+                .downcast_ref::<&str>()
+                .map(|s| s.to_string())
+                .or_else(|| payload.downcast_ref::<String>().cloned())
+                .unwrap_or_else(|| "unknown panic".to_string());
+            set_last_error(format!("panic in Eos core: {}", message));
+            EosStatus::Panic
+        }
+    }
+}
+
+fn invalid(message: &str) -> (EosStatus, String) {
+    (EosStatus::InvalidArgument, message.to_string())
+}
+
+fn failed(error: impl std::fmt::Display) -> (EosStatus, String) {
+    (EosStatus::Failed, error.to_string())
+}
+
+/// Borrow `len` floats at `data`; an empty slice for a zero length
+///
+/// # Safety
+/// `data` must point to `len` readable floats when `len` is non-zero.
+unsafe fn borrow<'a>(data: *const f32, len: usize) -> Result<&'a [f32], (EosStatus, String)> {
+    if len == 0 {
+        return Ok(&[]);
+    }
+    if data.is_null() {
+        return Err(invalid("null buffer with a non-zero length"));
+    }
+    Ok(unsafe { std::slice::from_raw_parts(data, len) })
+}
+
+/// Message of the last failed call on this thread, or ""
+///
+/// The string stays valid until the next failing call on the same thread.
+#[unsafe(no_mangle)]
+pub extern "C" fn eos_last_error_message() -> *const c_char {
+    LAST_ERROR.with(|last| last.borrow().as_ptr())
+}
+
+/// Create a navigator; returns null and sets the last error on failure
+///
+/// # Safety
+/// `params` must be null or point to a valid EosNavigationParams.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_new(params: *const EosNavigationParams) -> *mut EosNavigator {
+    let mut navigator = ptr::null_mut();
+    guard(|| {
+        let params = unsafe { params.as_ref() }.ok_or_else(|| invalid("null navigation params"))?;
+        let config = NavigationConfig {
+            max_linear_velocity: params.max_linear_velocity,
+            max_angular_velocity: params.max_angular_velocity,
+            max_acceleration: params.max_acceleration,
+            safety_distance: params.safety_distance,
+            goal_tolerance: params.goal_tolerance,
+            obstacle_inflation: params.obstacle_inflation,
+        };
+        navigator = Box::into_raw(Box::new(EosNavigator {
+            planner: NavigationPlanner::new(&config),
+            controller: MotionController::new(&config),
+        }));
+        Ok(())
+    });
+    navigator
+}
+
+/// Free a navigator; null is ignored
+///
+/// # Safety
+/// `navigator` must be null or come from eos_navigator_new() and not be used afterwards.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_free(navigator: *mut EosNavigator) {
+    if !navigator.is_null() {
+        drop(unsafe { Box::from_raw(navigator) });
+    }
+}
+
+/// Set the navigation goal
+///
+/// # Safety
+/// `navigator` must be null or a live handle.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_set_goal(navigator: *mut EosNavigator, goal: Pose2D) -> EosStatus {
+    guard(|| {
+        let navigator = unsafe { navigator.as_mut() }.ok_or_else(|| invalid("null navigator"))?;
+        navigator.planner.set_goal(goal);
+        Ok(())
+    })
+}
+
+/// Clear the navigation goal; the planner explores until a new one is set
+///
+/// # Safety
+/// `navigator` must be null or a live handle.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_clear_goal(navigator: *mut EosNavigator) -> EosStatus {
+    guard(|| {
+        let navigator = unsafe { navigator.as_mut() }.ok_or_else(|| invalid("null navigator"))?;
+        navigator.planner.clear_goal();
+        Ok(())
+    })
+}
+
+/// Plan on `scan` and return the smoothed velocity command for this tick
+///
+/// # Safety
+/// `navigator` must be a live handle, `scan` must describe `count` readable
+/// ranges, `neural` must hold `neural_count` floats (or be null when zero),
+/// `pose` may be null, and `command` must be writable.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_step(
+    navigator: *mut EosNavigator,
+    scan: *const EosScan,
+    neural: *const f32,
+    neural_count: usize,
+    pose: *const Pose2D,
+    command: *mut MotionCommand,
+) -> EosStatus {
+    guard(|| {
+        let navigator = unsafe { navigator.as_mut() }.ok_or_else(|| invalid("null navigator"))?;
+        let scan = unsafe { scan.as_ref() }.ok_or_else(|| invalid("null scan"))?;
+        let command = unsafe { command.as_mut() }.ok_or_else(|| invalid("null command"))?;
+        let view = ScanView {
+            ranges: unsafe { borrow(scan.ranges, scan.count) }?,
+            angle_min: scan.angle_min,
+            angle_increment: scan.angle_increment,
+            range_min: scan.range_min,
+            range_max: scan.range_max,
+        };
+        let neural = unsafe { borrow(neural, neural_count) }?;
+        let pose = unsafe { pose.as_ref() }.copied();
+
+        let path = navigator.planner.plan_scan(&view, neural, pose).map_err(failed)?;
+        *command = navigator.controller.execute_plan(&path).map_err(failed)?;
+        Ok(())
+    })
+}
+
+/// Stop immediately and reset the controller's velocity profile
+///
+/// # Safety
+/// `navigator` must be a live handle and `command` writable.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_navigator_emergency_stop(
+    navigator: *mut EosNavigator,
+    command: *mut MotionCommand,
+) -> EosStatus {
+    guard(|| {
+        let navigator = unsafe { navigator.as_mut() }.ok_or_else(|| invalid("null navigator"))?;
+        let command = unsafe { command.as_mut() }.ok_or_else(|| invalid("null command"))?;
+        *command = navigator.controller.emergency_stop();
+        Ok(())
+    })
+}
+
+/// Create and initialise an SNN engine with a default model
+///
+/// Returns null and sets the last error on failure.
+///
+/// # Safety
+/// `params` must be null or point to a valid EosNeuralParams.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_snn_new(params: *const EosNeuralParams) -> *mut EosSnn {
+    let mut snn = ptr::null_mut();
+    guard(|| {
+        let params = unsafe { params.as_ref() }.ok_or_else(|| invalid("null neural params"))?;
+        let config = NeuralConfig {
+            input_size: params.input_size,
+            output_size: params.output_size,
+            hidden_layers: params.hidden_layers,
+            hidden_neurons: params.hidden_neurons,
+            spike_threshold: params.spike_threshold,
+            time_steps: params.time_steps,
+            ..NeuralConfig::default()
+        };
+        let mut engine = SNNEngine::new(&config).map_err(failed)?;
+        engine.initialize().map_err(failed)?;
+        snn = Box::into_raw(Box::new(EosSnn { engine }));
+        Ok(())
+    });
+    snn
+}
+
+/// Free an SNN engine; null is ignored
+///
+/// # Safety
+/// `snn` must be null or come from eos_snn_new() and not be used afterwards.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_snn_free(snn: *mut EosSnn) {
+    if !snn.is_null() {
+        drop(unsafe { Box::from_raw(snn) });
+    }
+}
+
+/// Replace the engine's model with a JSON model file
+///
+/// # Safety
+/// `snn` must be a live handle and `path` a NUL-terminated UTF-8 string.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_snn_load_model(snn: *mut EosSnn, path: *const c_char) -> EosStatus {
+    guard(|| {
+        let snn = unsafe { snn.as_mut() }.ok_or_else(|| invalid("null engine"))?;
+        if path.is_null() {
+            return Err(invalid("null model path"));
+        }
+        let path = unsafe { CStr::from_ptr(path) }
+            .to_str()
+            .map_err(|_| invalid("model path is not UTF-8"))?;
+        snn.engine.load_model(path).map_err(failed)
+    })
+}
+
+/// Run `input_count` preprocessed features into `output_count` outputs
+///
+/// # Safety
+/// `snn` must be a live handle, `input` must hold `input_count` readable
+/// floats and `output` `output_count` writable ones.
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn eos_snn_process(
+    snn: *const EosSnn,
+    input: *const f32,
+    input_count: usize,
+    output: *mut f32,
+    output_count: usize,
+) -> EosStatus {
+    guard(|| {
+        let snn = unsafe { snn.as_ref() }.ok_or_else(|| invalid("null engine"))?;
+        let input = unsafe { borrow(input, input_count) }?;
+        if output.is_null() && output_count > 0 {
+            return Err(invalid("null output with a non-zero length"));
+        }
+        let output: &mut [f32] = if output_count == 0 {
+            &mut []
+        } else {
+            unsafe { std::slice::from_raw_parts_mut(output, output_count) }
+        };
+        snn.engine.process_features(input, output).map_err(failed)
+    })
+}
@@ -0,0 +1,142 @@
+/**
+* @file inference_batcher.cpp
+* @brief Micro-batching of inference requests from several robots onto one engine
+*/
+
+#include "eos_robotics/inference_batcher.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace eos
+{
+
+InferenceBatcher::InferenceBatcher(std::unique_ptr<LifEngine> engine, std::size_t clients,
+                                   std::chrono::nanoseconds latency_budget, ReplyCallback reply)
+    : engine_(std::move(engine)),
+      clients_(clients),
+      latency_budget_(latency_budget),
+      reply_(std::move(reply))
+{
+    if (!engine_ || clients_ == 0) {
+        throw std::invalid_argument("Inference batcher needs an engine and at least one client");
+    }
+    if (engine_->config().max_batch < clients_) {
+        throw std::invalid_argument(
+            "Engine batches at most " + std::to_string(engine_->config().max_batch) +
+            " samples, " + std::to_string(clients_) + " clients configured");
+    }
+
+    slot_features_ = AlignedBuffer<float>(clients_ * input_size());
+    slot_tags_.assign(clients_, 0);
+    slot_pending_.assign(clients_, 0);
+    batch_features_ = AlignedBuffer<float>(clients_ * input_size());
+    batch_outputs_ = AlignedBuffer<float>(clients_ * output_size());
+    batch_clients_.assign(clients_, 0);
+    batch_tags_.assign(clients_, 0);
+
+    worker_ = std::thread([this]() { run(); });
+}
+
+InferenceBatcher::~InferenceBatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+}
+
+void InferenceBatcher::submit(std::size_t client, std::int64_t tag, const float* features)
+{
+    if (client >= clients_) {
+        throw std::out_of_range("Client " + std::to_string(client) + " of " +
+                                std::to_string(clients_));
+    }
+
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::copy(features, features + input_size(),
+                  slot_features_.data() + client * input_size());
+        slot_tags_[client] = tag;
+        if (slot_pending_[client]) {
+            ++superseded_;
+        } else {
+            slot_pending_[client] = 1;
+            if (pending_++ == 0) {
+                oldest_pending_ = Clock::now();
+            }
+        }
+        // The batcher only needs waking to open a window or to close a full one
+        wake = pending_ == 1 || pending_ == clients_;
+    }
+    if (wake) {
+        wake_.notify_one();
+    }
+}
+
+std::uint64_t InferenceBatcher::batches() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return batches_;
+}
+
+std::uint64_t InferenceBatcher::requests() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requests_;
+}
+
+std::uint64_t InferenceBatcher::superseded() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return superseded_;
+}
+
+void InferenceBatcher::run()
+{
+    const std::size_t inputs = input_size();
+    const std::size_t outputs = output_size();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this]() { return stopping_ || pending_ > 0; });
+        // The window opens with the oldest waiting request
+        wake_.wait_until(lock, oldest_pending_ + latency_budget_,
+                         [this]() { return stopping_ || pending_ == clients_; });
+        if (stopping_) {
+            return;
+        }
+
+        std::size_t batch = 0;
+        for (std::size_t client = 0; client < clients_; ++client) {
+            if (!slot_pending_[client]) {
+                continue;
+            }
+            std::copy(slot_features_.data() + client * inputs,
+                      slot_features_.data() + (client + 1) * inputs,
+                      batch_features_.data() + batch * inputs);
+            batch_clients_[batch] = client;
+            batch_tags_[batch] = slot_tags_[client];
+            slot_pending_[client] = 0;
+            ++batch;
+        }
+        pending_ = 0;
+        ++batches_;
+        requests_ += batch;
+
+        // Clients keep submitting into their slots while the batch runs
+        lock.unlock();
+        engine_->run_batch(batch_features_.data(), batch, batch_outputs_.data());
+        for (std::size_t k = 0; k < batch; ++k) {
+            reply_(batch_clients_[k], batch_tags_[k], batch_outputs_.data() + k * outputs, batch);
+        }
+        lock.lock();
+    }
+}
+
+}  // namespace eos
@@ -0,0 +1,192 @@
+/**
+* @file kernel_dispatch.cpp
+* @brief Picks a build of the native kernels at startup and forwards to it
+*/
+
+#include "eos_robotics/kernel_table.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+// The build lists the kernels.cpp builds it links in; a plain build of
+// kernels.cpp next to this file has the one its flags select
+#if !defined(EOS_KERNELS_WITH_AVX2) && !defined(EOS_KERNELS_WITH_NEON) && \
+    !defined(EOS_KERNELS_WITH_SCALAR)
+#if defined(__AVX2__)
+#define EOS_KERNELS_WITH_AVX2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define EOS_KERNELS_WITH_NEON 1
+#else
+#define EOS_KERNELS_WITH_SCALAR 1
+#endif
+#endif
+
+namespace eos
+{
+namespace kernels
+{
+
+namespace
+{
+
+// Best first
+const KernelTable* const kTables[] = {
+#if defined(EOS_KERNELS_WITH_AVX2)
+    &avx2::table,
+#endif
+#if defined(EOS_KERNELS_WITH_NEON)
+    &neon::table,
+#endif
+#if defined(EOS_KERNELS_WITH_SCALAR)
+    &scalar::table,
+#endif
+};
+
+bool supported(const KernelTable& table)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (std::strcmp(table.name, "avx2") == 0) {
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }
+#endif
+    (void)table;
+    return true;
+}
+
+const KernelTable* find(const char* name)
+{
+    for (const KernelTable* table : kTables) {
+        if (std::strcmp(table->name, name) == 0 && supported(*table)) {
+            return table;
+        }
+    }
+    return nullptr;
+}
+
+const KernelTable* detect()
+{
+    if (const char* forced = std::getenv("EOS_KERNELS")) {
+        if (const KernelTable* table = find(forced)) {
+            return table;
+        }
+    }
+    for (const KernelTable* table : kTables) {
+        if (supported(*table)) {
+            return table;
+        }
+    }
+    // The last build is scalar or NEON, which always run
+    return kTables[sizeof(kTables) / sizeof(kTables[0]) - 1];
+}
+
+std::atomic<const KernelTable*>& active()
+{
+    static std::atomic<const KernelTable*> table{detect()};
+    return table;
+}
+
+const KernelTable& table()
+{
+    return *active().load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+const char* instruction_set()
+{
+    return table().name;
+}
+
+std::vector<std::string> available_instruction_sets()
+{
+    std::vector<std::string> names;
+    for (const KernelTable* candidate : kTables) {
+        if (supported(*candidate)) {
+            names.emplace_back(candidate->name);
+        }
+    }
+    return names;
+}
+
+bool select_instruction_set(const std::string& name)
+{
+    const KernelTable* selected = find(name.c_str());
+    if (!selected) {
+        return false;
+    }
+    active().store(selected, std::memory_order_relaxed);
+    return true;
+}
+
+void matvec(const float* weights, std::size_t rows, std::size_t stride,
+            const float* x, float* y)
+{
+    table().matvec(weights, rows, stride, x, y);
+}
+
+void matvec_batch(const float* weights, std::size_t rows, std::size_t stride,
+                  const float* x, std::size_t x_stride, std::size_t batch,
+                  float* y, std::size_t y_stride)
+{
+    table().matvec_batch(weights, rows, stride, x, x_stride, batch, y, y_stride);
+}
+
+std::size_t lif_step(float* membrane, const float* current, float* spikes,
+                     std::size_t count, float decay, float threshold)
+{
+    return table().lif_step(membrane, current, spikes, count, decay, threshold);
+}
+
+std::size_t gather_spike_indices(const float* spikes, std::size_t count,
+                                 std::uint32_t* indices)
+{
+    return table().gather_spike_indices(spikes, count, indices);
+}
+
+void scatter_add(float* y, const std::uint32_t* index, const float* weight,
+                 std::size_t count)
+{
+    table().scatter_add(y, index, weight, count);
+}
+
+void sanitize_ranges(const float* ranges, std::size_t count, float range_min,
+                     float range_max, float* out)
+{
+    table().sanitize_ranges(ranges, count, range_min, range_max, out);
+}
+
+float reduce_min(const float* x, std::size_t count)
+{
+    return table().reduce_min(x, count);
+}
+
+float min_valid_range(const float* ranges, std::size_t count, float range_min)
+{
+    return table().min_valid_range(ranges, count, range_min);
+}
+
+float reduce_sum(const float* x, std::size_t count)
+{
+    return table().reduce_sum(x, count);
+}
+
+void accumulate(float* acc, const float* x, std::size_t count)
+{
+    table().accumulate(acc, x, count);
+}
+
+void scale(float* x, std::size_t count, float factor)
+{
+    table().scale(x, count, factor);
+}
+
+void min_squared_distance(const float* x, const float* y, std::size_t count,
+                          const float* px, const float* py, std::size_t points,
+                          float* min_sq)
+{
+    table().min_squared_distance(x, y, count, px, py, points, min_sq);
+}
+
+}  // namespace kernels
+}  // namespace eos
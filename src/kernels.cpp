@@ -0,0 +1,671 @@
+/**
+* @file kernels.cpp
+* @brief AVX2 / NEON / scalar implementations of the native kernels
+*
+* The target flags pick one implementation per build of this file, and it
+* is defined in a namespace named after its instruction set, so the file
+* can be built once per instruction set into the same binary;
+* kernel_dispatch.cpp chooses between the builds at startup.
+*/
+
+#include "eos_robotics/kernel_table.hpp"
+
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EOS_KERNELS_AVX2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define EOS_KERNELS_NEON 1
+#endif
+
+#if defined(EOS_KERNELS_AVX2)
+#define EOS_KERNELS_ISA avx2
+#elif defined(EOS_KERNELS_NEON)
+#define EOS_KERNELS_ISA neon
+#else
+#define EOS_KERNELS_ISA scalar
+#endif
+
+#define EOS_KERNELS_STRINGIFY_(name) #name
+#define EOS_KERNELS_STRINGIFY(name) EOS_KERNELS_STRINGIFY_(name)
+
+namespace eos
+{
+namespace kernels
+{
+namespace EOS_KERNELS_ISA
+{
+
+#if defined(EOS_KERNELS_AVX2)
+
+namespace
+{
+
+inline float horizontal_sum(__m256 v)
+{
+    __m128 lo = _mm256_castps256_ps128(v);
+    __m128 hi = _mm256_extractf128_ps(v, 1);
+    lo = _mm_add_ps(lo, hi);
+    __m128 shuf = _mm_movehdup_ps(lo);
+    __m128 sums = _mm_add_ps(lo, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    sums = _mm_add_ss(sums, shuf);
+    return _mm_cvtss_f32(sums);
+}
+
+inline __m256 multiply_add(__m256 a, __m256 b, __m256 c)
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+}  // namespace
+
+void matvec(const float* weights, std::size_t rows, std::size_t stride,
+            const float* x, float* y)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        __m256 acc = _mm256_setzero_ps();
+        for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+            acc = multiply_add(_mm256_load_ps(row + i), _mm256_load_ps(x + i), acc);
+        }
+        y[r] = horizontal_sum(acc);
+    }
+}
+
+void matvec_batch(const float* weights, std::size_t rows, std::size_t stride,
+                  const float* x, std::size_t x_stride, std::size_t batch,
+                  float* y, std::size_t y_stride)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        std::size_t b = 0;
+        // Four samples per pass share every weight load
+        for (; b + 4 <= batch; b += 4) {
+            const float* x0 = x + b * x_stride;
+            const float* x1 = x0 + x_stride;
+            const float* x2 = x1 + x_stride;
+            const float* x3 = x2 + x_stride;
+            __m256 acc0 = _mm256_setzero_ps();
+            __m256 acc1 = _mm256_setzero_ps();
+            __m256 acc2 = _mm256_setzero_ps();
+            __m256 acc3 = _mm256_setzero_ps();
+            for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+                const __m256 w = _mm256_load_ps(row + i);
+                acc0 = multiply_add(w, _mm256_load_ps(x0 + i), acc0);
+                acc1 = multiply_add(w, _mm256_load_ps(x1 + i), acc1);
+                acc2 = multiply_add(w, _mm256_load_ps(x2 + i), acc2);
+                acc3 = multiply_add(w, _mm256_load_ps(x3 + i), acc3);
+            }
+            y[b * y_stride + r] = horizontal_sum(acc0);
+            y[(b + 1) * y_stride + r] = horizontal_sum(acc1);
+            y[(b + 2) * y_stride + r] = horizontal_sum(acc2);
+            y[(b + 3) * y_stride + r] = horizontal_sum(acc3);
+        }
+        for (; b < batch; ++b) {
+            const float* xb = x + b * x_stride;
+            __m256 acc = _mm256_setzero_ps();
+            for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+                acc = multiply_add(_mm256_load_ps(row + i), _mm256_load_ps(xb + i), acc);
+            }
+            y[b * y_stride + r] = horizontal_sum(acc);
+        }
+    }
+}
+
+std::size_t lif_step(float* membrane, const float* current, float* spikes,
+                     std::size_t count, float decay, float threshold)
+{
+    const __m256 decay_v = _mm256_set1_ps(decay);
+    const __m256 threshold_v = _mm256_set1_ps(threshold);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    std::size_t fired = 0;
+    std::size_t i = 0;
+
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        __m256 v = multiply_add(_mm256_loadu_ps(membrane + i), decay_v,
+                                _mm256_loadu_ps(current + i));
+        const __m256 mask = _mm256_cmp_ps(v, threshold_v, _CMP_GE_OQ);
+        _mm256_storeu_ps(spikes + i, _mm256_and_ps(mask, one));
+        _mm256_storeu_ps(membrane + i, _mm256_andnot_ps(mask, v));
+        fired += static_cast<std::size_t>(__builtin_popcount(_mm256_movemask_ps(mask)));
+    }
+
+    for (; i < count; ++i) {
+        const float v = membrane[i] * decay + current[i];
+        const bool spike = v >= threshold;
+        spikes[i] = spike ? 1.0f : 0.0f;
+        membrane[i] = spike ? 0.0f : v;
+        fired += spike ? 1 : 0;
+    }
+    return fired;
+}
+
+std::size_t gather_spike_indices(const float* spikes, std::size_t count,
+                                 std::uint32_t* indices)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    std::size_t written = 0;
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(spikes + i), zero, _CMP_NEQ_OQ)));
+        while (mask != 0) {
+            indices[written++] = static_cast<std::uint32_t>(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < count; ++i) {
+        if (spikes[i] != 0.0f) {
+            indices[written++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    return written;
+}
+
+void sanitize_ranges(const float* ranges, std::size_t count, float range_min,
+                     float range_max, float* out)
+{
+    const __m256 min_v = _mm256_set1_ps(range_min);
+    const __m256 max_v = _mm256_set1_ps(range_max);
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        const __m256 x = _mm256_loadu_ps(ranges + i);
+        // Ordered compares are false for NaN, and inf fails the upper bound
+        const __m256 valid = _mm256_and_ps(_mm256_cmp_ps(x, min_v, _CMP_GE_OQ),
+                                           _mm256_cmp_ps(x, max_v, _CMP_LE_OQ));
+        _mm256_storeu_ps(out + i, _mm256_blendv_ps(max_v, x, valid));
+    }
+    for (; i < count; ++i) {
+        const float x = ranges[i];
+        out[i] = (x >= range_min && x <= range_max) ? x : range_max;
+    }
+}
+
+float reduce_min(const float* x, std::size_t count)
+{
+    __m256 acc = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        acc = _mm256_min_ps(acc, _mm256_loadu_ps(x + i));
+    }
+    __m128 lo = _mm_min_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    lo = _mm_min_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_min_ss(lo, _mm_movehdup_ps(lo));
+    float result = _mm_cvtss_f32(lo);
+    for (; i < count; ++i) {
+        result = x[i] < result ? x[i] : result;
+    }
+    return result;
+}
+
+float min_valid_range(const float* ranges, std::size_t count, float range_min)
+{
+    const __m256 inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    const __m256 lower = _mm256_set1_ps(range_min);
+    __m256 acc = inf;
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        const __m256 r = _mm256_loadu_ps(ranges + i);
+        // Ordered compare: NaN lanes fail and are replaced by +inf
+        const __m256 valid = _mm256_cmp_ps(r, lower, _CMP_GE_OQ);
+        acc = _mm256_min_ps(acc, _mm256_blendv_ps(inf, r, valid));
+    }
+    __m128 lo = _mm_min_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    lo = _mm_min_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_min_ss(lo, _mm_movehdup_ps(lo));
+    float result = _mm_cvtss_f32(lo);
+    for (; i < count; ++i) {
+        result = ranges[i] >= range_min && ranges[i] < result ? ranges[i] : result;
+    }
+    return result;
+}
+
+float reduce_sum(const float* x, std::size_t count)
+{
+    __m256 acc = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        acc = _mm256_add_ps(acc, _mm256_loadu_ps(x + i));
+    }
+    float result = horizontal_sum(acc);
+    for (; i < count; ++i) {
+        result += x[i];
+    }
+    return result;
+}
+
+void accumulate(float* acc, const float* x, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        _mm256_storeu_ps(acc + i, _mm256_add_ps(_mm256_loadu_ps(acc + i),
+                                                _mm256_loadu_ps(x + i)));
+    }
+    for (; i < count; ++i) {
+        acc[i] += x[i];
+    }
+}
+
+void scale(float* x, std::size_t count, float factor)
+{
+    const __m256 factor_v = _mm256_set1_ps(factor);
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        _mm256_storeu_ps(x + i, _mm256_mul_ps(_mm256_loadu_ps(x + i), factor_v));
+    }
+    for (; i < count; ++i) {
+        x[i] *= factor;
+    }
+}
+
+void min_squared_distance(const float* x, const float* y, std::size_t count,
+                          const float* px, const float* py, std::size_t points,
+                          float* min_sq)
+{
+    std::size_t i = 0;
+    for (; i + kFloatLanes <= count; i += kFloatLanes) {
+        const __m256 xv = _mm256_loadu_ps(x + i);
+        const __m256 yv = _mm256_loadu_ps(y + i);
+        __m256 best = _mm256_loadu_ps(min_sq + i);
+        for (std::size_t j = 0; j < points; ++j) {
+            const __m256 dx = _mm256_sub_ps(xv, _mm256_set1_ps(px[j]));
+            const __m256 dy = _mm256_sub_ps(yv, _mm256_set1_ps(py[j]));
+            best = _mm256_min_ps(best, multiply_add(dx, dx, _mm256_mul_ps(dy, dy)));
+        }
+        _mm256_storeu_ps(min_sq + i, best);
+    }
+    for (; i < count; ++i) {
+        float best = min_sq[i];
+        for (std::size_t j = 0; j < points; ++j) {
+            const float dx = x[i] - px[j];
+            const float dy = y[i] - py[j];
+            const float d = dx * dx + dy * dy;
+            best = d < best ? d : best;
+        }
+        min_sq[i] = best;
+    }
+}
+
+#elif defined(EOS_KERNELS_NEON)
+
+void matvec(const float* weights, std::size_t rows, std::size_t stride,
+            const float* x, float* y)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+            acc0 = vfmaq_f32(acc0, vld1q_f32(row + i), vld1q_f32(x + i));
+            acc1 = vfmaq_f32(acc1, vld1q_f32(row + i + 4), vld1q_f32(x + i + 4));
+        }
+        y[r] = vaddvq_f32(vaddq_f32(acc0, acc1));
+    }
+}
+
+void matvec_batch(const float* weights, std::size_t rows, std::size_t stride,
+                  const float* x, std::size_t x_stride, std::size_t batch,
+                  float* y, std::size_t y_stride)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        std::size_t b = 0;
+        // Two samples per pass share every weight load
+        for (; b + 2 <= batch; b += 2) {
+            const float* x0 = x + b * x_stride;
+            const float* x1 = x0 + x_stride;
+            float32x4_t acc00 = vdupq_n_f32(0.0f);
+            float32x4_t acc01 = vdupq_n_f32(0.0f);
+            float32x4_t acc10 = vdupq_n_f32(0.0f);
+            float32x4_t acc11 = vdupq_n_f32(0.0f);
+            for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+                const float32x4_t w0 = vld1q_f32(row + i);
+                const float32x4_t w1 = vld1q_f32(row + i + 4);
+                acc00 = vfmaq_f32(acc00, w0, vld1q_f32(x0 + i));
+                acc01 = vfmaq_f32(acc01, w1, vld1q_f32(x0 + i + 4));
+                acc10 = vfmaq_f32(acc10, w0, vld1q_f32(x1 + i));
+                acc11 = vfmaq_f32(acc11, w1, vld1q_f32(x1 + i + 4));
+            }
+            y[b * y_stride + r] = vaddvq_f32(vaddq_f32(acc00, acc01));
+            y[(b + 1) * y_stride + r] = vaddvq_f32(vaddq_f32(acc10, acc11));
+        }
+        for (; b < batch; ++b) {
+            const float* xb = x + b * x_stride;
+            float32x4_t acc0 = vdupq_n_f32(0.0f);
+            float32x4_t acc1 = vdupq_n_f32(0.0f);
+            for (std::size_t i = 0; i < stride; i += kFloatLanes) {
+                acc0 = vfmaq_f32(acc0, vld1q_f32(row + i), vld1q_f32(xb + i));
+                acc1 = vfmaq_f32(acc1, vld1q_f32(row + i + 4), vld1q_f32(xb + i + 4));
+            }
+            y[b * y_stride + r] = vaddvq_f32(vaddq_f32(acc0, acc1));
+        }
+    }
+}
+
+std::size_t lif_step(float* membrane, const float* current, float* spikes,
+                     std::size_t count, float decay, float threshold)
+{
+    const float32x4_t decay_v = vdupq_n_f32(decay);
+    const float32x4_t threshold_v = vdupq_n_f32(threshold);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    std::size_t fired = 0;
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t v = vfmaq_f32(vld1q_f32(current + i), vld1q_f32(membrane + i), decay_v);
+        const uint32x4_t mask = vcgeq_f32(v, threshold_v);
+        vst1q_f32(spikes + i, vbslq_f32(mask, one, zero));
+        vst1q_f32(membrane + i, vbslq_f32(mask, zero, v));
+        fired += vaddvq_u32(vshrq_n_u32(mask, 31));
+    }
+
+    for (; i < count; ++i) {
+        const float v = membrane[i] * decay + current[i];
+        const bool spike = v >= threshold;
+        spikes[i] = spike ? 1.0f : 0.0f;
+        membrane[i] = spike ? 0.0f : v;
+        fired += spike ? 1 : 0;
+    }
+    return fired;
+}
+
+std::size_t gather_spike_indices(const float* spikes, std::size_t count,
+                                 std::uint32_t* indices)
+{
+    std::size_t written = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        // Skip quiet groups of four with a single horizontal max
+        if (vmaxvq_f32(vld1q_f32(spikes + i)) == 0.0f) {
+            continue;
+        }
+        for (std::size_t k = i; k < i + 4; ++k) {
+            if (spikes[k] != 0.0f) {
+                indices[written++] = static_cast<std::uint32_t>(k);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        if (spikes[i] != 0.0f) {
+            indices[written++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    return written;
+}
+
+void sanitize_ranges(const float* ranges, std::size_t count, float range_min,
+                     float range_max, float* out)
+{
+    const float32x4_t min_v = vdupq_n_f32(range_min);
+    const float32x4_t max_v = vdupq_n_f32(range_max);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t x = vld1q_f32(ranges + i);
+        // Compares are false for NaN, and inf fails the upper bound
+        const uint32x4_t valid = vandq_u32(vcgeq_f32(x, min_v), vcleq_f32(x, max_v));
+        vst1q_f32(out + i, vbslq_f32(valid, x, max_v));
+    }
+    for (; i < count; ++i) {
+        const float x = ranges[i];
+        out[i] = (x >= range_min && x <= range_max) ? x : range_max;
+    }
+}
+
+float reduce_min(const float* x, std::size_t count)
+{
+    float32x4_t acc = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc = vminq_f32(acc, vld1q_f32(x + i));
+    }
+    float result = vminvq_f32(acc);
+    for (; i < count; ++i) {
+        result = x[i] < result ? x[i] : result;
+    }
+    return result;
+}
+
+float min_valid_range(const float* ranges, std::size_t count, float range_min)
+{
+    const float32x4_t inf = vdupq_n_f32(std::numeric_limits<float>::infinity());
+    const float32x4_t lower = vdupq_n_f32(range_min);
+    float32x4_t acc = inf;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t r = vld1q_f32(ranges + i);
+        // NaN lanes fail the compare and are replaced by +inf
+        acc = vminq_f32(acc, vbslq_f32(vcgeq_f32(r, lower), r, inf));
+    }
+    float result = vminvq_f32(acc);
+    for (; i < count; ++i) {
+        result = ranges[i] >= range_min && ranges[i] < result ? ranges[i] : result;
+    }
+    return result;
+}
+
+float reduce_sum(const float* x, std::size_t count)
+{
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc = vaddq_f32(acc, vld1q_f32(x + i));
+    }
+    float result = vaddvq_f32(acc);
+    for (; i < count; ++i) {
+        result += x[i];
+    }
+    return result;
+}
+
+void accumulate(float* acc, const float* x, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(acc + i, vaddq_f32(vld1q_f32(acc + i), vld1q_f32(x + i)));
+    }
+    for (; i < count; ++i) {
+        acc[i] += x[i];
+    }
+}
+
+void scale(float* x, std::size_t count, float factor)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(x + i, vmulq_n_f32(vld1q_f32(x + i), factor));
+    }
+    for (; i < count; ++i) {
+        x[i] *= factor;
+    }
+}
+
+void min_squared_distance(const float* x, const float* y, std::size_t count,
+                          const float* px, const float* py, std::size_t points,
+                          float* min_sq)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t xv = vld1q_f32(x + i);
+        const float32x4_t yv = vld1q_f32(y + i);
+        float32x4_t best = vld1q_f32(min_sq + i);
+        for (std::size_t j = 0; j < points; ++j) {
+            const float32x4_t dx = vsubq_f32(xv, vdupq_n_f32(px[j]));
+            const float32x4_t dy = vsubq_f32(yv, vdupq_n_f32(py[j]));
+            best = vminq_f32(best, vfmaq_f32(vmulq_f32(dy, dy), dx, dx));
+        }
+        vst1q_f32(min_sq + i, best);
+    }
+    for (; i < count; ++i) {
+        float best = min_sq[i];
+        for (std::size_t j = 0; j < points; ++j) {
+            const float dx = x[i] - px[j];
+            const float dy = y[i] - py[j];
+            const float d = dx * dx + dy * dy;
+            best = d < best ? d : best;
+        }
+        min_sq[i] = best;
+    }
+}
+
+#else
+
+void matvec(const float* weights, std::size_t rows, std::size_t stride,
+            const float* x, float* y)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        float acc = 0.0f;
+        for (std::size_t i = 0; i < stride; ++i) {
+            acc += row[i] * x[i];
+        }
+        y[r] = acc;
+    }
+}
+
+void matvec_batch(const float* weights, std::size_t rows, std::size_t stride,
+                  const float* x, std::size_t x_stride, std::size_t batch,
+                  float* y, std::size_t y_stride)
+{
+    for (std::size_t r = 0; r < rows; ++r) {
+        const float* row = weights + r * stride;
+        for (std::size_t b = 0; b < batch; ++b) {
+            const float* xb = x + b * x_stride;
+            float acc = 0.0f;
+            for (std::size_t i = 0; i < stride; ++i) {
+                acc += row[i] * xb[i];
+            }
+            y[b * y_stride + r] = acc;
+        }
+    }
+}
+
+std::size_t lif_step(float* membrane, const float* current, float* spikes,
+                     std::size_t count, float decay, float threshold)
+{
+    std::size_t fired = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float v = membrane[i] * decay + current[i];
+        const bool spike = v >= threshold;
+        spikes[i] = spike ? 1.0f : 0.0f;
+        membrane[i] = spike ? 0.0f : v;
+        fired += spike ? 1 : 0;
+    }
+    return fired;
+}
+
+std::size_t gather_spike_indices(const float* spikes, std::size_t count,
+                                 std::uint32_t* indices)
+{
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (spikes[i] != 0.0f) {
+            indices[written++] = static_cast<std::uint32_t>(i);
+        }
+    }
+    return written;
+}
+
+void sanitize_ranges(const float* ranges, std::size_t count, float range_min,
+                     float range_max, float* out)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        const float x = ranges[i];
+        out[i] = (x >= range_min && x <= range_max) ? x : range_max;
+    }
+}
+
+float reduce_min(const float* x, std::size_t count)
+{
+    float result = std::numeric_limits<float>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+        result = x[i] < result ? x[i] : result;
+    }
+    return result;
+}
+
+float min_valid_range(const float* ranges, std::size_t count, float range_min)
+{
+    float result = std::numeric_limits<float>::infinity();
+    for (std::size_t i = 0; i < count; ++i) {
+        result = ranges[i] >= range_min && ranges[i] < result ? ranges[i] : result;
+    }
+    return result;
+}
+
+float reduce_sum(const float* x, std::size_t count)
+{
+    float result = 0.0f;
+    for (std::size_t i = 0; i < count; ++i) {
+        result += x[i];
+    }
+    return result;
+}
+
+void accumulate(float* acc, const float* x, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        acc[i] += x[i];
+    }
+}
+
+void scale(float* x, std::size_t count, float factor)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] *= factor;
+    }
+}
+
+void min_squared_distance(const float* x, const float* y, std::size_t count,
+                          const float* px, const float* py, std::size_t points,
+                          float* min_sq)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        float best = min_sq[i];
+        for (std::size_t j = 0; j < points; ++j) {
+            const float dx = x[i] - px[j];
+            const float dy = y[i] - py[j];
+            const float d = dx * dx + dy * dy;
+            best = d < best ? d : best;
+        }
+        min_sq[i] = best;
+    }
+}
+
+#endif
+
+// Neither AVX2 nor NEON has a scatter instruction, so this stays scalar on all targets
+void scatter_add(float* y, const std::uint32_t* index, const float* weight,
+                 std::size_t count)
+{
+    for (std::size_t k = 0; k < count; ++k) {
+        y[index[k]] += weight[k];
+    }
+}
+
+const KernelTable table = {
+    EOS_KERNELS_STRINGIFY(EOS_KERNELS_ISA),
+    &matvec,
+    &matvec_batch,
+    &lif_step,
+    &gather_spike_indices,
+    &scatter_add,
+    &sanitize_ranges,
+    &reduce_min,
+    &min_valid_range,
+    &reduce_sum,
+    &accumulate,
+    &scale,
+    &min_squared_distance,
+};
+
+}  // namespace EOS_KERNELS_ISA
+}  // namespace kernels
+}  // namespace eos
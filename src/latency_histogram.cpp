@@ -0,0 +1,108 @@
+/**
+* @file latency_histogram.cpp
+* @brief Lock-free log-linear latency histogram
+*/
+
+#include "eos_robotics/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace eos
+{
+
+namespace
+{
+
+int most_significant_bit(std::uint64_t value)
+{
+    return 63 - __builtin_clzll(value);
+}
+
+}  // namespace
+
+std::size_t LatencyHistogram::bucket_index(std::uint64_t value)
+{
+    if (value < kSubBuckets) {
+        return static_cast<std::size_t>(value);
+    }
+    const int shift = most_significant_bit(value) - static_cast<int>(kSubBucketBits);
+    const std::size_t sub = static_cast<std::size_t>(value >> shift) - kSubBuckets;
+    return (static_cast<std::size_t>(shift) + 1) * kSubBuckets + sub;
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(std::size_t index)
+{
+    if (index < kSubBuckets) {
+        return index;
+    }
+    const std::size_t shift = index / kSubBuckets - 1;
+    const std::uint64_t lower = (kSubBuckets + index % kSubBuckets) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+HistogramSummary LatencyHistogram::summarize() const
+{
+    // Copy once so all percentiles come from the same counts
+    std::array<std::uint64_t, kBuckets> counts;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+
+    HistogramSummary summary;
+    summary.count = total;
+    if (total == 0) {
+        return summary;
+    }
+    const std::uint64_t max = max_.load(std::memory_order_relaxed);
+    summary.max_ns = static_cast<std::int64_t>(max);
+    summary.mean_ns = static_cast<double>(sum_.load(std::memory_order_relaxed)) /
+                      static_cast<double>(std::max(total, count()));
+
+    const std::array<double, 4> quantiles = {0.5, 0.9, 0.99, 0.999};
+    std::array<std::int64_t*, 4> targets = {
+        &summary.p50_ns, &summary.p90_ns, &summary.p99_ns, &summary.p999_ns};
+
+    std::size_t next = 0;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets && next < quantiles.size(); ++i) {
+        seen += counts[i];
+        while (next < quantiles.size()) {
+            const auto rank = static_cast<std::uint64_t>(
+                std::ceil(quantiles[next] * static_cast<double>(total)));
+            if (seen < std::max<std::uint64_t>(rank, 1)) {
+                break;
+            }
+            *targets[next] = static_cast<std::int64_t>(std::min(bucket_upper_bound(i), max));
+            ++next;
+        }
+    }
+    return summary;
+}
+
+std::int64_t LatencyHistogram::percentile(double q) const
+{
+    std::uint64_t total = 0;
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max<std::uint64_t>(
+        static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total))), 1);
+    const std::uint64_t max = max_.load(std::memory_order_relaxed);
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return static_cast<std::int64_t>(std::min(bucket_upper_bound(i), max));
+        }
+    }
+    return static_cast<std::int64_t>(max);
+}
+
+}  // namespace eos
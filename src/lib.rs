@@ -6,18 +6,27 @@
 #![warn(missing_docs)]
 #![warn(unused_extern_crates)]
 
+// Everything that needs r2r (and so a sourced ROS install) sits behind the
+// default `ros` feature; the FFI staticlib is built without it.
+#[cfg(feature = "ros")]
 pub mod core;
 pub mod neural;
+#[cfg(feature = "ros")]
 pub mod ros_interface;
 pub mod navigation;
-pub mod apps;
+pub mod types;
+pub mod ffi;
 
 // Re-export commonly used items for easier access
-pub use core::{Localizer, SpatialMemory, PerceptionEngine, StateController, SystemAPI};
 pub use neural::{SNNEngine, NeuralConfig};
+#[cfg(feature = "ros")]
+pub use core::{Core, CoreState, Localization, Perception};
+#[cfg(feature = "ros")]
 pub use ros_interface::{RosInterface, Publisher, Subscriber};
 pub use navigation::{NavigationPlanner, MotionController};
+pub use types::{MotionCommand, Pose2D};
 
+#[cfg(feature = "ros")]
 /// Main configuration structure for Eos OS
 #[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
 pub struct EosConfig {
@@ -31,6 +40,7 @@ pub struct EosConfig {
     pub core_config: core::CoreConfig,
 }
 
+#[cfg(feature = "ros")]
 /// ROS 2 specific configuration
 #[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
 pub struct RosConfig {
@@ -42,6 +52,7 @@ pub struct RosConfig {
     pub qos_depth: usize,
 }
 
+#[cfg(feature = "ros")]
 /// Navigation system configuration
 #[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
 pub struct NavigationConfig {
@@ -55,6 +66,7 @@ pub struct NavigationConfig {
     pub goal_tolerance: f32,
 }
 
+#[cfg(feature = "ros")]
 impl Default for EosConfig {
     fn default() -> Self {
         EosConfig {
@@ -75,6 +87,7 @@ impl Default for EosConfig {
     }
 }
 
+#[cfg(feature = "ros")]
 /// Primary entry point for Eos OS
 pub struct EosOS {
     config: EosConfig,
@@ -85,6 +98,7 @@ pub struct EosOS {
     is_initialized: bool,
 }
 
+#[cfg(feature = "ros")]
 impl EosOS {
     /// Create a new Eos OS instance with the given configuration
     pub fn new(config: EosConfig) -> Result<Self, EosError> {
@@ -209,6 +223,7 @@ impl std::fmt::Display for EosError {
 
 impl std::error::Error for EosError {}
 
+#[cfg(feature = "ros")]
 /// Combined system status
 #[derive(Debug, Clone)]
 pub struct SystemStatus {
@@ -0,0 +1,302 @@
+/**
+* @file lif_engine.cpp
+* @brief Native leaky-integrate-and-fire spiking network engine
+*/
+
+#include "eos_robotics/lif_engine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "eos_robotics/kernels.hpp"
+
+namespace eos
+{
+
+PropagationMode parse_propagation_mode(const std::string& name)
+{
+    if (name == "dense") {
+        return PropagationMode::Dense;
+    }
+    if (name == "sparse") {
+        return PropagationMode::Sparse;
+    }
+    if (name == "auto") {
+        return PropagationMode::Automatic;
+    }
+    throw std::invalid_argument("Unknown propagation mode '" + name +
+                                "', expected dense, sparse or auto");
+}
+
+LifEngine::LifEngine(const LifConfig& config)
+    : LifEngine(LifModel::random(config), config)
+{
+}
+
+std::shared_ptr<const LifSynapses> LifSynapses::shared(std::shared_ptr<const LifModel> model,
+                                                       float prune_threshold)
+{
+    // Entries hold their model, so a live entry's key address cannot be reused
+    static std::mutex mutex;
+    static std::map<std::pair<const LifModel*, float>, std::weak_ptr<const LifSynapses>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = cache[{model.get(), prune_threshold}];
+    if (auto synapses = entry.lock()) {
+        return synapses;
+    }
+    auto synapses = std::make_shared<const LifSynapses>(std::move(model), prune_threshold);
+    entry = synapses;
+    for (auto it = cache.begin(); it != cache.end();) {
+        it = it->second.expired() ? cache.erase(it) : std::next(it);
+    }
+    return synapses;
+}
+
+LifSynapses::LifSynapses(std::shared_ptr<const LifModel> model, float prune_threshold)
+    : model_(std::move(model))
+{
+    const auto& layers = model_->layers();
+
+    // Pruning rewrites weights, so it works on a private copy of the model
+    const bool prune = prune_threshold > 0.0f;
+    if (prune) {
+        pruned_ = AlignedBuffer<float>(model_->weight_bytes() / sizeof(float));
+    }
+    std::size_t weight_total = 0;
+    for (const ModelLayer& source : layers) {
+        const float* weights = source.weights;
+        if (prune) {
+            float* copy = pruned_.data() + weight_total;
+            const std::size_t count = source.neurons * source.stride;
+            for (std::size_t k = 0; k < count; ++k) {
+                const float w = source.weights[k];
+                copy[k] = std::fabs(w) < prune_threshold ? 0.0f : w;
+            }
+            weights = copy;
+            weight_total += count;
+        }
+        weights_.push_back(weights);
+    }
+
+    // The first layer is driven by analog input and never takes the sparse
+    // path, so only layers fed by spikes get a CSR block
+    row_ptr_offset_.assign(layers.size(), 0);
+    for (std::size_t l = 1; l < layers.size(); ++l) {
+        const ModelLayer& layer = layers[l];
+        row_ptr_offset_[l] = csr_row_ptr_.size();
+        csr_row_ptr_.push_back(static_cast<std::uint32_t>(csr_index_.size()));
+        for (std::size_t c = 0; c < layer.inputs; ++c) {
+            for (std::size_t r = 0; r < layer.neurons; ++r) {
+                const float w = weights_[l][r * layer.stride + c];
+                if (w != 0.0f) {
+                    csr_index_.push_back(static_cast<std::uint32_t>(r));
+                    csr_weight_.push_back(w);
+                }
+            }
+            csr_row_ptr_.push_back(static_cast<std::uint32_t>(csr_index_.size()));
+        }
+    }
+}
+
+std::size_t LifSynapses::private_bytes() const
+{
+    return pruned_.size() * sizeof(float) + csr_row_ptr_.size() * sizeof(std::uint32_t) +
+           csr_index_.size() * sizeof(std::uint32_t) + csr_weight_.size() * sizeof(float);
+}
+
+LifEngine::LifEngine(std::shared_ptr<const LifModel> model, const LifConfig& config)
+    : config_(config),
+      model_(std::move(model))
+{
+    if (!model_ || config_.time_steps == 0 || config_.max_batch == 0) {
+        throw std::invalid_argument(
+            "LIF engine needs a model and non-zero time_steps and max_batch");
+    }
+
+    // The model defines the topology; the config only the dynamics
+    const auto& model_layers = model_->layers();
+    config_.input_size = model_->input_size();
+    config_.output_size = model_->output_size();
+    config_.hidden_layers = model_layers.size() - 1;
+    config_.hidden_neurons = model_layers.size() > 1 ? model_layers.front().neurons : 0;
+
+    for (const ModelLayer& source : model_layers) {
+        if (source.stride % kernels::kFloatLanes != 0) {
+            throw std::invalid_argument("Model row stride must be a multiple of the SIMD width");
+        }
+    }
+    synapses_ = LifSynapses::shared(model_, config_.synapse_prune_threshold);
+
+    // Each layer's state slot also pads the next layer's input to its stride,
+    // since matvec reads whole padded rows
+    std::size_t state_total = 0;
+    std::size_t widest = 0;
+    for (std::size_t i = 0; i < model_layers.size(); ++i) {
+        const ModelLayer& source = model_layers[i];
+        Layer layer;
+        layer.inputs = source.inputs;
+        layer.neurons = source.neurons;
+        layer.stride = source.stride;
+        layer.weights = synapses_->weights(i);
+        layer.state_offset = state_total;
+        layers_.push_back(layer);
+
+        std::size_t slot = round_up(layer.neurons, kernels::kFloatLanes);
+        if (i + 1 < model_layers.size()) {
+            slot = std::max(slot, model_layers[i + 1].stride);
+        }
+        state_total += slot;
+        widest = std::max(widest, layer.neurons);
+    }
+
+    // Every per-sample slice starts on a SIMD boundary
+    const std::size_t batch = config_.max_batch;
+    state_stride_ = state_total;
+    input_stride_ =
+        std::max(round_up(config_.input_size, kernels::kFloatLanes), layers_.front().stride);
+    drive_stride_ = round_up(layers_.front().neurons, kernels::kFloatLanes);
+    current_stride_ = round_up(widest, kernels::kFloatLanes);
+    output_stride_ = round_up(config_.output_size, kernels::kFloatLanes);
+
+    membrane_ = AlignedBuffer<float>(state_stride_ * batch);
+    spikes_ = AlignedBuffer<float>(state_stride_ * batch);
+    input_ = AlignedBuffer<float>(input_stride_ * batch);
+    drive_ = AlignedBuffer<float>(drive_stride_ * batch);
+    current_ = AlignedBuffer<float>(current_stride_ * batch);
+    spike_counts_ = AlignedBuffer<float>(output_stride_ * batch);
+    spike_queue_ = AlignedBuffer<std::uint32_t>(state_stride_ * batch);
+    queue_length_.assign(layers_.size() * batch, 0);
+}
+
+bool LifEngine::propagate(std::size_t layer_index, std::size_t batch)
+{
+    const Layer& layer = layers_[layer_index];
+    const Layer& previous = layers_[layer_index - 1];
+    const std::size_t layer_count = layers_.size();
+
+    std::size_t fired = 0;
+    for (std::size_t b = 0; b < batch; ++b) {
+        fired += queue_length_[b * layer_count + layer_index - 1];
+    }
+
+    // One decision for the whole batch keeps the dense path batched
+    bool sparse = false;
+    switch (config_.propagation) {
+        case PropagationMode::Dense:
+            break;
+        case PropagationMode::Sparse:
+            sparse = true;
+            break;
+        case PropagationMode::Automatic:
+            sparse = static_cast<float>(fired) <=
+                     config_.sparse_density_threshold *
+                     static_cast<float>(previous.neurons * batch);
+            break;
+    }
+
+    if (!sparse) {
+        kernels::matvec_batch(layer.weights, layer.neurons, layer.stride,
+                              spikes_.data() + previous.state_offset, state_stride_, batch,
+                              current_.data(), current_stride_);
+        return false;
+    }
+
+    const std::uint32_t* row_ptr = synapses_->row_ptr(layer_index);
+    const std::uint32_t* csr_index = synapses_->csr_index();
+    const float* csr_weight = synapses_->csr_weight();
+    for (std::size_t b = 0; b < batch; ++b) {
+        float* current = current_.data() + b * current_stride_;
+        std::fill(current, current + layer.neurons, 0.0f);
+        const std::uint32_t* queue = spike_queue_.data() + b * state_stride_ + previous.state_offset;
+        const std::size_t count = queue_length_[b * layer_count + layer_index - 1];
+        for (std::size_t k = 0; k < count; ++k) {
+            const std::uint32_t begin = row_ptr[queue[k]];
+            const std::uint32_t end = row_ptr[queue[k] + 1];
+            kernels::scatter_add(current, csr_index + begin, csr_weight + begin, end - begin);
+        }
+    }
+    return true;
+}
+
+void LifEngine::run(const float* inputs, float* outputs)
+{
+    run_batch(inputs, 1, outputs);
+}
+
+void LifEngine::run_batch(const float* inputs, std::size_t batch, float* outputs)
+{
+    if (batch == 0 || batch > config_.max_batch) {
+        throw std::invalid_argument("Batch of " + std::to_string(batch) +
+                                    " outside 1.." + std::to_string(config_.max_batch));
+    }
+
+    std::fill_n(membrane_.data(), state_stride_ * batch, 0.0f);
+    std::fill_n(spikes_.data(), state_stride_ * batch, 0.0f);
+    std::fill_n(spike_counts_.data(), output_stride_ * batch, 0.0f);
+    for (std::size_t b = 0; b < batch; ++b) {
+        std::memcpy(input_.data() + b * input_stride_, inputs + b * config_.input_size,
+                    config_.input_size * sizeof(float));
+    }
+
+    // The input is held constant over the window, so its projection onto the
+    // first layer is computed once instead of every timestep
+    const Layer& first = layers_.front();
+    kernels::matvec_batch(first.weights, first.neurons, first.stride,
+                          input_.data(), input_stride_, batch, drive_.data(), drive_stride_);
+
+    const Layer& last = layers_.back();
+    const std::size_t layer_count = layers_.size();
+    const bool track_queues = config_.propagation != PropagationMode::Dense;
+    std::size_t total_spikes = 0;
+    std::size_t sparse_propagations = 0;
+
+    for (std::size_t t = 0; t < config_.time_steps; ++t) {
+        for (std::size_t l = 0; l < layer_count; ++l) {
+            const Layer& layer = layers_[l];
+            const float* current = drive_.data();
+            std::size_t current_stride = drive_stride_;
+            if (l > 0) {
+                sparse_propagations += propagate(l, batch) ? 1 : 0;
+                current = current_.data();
+                current_stride = current_stride_;
+            }
+            for (std::size_t b = 0; b < batch; ++b) {
+                const std::size_t state = b * state_stride_ + layer.state_offset;
+                float* spikes = spikes_.data() + state;
+                const std::size_t fired = kernels::lif_step(
+                    membrane_.data() + state, current + b * current_stride, spikes,
+                    layer.neurons, config_.membrane_decay, config_.spike_threshold);
+                total_spikes += fired;
+
+                // The output layer feeds nothing, so its queue is never needed
+                queue_length_[b * layer_count + l] = fired;
+                if (track_queues && l + 1 < layer_count && fired > 0) {
+                    kernels::gather_spike_indices(spikes, layer.neurons,
+                                                  spike_queue_.data() + state);
+                }
+            }
+        }
+        for (std::size_t b = 0; b < batch; ++b) {
+            kernels::accumulate(spike_counts_.data() + b * output_stride_,
+                                spikes_.data() + b * state_stride_ + last.state_offset,
+                                last.neurons);
+        }
+    }
+
+    for (std::size_t b = 0; b < batch; ++b) {
+        std::memcpy(outputs + b * config_.output_size, spike_counts_.data() + b * output_stride_,
+                    config_.output_size * sizeof(float));
+    }
+    kernels::scale(outputs, config_.output_size * batch,
+                   1.0f / static_cast<float>(config_.time_steps));
+    last_spike_count_ = total_spikes;
+    last_sparse_propagations_ = sparse_propagations;
+}
+
+}  // namespace eos
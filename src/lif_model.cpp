@@ -0,0 +1,334 @@
+/**
+* @file lif_model.cpp
+* @brief Immutable LIF network weights and the memory-mapped .eosm model format
+*/
+
+#include "eos_robotics/lif_model.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "eos_robotics/lif_engine.hpp"
+
+namespace eos
+{
+
+namespace
+{
+
+std::runtime_error model_error(const std::string& path, const std::string& what)
+{
+    return std::runtime_error("Model '" + path + "': " + what);
+}
+
+// Models handed out by load_shared() / open_shared(), by file identity or
+// seed and topology; an entry lives as long as someone holds the model
+std::shared_ptr<const LifModel> cached_model(
+    const std::string& key, const std::function<std::shared_ptr<const LifModel>()>& make)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<const LifModel>> cache;
+
+    // Held while building, so robots starting together map the file once
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& entry = cache[key];
+    if (auto model = entry.lock()) {
+        return model;
+    }
+    auto model = make();
+    entry = model;
+    for (auto it = cache.begin(); it != cache.end();) {
+        it = it->second.expired() ? cache.erase(it) : std::next(it);
+    }
+    return model;
+}
+
+std::string file_key(const std::string& path)
+{
+    struct stat info;
+    if (::stat(path.c_str(), &info) != 0) {
+        throw model_error(path, std::strerror(errno));
+    }
+    std::error_code error;
+    const auto canonical = std::filesystem::canonical(path, error);
+    return "file:" + (error ? path : canonical.string()) + ":" + std::to_string(info.st_size) +
+           ":" + std::to_string(info.st_mtim.tv_sec) + "." + std::to_string(info.st_mtim.tv_nsec);
+}
+
+}  // namespace
+
+std::shared_ptr<const LifModel> LifModel::random(const LifConfig& config)
+{
+    if (config.input_size == 0 || config.output_size == 0 || config.hidden_neurons == 0) {
+        throw std::invalid_argument("LIF topology sizes must be non-zero");
+    }
+
+    // input -> hidden x N -> output
+    std::vector<std::size_t> widths;
+    widths.push_back(config.input_size);
+    for (std::size_t i = 0; i < config.hidden_layers; ++i) {
+        widths.push_back(config.hidden_neurons);
+    }
+    widths.push_back(config.output_size);
+
+    std::vector<std::size_t> offsets;
+    std::size_t total = 0;
+    for (std::size_t i = 1; i < widths.size(); ++i) {
+        offsets.push_back(total);
+        total += widths[i] * round_up(widths[i - 1], kModelRowFloats);
+    }
+
+    std::shared_ptr<LifModel> model(new LifModel());
+    model->owned_ = AlignedBuffer<float>(total);
+
+    std::mt19937 rng(config.seed);
+    for (std::size_t i = 1; i < widths.size(); ++i) {
+        ModelLayer layer;
+        layer.inputs = widths[i - 1];
+        layer.neurons = widths[i];
+        layer.stride = round_up(layer.inputs, kModelRowFloats);
+        float* weights = model->owned_.data() + offsets[i - 1];
+        layer.weights = weights;
+
+        const float limit = std::sqrt(6.0f / static_cast<float>(layer.inputs + layer.neurons));
+        std::uniform_real_distribution<float> dist(-limit, limit);
+        for (std::size_t r = 0; r < layer.neurons; ++r) {
+            for (std::size_t c = 0; c < layer.inputs; ++c) {
+                weights[r * layer.stride + c] = dist(rng);
+            }
+        }
+        model->layers_.push_back(layer);
+    }
+    return model;
+}
+
+std::shared_ptr<const LifModel> LifModel::load(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw model_error(path, std::strerror(errno));
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw model_error(path, std::strerror(error));
+    }
+    const auto size = static_cast<std::size_t>(info.st_size);
+    if (size < sizeof(ModelFileHeader)) {
+        ::close(fd);
+        throw model_error(path, "too small for an .eosm header");
+    }
+
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    const int map_error = errno;
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw model_error(path, std::strerror(map_error));
+    }
+
+    // Owns the mapping from here on, so every validation failure unmaps it
+    std::shared_ptr<LifModel> model(new LifModel());
+    model->mapping_ = mapping;
+    model->mapping_size_ = size;
+
+    const auto* base = static_cast<const std::uint8_t*>(mapping);
+    ModelFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, kModelMagic, sizeof(kModelMagic)) != 0) {
+        throw model_error(path, "not an .eosm model (bad magic)");
+    }
+    if (header.version != kModelFormatVersion) {
+        throw model_error(path, "unsupported format version " + std::to_string(header.version));
+    }
+    if (header.header_size != sizeof(ModelFileHeader) || header.file_size != size) {
+        throw model_error(path, "header does not match the file size (truncated?)");
+    }
+    if (header.layer_count == 0 || header.layer_table_offset > size ||
+        header.layer_count > (size - header.layer_table_offset) / sizeof(ModelLayerRecord))
+    {
+        throw model_error(path, "layer table out of bounds");
+    }
+
+    for (std::uint32_t i = 0; i < header.layer_count; ++i) {
+        ModelLayerRecord record;
+        std::memcpy(&record, base + header.layer_table_offset + i * sizeof(record), sizeof(record));
+
+        const std::string name = "layer " + std::to_string(i) + ": ";
+        if (record.inputs == 0 || record.neurons == 0 ||
+            record.stride < record.inputs || record.stride % kModelRowFloats != 0)
+        {
+            throw model_error(path, name + "invalid dimensions");
+        }
+        if (record.weight_offset % kModelBlobAlignment != 0 ||
+            record.weight_bytes != std::uint64_t{record.neurons} * record.stride * sizeof(float) ||
+            record.weight_offset > size || record.weight_bytes > size - record.weight_offset)
+        {
+            throw model_error(path, name + "weight blob misaligned or out of bounds");
+        }
+        if (i > 0 && record.inputs != model->layers_.back().neurons) {
+            throw model_error(path, name + "inputs do not match the previous layer");
+        }
+
+        ModelLayer layer;
+        layer.inputs = record.inputs;
+        layer.neurons = record.neurons;
+        layer.stride = record.stride;
+        layer.weights = reinterpret_cast<const float*>(base + record.weight_offset);
+        model->layers_.push_back(layer);
+    }
+
+    // Fault the weights in now rather than on the first inference
+    ::madvise(mapping, size, MADV_WILLNEED);
+    return model;
+}
+
+std::shared_ptr<const LifModel> LifModel::open(const std::string& path, const LifConfig& config)
+{
+    if (path.empty() || !std::filesystem::exists(path)) {
+        return random(config);
+    }
+    if (std::filesystem::path(path).extension() == ".json") {
+        throw std::invalid_argument(
+            "JSON model '" + path + "' must be converted with scripts/convert_model.py");
+    }
+    return load(path);
+}
+
+std::shared_ptr<const LifModel> LifModel::load_shared(const std::string& path)
+{
+    return cached_model(file_key(path), [&path] { return load(path); });
+}
+
+std::shared_ptr<const LifModel> LifModel::open_shared(const std::string& path,
+                                                      const LifConfig& config)
+{
+    if (path.empty() || !std::filesystem::exists(path)) {
+        const std::string key = "seed:" + std::to_string(config.seed) + ":" +
+                                std::to_string(config.input_size) + ":" +
+                                std::to_string(config.hidden_layers) + "x" +
+                                std::to_string(config.hidden_neurons) + ":" +
+                                std::to_string(config.output_size);
+        return cached_model(key, [&config] { return random(config); });
+    }
+    if (std::filesystem::path(path).extension() == ".json") {
+        return open(path, config);
+    }
+    return load_shared(path);
+}
+
+void LifModel::save(const LifModel& model, const std::string& path)
+{
+    const std::size_t table_offset = sizeof(ModelFileHeader);
+    std::size_t offset = round_up(table_offset + model.layers_.size() * sizeof(ModelLayerRecord),
+                                  kModelBlobAlignment);
+
+    std::vector<ModelLayerRecord> records;
+    for (const ModelLayer& layer : model.layers_) {
+        ModelLayerRecord record{};
+        record.inputs = static_cast<std::uint32_t>(layer.inputs);
+        record.neurons = static_cast<std::uint32_t>(layer.neurons);
+        record.stride = static_cast<std::uint32_t>(round_up(layer.inputs, kModelRowFloats));
+        record.weight_offset = offset;
+        record.weight_bytes = std::uint64_t{record.neurons} * record.stride * sizeof(float);
+        offset = round_up(offset + record.weight_bytes, kModelBlobAlignment);
+        records.push_back(record);
+    }
+
+    ModelFileHeader header{};
+    std::memcpy(header.magic, kModelMagic, sizeof(kModelMagic));
+    header.version = kModelFormatVersion;
+    header.header_size = sizeof(ModelFileHeader);
+    header.layer_count = static_cast<std::uint32_t>(records.size());
+    header.file_size = offset;
+    header.layer_table_offset = table_offset;
+
+    // Running nodes map the file MAP_SHARED, so it is never rewritten in
+    // place: the new model is written beside it and renamed over it
+    const std::string temp_path = path + ".tmp";
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw model_error(temp_path, "cannot open for writing");
+    }
+    const auto pad_to = [&out](std::size_t position) {
+        static const char zeros[kModelBlobAlignment] = {};
+        auto current = static_cast<std::size_t>(out.tellp());
+        while (current < position) {
+            const std::size_t chunk = std::min(position - current, sizeof(zeros));
+            out.write(zeros, static_cast<std::streamsize>(chunk));
+            current += chunk;
+        }
+    };
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records.data()),
+              static_cast<std::streamsize>(records.size() * sizeof(ModelLayerRecord)));
+
+    std::vector<float> row;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const ModelLayer& layer = model.layers_[i];
+        pad_to(records[i].weight_offset);
+        row.assign(records[i].stride, 0.0f);
+        for (std::size_t r = 0; r < layer.neurons; ++r) {
+            std::memcpy(row.data(), layer.weights + r * layer.stride, layer.inputs * sizeof(float));
+            out.write(reinterpret_cast<const char*>(row.data()),
+                      static_cast<std::streamsize>(row.size() * sizeof(float)));
+        }
+    }
+    pad_to(offset);
+
+    out.close();
+    if (!out) {
+        std::remove(temp_path.c_str());
+        throw model_error(temp_path, "write failed");
+    }
+    const int fd = ::open(temp_path.c_str(), O_RDONLY | O_CLOEXEC);
+    const bool synced = fd >= 0 && ::fsync(fd) == 0;
+    const int sync_error = errno;
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    if (!synced) {
+        std::remove(temp_path.c_str());
+        throw model_error(temp_path, std::string("fsync failed: ") + std::strerror(sync_error));
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        const int rename_error = errno;
+        std::remove(temp_path.c_str());
+        throw model_error(path, std::string("rename failed: ") + std::strerror(rename_error));
+    }
+}
+
+LifModel::~LifModel()
+{
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+std::size_t LifModel::weight_bytes() const
+{
+    std::size_t bytes = 0;
+    for (const ModelLayer& layer : layers_) {
+        bytes += layer.neurons * layer.stride * sizeof(float);
+    }
+    return bytes;
+}
+
+}  // namespace eos
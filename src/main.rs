@@ -8,7 +8,7 @@
 use r2r::{QosProfile, Node, Context};
 use log::{info, error};
 use env_logger;
-use eos_os::{
+use eos::{
     neural::Snn,
     ros_interface::{Publisher, Subscriber},
     navigation::Planner,
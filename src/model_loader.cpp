@@ -0,0 +1,83 @@
+/**
+* @file model_loader.cpp
+* @brief Background loading of replacement models for a running NeuralBridge
+*/
+
+#include "eos_robotics/model_loader.hpp"
+
+#include <chrono>
+#include <exception>
+#include <memory>
+
+#include "eos_robotics/lif_model.hpp"
+
+namespace eos
+{
+
+ModelLoader::ModelLoader(NeuralBridge& bridge)
+    : bridge_(bridge),
+      worker_([this]() { run(); })
+{
+}
+
+ModelLoader::~ModelLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    worker_.join();
+
+    for (const auto& pending : queue_) {
+        pending.second(false, "Cancelled: model loader shutting down");
+    }
+}
+
+void ModelLoader::request(const std::string& path, Callback done)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.emplace_back(path, std::move(done));
+    }
+    wake_.notify_one();
+}
+
+void ModelLoader::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+        auto next = std::move(queue_.front());
+        queue_.pop_front();
+
+        lock.unlock();
+        load(next.first, next.second);
+        lock.lock();
+    }
+}
+
+void ModelLoader::load(const std::string& path, const Callback& done)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::string message;
+    bool success = false;
+    try {
+        bridge_.stage(bridge_.build_backend(LifModel::load_shared(path)));
+
+        const auto elapsed = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        message = "Loaded " + path + " in " + std::to_string(elapsed) +
+                  " ms, active from the next inference";
+        success = true;
+    }
+    catch (const std::exception& e) {
+        message = e.what();
+    }
+    done(success, message);
+}
+
+}  // namespace eos
@@ -1,24 +1,24 @@
 // src/navigation/controller.rs
 // Executes navigation commands by sending motor actions to the robot.
-// Imports shared NavCommand type from lib.rs.
+// Imports the shared MotionCommand type.
 
-use crate::NavCommand;
+use crate::types::MotionCommand;
 use log::info;
 
-// Controller struct to handle motor commands.
-// Currently a placeholder; will integrate with ROS 2 publisher.
+/// Controller struct to handle motor commands.
+/// Currently a placeholder; will integrate with ROS 2 publisher.
 pub struct Controller;
 
 impl Controller {
-    // Creates a new controller instance.
+    /// Creates a new controller instance.
     pub fn new() -> Self {
         Controller
     }
 
-    // Executes a navigation command by logging it (placeholder for ROS 2 integration).
-    // - cmd: Navigation command with linear/angular velocities.
-    // In production, sends to /cmd_vel via Publisher.
-    pub fn execute(&self, cmd: &NavCommand) {
+    /// Executes a navigation command by logging it (placeholder for ROS 2 integration).
+    /// - cmd: Navigation command with linear/angular velocities.
+    /// In production, sends to /cmd_vel via Publisher.
+    pub fn execute(&self, cmd: &MotionCommand) {
         info!(
             "Executing command: linear={}, angular={}",
             cmd.linear, cmd.angular
@@ -3,8 +3,18 @@
 //! This module handles path planning, obstacle avoidance, and motion control
 //! based on sensor data and neural network outputs.
 
+/// Command executor used by the eos binary
+pub mod controller;
+/// SNN-driven planner used by the eos binary
+pub mod planner;
+
 use std::collections::VecDeque;
 
+use crate::types::{MotionCommand, Pose2D};
+
+pub use controller::Controller;
+pub use planner::Planner;
+
 /// Navigation planner for path planning and obstacle avoidance
 pub struct NavigationPlanner {
     config: NavigationConfig,
@@ -39,6 +49,24 @@ pub struct NavigationConfig {
     pub obstacle_inflation: f32,
 }
 
+/// Borrowed view of one laser scan
+///
+/// Lets callers outside ROS (the C ABI in `crate::ffi`) hand over their own
+/// range buffer without building an r2r message.
+#[derive(Debug, Clone, Copy)]
+pub struct ScanView<'a> {
+    /// Ranges in meters, one per beam
+    pub ranges: &'a [f32],
+    /// Angle of the first beam (rad)
+    pub angle_min: f32,
+    /// Angle between beams (rad)
+    pub angle_increment: f32,
+    /// Minimum valid range
+    pub range_min: f32,
+    /// Maximum valid range
+    pub range_max: f32,
+}
+
 /// Navigation status
 #[derive(Debug, Clone)]
 pub struct NavigationStatus {
@@ -158,14 +186,33 @@ impl NavigationPlanner {
     }
     
     /// Plan a path based on sensor data and neural output
+    #[cfg(feature = "ros")]
     pub fn plan(
         &mut self,
         sensor_data: &super::ros_interface::SensorData,
         neural_output: &[f32],
         current_pose: Option<Pose2D>,
     ) -> Result<Path, NavigationError> {
-        // Update obstacle map from sensor data
-        self.update_obstacle_map(sensor_data);
+        let scan = &sensor_data.laser_scan;
+        let scan = ScanView {
+            ranges: &scan.ranges,
+            angle_min: scan.angle_min,
+            angle_increment: scan.angle_increment,
+            range_min: scan.range_min,
+            range_max: scan.range_max,
+        };
+        self.plan_scan(&scan, neural_output, current_pose)
+    }
+    
+    /// Plan a path from a borrowed scan and neural output
+    pub fn plan_scan(
+        &mut self,
+        scan: &ScanView,
+        neural_output: &[f32],
+        current_pose: Option<Pose2D>,
+    ) -> Result<Path, NavigationError> {
+        // Update obstacle map from the scan
+        self.update_obstacle_map(scan);
         
         // Apply neural network guidance
         self.apply_neural_guidance(neural_output);
@@ -181,11 +228,9 @@ impl NavigationPlanner {
             self.plan_exploration_path(current_pose)
         };
         
-        // Check safety
-        self.check_safety(&path);
-        
-        // Store path history
+        // Check safety and store path history
         if let Ok(path) = &path {
+            self.check_safety(path);
             self.store_path_history(path);
         }
         
@@ -225,12 +270,11 @@ impl NavigationPlanner {
         }
     }
     
-    /// Update obstacle map from sensor data
-    fn update_obstacle_map(&mut self, sensor_data: &super::ros_interface::SensorData) {
+    /// Update obstacle map from a laser scan
+    fn update_obstacle_map(&mut self, scan: &ScanView) {
         self.obstacle_map.clear();
         
         // Process laser scan data for obstacles
-        let scan = &sensor_data.laser_scan;
         for (i, range) in scan.ranges.iter().enumerate() {
             if *range < scan.range_max && *range > scan.range_min {
                 let angle = scan.angle_min + (i as f32) * scan.angle_increment;
@@ -3,8 +3,10 @@
 
 // Imports dependencies and shared types.
 // - Snn: Neural network for decision-making.
-// - SensorData, NavCommand: Shared types from lib.rs.
-use crate::{Snn, SensorData, NavCommand};
+// - ScanView, MotionCommand: Shared scan and command types.
+use crate::navigation::ScanView;
+use crate::neural::Snn;
+use crate::types::MotionCommand;
 
 /// Planner struct to integrate SNN and generate navigation plans.
 pub struct Planner {
@@ -19,8 +21,8 @@ impl Planner {
 
     /// Plans a navigation path based on sensor data.
     /// - `data`: LIDAR data from Subscriber.
-    /// Returns a `NavCommand` (linear/angular velocities).
-    pub fn plan(&self, data: &SensorData) -> NavCommand {
+    /// Returns a `MotionCommand` (linear/angular velocities).
+    pub fn plan(&self, data: &ScanView) -> MotionCommand {
         // Delegate to SNN for decision-making
         // In MVP, SNN handles basic obstacle avoidance logic
         self.snn.process(data)
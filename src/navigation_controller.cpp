@@ -0,0 +1,267 @@
+/**
+* @file navigation_controller.cpp
+* @brief Dynamic-window local planner over precomputed rollouts
+*/
+
+#include "eos_robotics/navigation_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "eos_robotics/kernels.hpp"
+#include "eos_robotics/distance_field.hpp"
+
+namespace eos
+{
+
+NavigationController::NavigationController(const NavigationControllerConfig& config)
+    : config_(config)
+{
+    if (config_.max_linear_velocity <= 0.0f || config_.max_angular_velocity <= 0.0f ||
+        config_.max_linear_acceleration <= 0.0f || config_.max_angular_acceleration <= 0.0f) {
+        throw std::invalid_argument("Navigation velocity and acceleration limits must be positive");
+    }
+    if (config_.control_period <= 0.0f || config_.horizon <= 0.0f || config_.rollout_step <= 0.0f) {
+        throw std::invalid_argument("Navigation control period and rollout times must be positive");
+    }
+    if (config_.linear_samples < 2 || config_.angular_samples < 2) {
+        throw std::invalid_argument("Navigation needs at least 2 linear and 2 angular samples");
+    }
+    if (config_.obstacle_sectors == 0 || config_.robot_radius < 0.0f ||
+        config_.safety_distance <= 0.0f) {
+        throw std::invalid_argument(
+            "Navigation needs obstacle sectors, a non-negative radius and a positive safety distance");
+    }
+
+    steps_ = static_cast<std::size_t>(std::ceil(config_.horizon / config_.rollout_step - 1e-4f));
+    steps_ = std::max<std::size_t>(steps_, 1);
+    row_stride_ = round_up(config_.angular_samples, kernels::kFloatLanes);
+    table_stride_ = config_.linear_samples * row_stride_;
+    linear_step_ = config_.max_linear_velocity / static_cast<float>(config_.linear_samples - 1);
+    angular_step_ =
+        2.0f * config_.max_angular_velocity / static_cast<float>(config_.angular_samples - 1);
+    reach_ = config_.max_linear_velocity * config_.horizon + config_.robot_radius +
+             config_.safety_distance;
+
+    rollout_x_ = AlignedBuffer<float>(steps_ * table_stride_);
+    rollout_y_ = AlignedBuffer<float>(steps_ * table_stride_);
+    clearance_sq_ = AlignedBuffer<float>(table_stride_);
+    sector_range_.assign(config_.obstacle_sectors, 0.0f);
+    sector_angle_.assign(config_.obstacle_sectors, 0.0f);
+    obstacle_x_ = AlignedBuffer<float>(config_.obstacle_sectors);
+    obstacle_y_ = AlignedBuffer<float>(config_.obstacle_sectors);
+
+    build_lattice();
+}
+
+void NavigationController::build_lattice()
+{
+    for (std::size_t i = 0; i < config_.linear_samples; ++i) {
+        const float v = static_cast<float>(i) * linear_step_;
+        for (std::size_t j = 0; j < config_.angular_samples; ++j) {
+            const float w = -config_.max_angular_velocity + static_cast<float>(j) * angular_step_;
+            const std::size_t sample = i * row_stride_ + j;
+            for (std::size_t k = 0; k < steps_; ++k) {
+                const float t = std::min(static_cast<float>(k + 1) * config_.rollout_step,
+                                         config_.horizon);
+                // Constant (v, w) traces an arc, or a line when w is zero
+                float x = v * t;
+                float y = 0.0f;
+                if (std::abs(w) > 1e-6f) {
+                    x = v / w * std::sin(w * t);
+                    y = v / w * (1.0f - std::cos(w * t));
+                }
+                rollout_x_[k * table_stride_ + sample] = x;
+                rollout_y_[k * table_stride_ + sample] = y;
+            }
+        }
+    }
+}
+
+void NavigationController::update_scan(const float* ranges, std::size_t count, float range_min,
+                                       float range_max, float angle_min, float angle_increment)
+{
+    const std::size_t sectors = config_.obstacle_sectors;
+    std::fill(sector_range_.begin(), sector_range_.end(), std::numeric_limits<float>::infinity());
+
+    const float limit = std::min(range_max, reach_);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float range = ranges[i];
+        // Ordered compares reject NaN; inf fails the upper bound
+        if (!(range >= range_min && range <= limit)) {
+            continue;
+        }
+        const std::size_t sector = i * sectors / count;
+        if (range < sector_range_[sector]) {
+            sector_range_[sector] = range;
+            sector_angle_[sector] = angle_min + static_cast<float>(i) * angle_increment;
+        }
+    }
+
+    obstacle_count_ = 0;
+    for (std::size_t sector = 0; sector < sectors; ++sector) {
+        if (std::isfinite(sector_range_[sector])) {
+            obstacle_x_[obstacle_count_] = sector_range_[sector] * std::cos(sector_angle_[sector]);
+            obstacle_y_[obstacle_count_] = sector_range_[sector] * std::sin(sector_angle_[sector]);
+            ++obstacle_count_;
+        }
+    }
+    has_scan_ = true;
+}
+
+void NavigationController::set_goal(const Pose2D& goal)
+{
+    goal_ = goal;
+    has_goal_ = true;
+    holding_ = false;
+}
+
+void NavigationController::clear_goal()
+{
+    has_goal_ = false;
+    holding_ = false;
+}
+
+NavigationController::IndexRange NavigationController::window(
+    float current, float acceleration, float minimum, float step, std::size_t count) const
+{
+    const float maximum = minimum + step * static_cast<float>(count - 1);
+    const float reachable = acceleration * config_.control_period;
+    const float lo = (std::max(current - reachable, minimum) - minimum) / step;
+    const float hi = (std::min(current + reachable, maximum) - minimum) / step;
+
+    // Lattice points inside the window, or the two that bracket a narrow one
+    long first = static_cast<long>(std::ceil(lo - 1e-4f));
+    long last = static_cast<long>(std::floor(hi + 1e-4f));
+    if (first > last) {
+        first = static_cast<long>(std::floor(lo));
+        last = static_cast<long>(std::ceil(hi));
+    }
+    const long top = static_cast<long>(count) - 1;
+    return {static_cast<std::size_t>(std::clamp(first, 0L, top)),
+            static_cast<std::size_t>(std::clamp(last, 0L, top))};
+}
+
+float NavigationController::map_clearance(const Pose2D& pose, float c, float s,
+                                          std::size_t sample) const
+{
+    float clearance = map_->max_distance();
+    for (std::size_t k = 0; k < steps_; ++k) {
+        const float x = rollout_x_[k * table_stride_ + sample];
+        const float y = rollout_y_[k * table_stride_ + sample];
+        clearance =
+            std::min(clearance, map_->distance(pose.x + c * x - s * y, pose.y + s * x + c * y));
+    }
+    return clearance;
+}
+
+VelocityCommand NavigationController::compute_command(const Pose2D& pose)
+{
+    evaluated_ = 0;
+    admissible_ = 0;
+    if (!has_scan_ || holding_) {
+        last_command_ = VelocityCommand{};
+        return last_command_;
+    }
+
+    // Goal in the robot frame
+    const float c = std::cos(pose.theta);
+    const float s = std::sin(pose.theta);
+    float goal_x = 0.0f;
+    float goal_y = 0.0f;
+    float goal_distance = 0.0f;
+    if (has_goal_) {
+        const float dx = goal_.x - pose.x;
+        const float dy = goal_.y - pose.y;
+        goal_x = c * dx + s * dy;
+        goal_y = -s * dx + c * dy;
+        goal_distance = std::hypot(goal_x, goal_y);
+        if (goal_distance <= config_.goal_tolerance) {
+            has_goal_ = false;
+            holding_ = true;
+            last_command_ = VelocityCommand{};
+            return last_command_;
+        }
+    }
+
+    const float linear_min = 0.0f;
+    const float angular_min = -config_.max_angular_velocity;
+    const IndexRange rows = window(last_command_.linear, config_.max_linear_acceleration,
+                                   linear_min, linear_step_, config_.linear_samples);
+    const IndexRange cols = window(last_command_.angular, config_.max_angular_acceleration,
+                                   angular_min, angular_step_, config_.angular_samples);
+
+    // Whole vectors around the window's columns, so the kernel runs unmasked
+    const std::size_t block_begin = cols.first / kernels::kFloatLanes * kernels::kFloatLanes;
+    const std::size_t block_end = std::min(round_up(cols.last + 1, kernels::kFloatLanes), row_stride_);
+    const std::size_t block = block_end - block_begin;
+
+    const std::size_t end_table = (steps_ - 1) * table_stride_;
+    const float* end_x = rollout_x_.data() + end_table;
+    const float* end_y = rollout_y_.data() + end_table;
+    const float progress_scale = 1.0f / (config_.max_linear_velocity * config_.horizon);
+
+    float best_score = -std::numeric_limits<float>::infinity();
+    std::size_t best_row = 0;
+    std::size_t best_col = 0;
+    for (std::size_t i = rows.first; i <= rows.last; ++i) {
+        const std::size_t base = i * row_stride_ + block_begin;
+        float* clearance = clearance_sq_.data() + base;
+        std::fill(clearance, clearance + block, std::numeric_limits<float>::infinity());
+        for (std::size_t k = 0; k < steps_; ++k) {
+            kernels::min_squared_distance(
+                rollout_x_.data() + k * table_stride_ + base,
+                rollout_y_.data() + k * table_stride_ + base, block,
+                obstacle_x_.data(), obstacle_y_.data(), obstacle_count_, clearance);
+        }
+
+        const float v = static_cast<float>(i) * linear_step_;
+        const float speed_score = v / config_.max_linear_velocity;
+        for (std::size_t j = cols.first; j <= cols.last; ++j) {
+            ++evaluated_;
+            const std::size_t sample = i * row_stride_ + j;
+            float margin = std::sqrt(clearance_sq_[sample]) - config_.robot_radius;
+            if (margin >= 0.0f && map_) {
+                margin = std::min(margin, map_clearance(pose, c, s, sample) - config_.robot_radius);
+            }
+            if (margin < 0.0f) {
+                continue;
+            }
+            ++admissible_;
+
+            const float progress = has_goal_
+                ? goal_distance - std::hypot(goal_x - end_x[sample], goal_y - end_y[sample])
+                : end_x[sample];
+            const float score =
+                config_.goal_weight * progress * progress_scale +
+                config_.clearance_weight * std::min(margin, config_.safety_distance) /
+                    config_.safety_distance +
+                config_.velocity_weight * speed_score;
+            if (score > best_score) {
+                best_score = score;
+                best_row = i;
+                best_col = j;
+            }
+        }
+    }
+
+    if (admissible_ == 0) {
+        last_command_ = VelocityCommand{};
+        return last_command_;
+    }
+
+    // Bracketing lattice points may lie just outside the window
+    const float linear_reach = config_.max_linear_acceleration * config_.control_period;
+    const float angular_reach = config_.max_angular_acceleration * config_.control_period;
+    const float linear = static_cast<float>(best_row) * linear_step_;
+    const float angular = angular_min + static_cast<float>(best_col) * angular_step_;
+    last_command_.linear = std::clamp(linear, last_command_.linear - linear_reach,
+                                      last_command_.linear + linear_reach);
+    last_command_.angular = std::clamp(angular, last_command_.angular - angular_reach,
+                                       last_command_.angular + angular_reach);
+    return last_command_;
+}
+
+}  // namespace eos
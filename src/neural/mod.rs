@@ -5,6 +5,8 @@
 pub mod snn;
 pub mod config;
 
+pub use snn::Snn;
+
 use serde::{Deserialize, Serialize};
 use std::collections::VecDeque;
 
@@ -152,6 +154,7 @@ impl SNNEngine {
     }
     
     /// Process sensor data through the neural network
+    #[cfg(feature = "ros")]
     pub fn process(&mut self, sensor_data: &super::ros_interface::SensorData) -> Result<Vec<f32>, NeuralError> {
         if !self.is_initialized {
             return Err(NeuralError::NotInitialized);
@@ -182,6 +185,23 @@ impl SNNEngine {
         Ok(output)
     }
     
+    /// Run already preprocessed features through the network
+    ///
+    /// `input` holds `input_size` values and `output` receives `output_size`
+    /// values; neither is copied or buffered.
+    pub fn process_features(&self, input: &[f32], output: &mut [f32]) -> Result<(), NeuralError> {
+        if !self.is_initialized {
+            return Err(NeuralError::NotInitialized);
+        }
+        if input.len() != self.config.input_size || output.len() != self.config.output_size {
+            return Err(NeuralError::ProcessingError(format!(
+                "expected {} inputs and {} outputs, got {} and {}",
+                self.config.input_size, self.config.output_size, input.len(), output.len()
+            )));
+        }
+        self.process_into(input, output)
+    }
+    
     /// Get current neural engine status
     pub fn get_status(&self) -> NeuralStatus {
         NeuralStatus {
@@ -194,6 +214,7 @@ impl SNNEngine {
     }
     
     /// Preprocess sensor data for neural network input
+    #[cfg(feature = "ros")]
     fn preprocess_sensor_data(&self, sensor_data: &super::ros_interface::SensorData) -> Vec<f32> {
         // Simple preprocessing - would be more complex in production
         let mut input = Vec::with_capacity(self.config.input_size);
@@ -215,24 +236,31 @@ impl SNNEngine {
     }
     
     /// Process input through the neural network
+    #[cfg(feature = "ros")]
     fn process_input(&self, input: &[f32]) -> Result<Vec<f32>, NeuralError> {
+        let mut output = vec![0.0; self.config.output_size];
+        self.process_into(input, &mut output)?;
+        Ok(output)
+    }
+    
+    /// Process input through the neural network into `output`
+    fn process_into(&self, input: &[f32], output: &mut [f32]) -> Result<(), NeuralError> {
         if let Some(model) = &self.model {
             // Simple feedforward simulation - would use actual SNN in production
-            let mut output = vec![0.0; self.config.output_size];
-            
-            for i in 0..self.config.output_size {
+            for i in 0..output.len() {
+                let mut sum = 0.0;
                 for j in 0..input.len().min(model.weights.len()) {
-                    output[i] += input[j] * model.weights[j][i];
+                    sum += input[j] * model.weights[j][i];
                 }
                 // Simple activation (would be spike-based in real SNN)
-                output[i] = if output[i] > self.config.spike_threshold {
+                output[i] = if sum > self.config.spike_threshold {
                     1.0
                 } else {
                     0.0
                 };
             }
             
-            Ok(output)
+            Ok(())
         } else {
             Err(NeuralError::NoModelError)
         }
@@ -1,8 +1,9 @@
 // src/neural/snn.rs
 // Implements a simplified spiking neural network for navigation decisions.
 
-// Imports shared types from lib.rs.
-use crate::{SensorData, NavCommand};
+// Imports the scan view and command types shared with navigation.
+use crate::navigation::ScanView;
+use crate::types::MotionCommand;
 use log::info;
 
 /// SNN struct to simulate neuromorphic processing.
@@ -23,8 +24,8 @@ impl Snn {
 
     /// Processes sensor data to produce a navigation command.
     /// - `data`: LIDAR ranges from Subscriber.
-    /// Returns a `NavCommand` based on simple obstacle avoidance logic.
-    pub fn process(&self, data: &SensorData) -> NavCommand {
+    /// Returns a `MotionCommand` based on simple obstacle avoidance logic.
+    pub fn process(&self, data: &ScanView) -> MotionCommand {
         // Simulate SNN: Check for close obstacles
         let min_distance = data
             .ranges
@@ -36,12 +37,12 @@ impl Snn {
 
         // Basic decision: Turn if obstacle near, else move forward
         if min_distance < 0.5 {
-            NavCommand {
+            MotionCommand {
                 linear: 0.0,
                 angular: 0.5,
             } // Turn right
         } else {
-            NavCommand {
+            MotionCommand {
                 linear: 0.2,
                 angular: 0.0,
             } // Move forward
@@ -0,0 +1,70 @@
+/**
+* @file neural_backend.cpp
+* @brief Backend selection for NeuralBridge
+*/
+
+#include "eos_robotics/neural_backend.hpp"
+
+#include <stdexcept>
+
+#if defined(EOS_ENABLE_CUDA)
+#include "eos_robotics/cuda_backend.hpp"
+#endif
+
+namespace eos
+{
+
+BackendType parse_backend_type(const std::string& name)
+{
+    if (name == "cpu") {
+        return BackendType::Cpu;
+    }
+    if (name == "cuda") {
+        return BackendType::Cuda;
+    }
+    throw std::invalid_argument("Unknown neural backend '" + name + "', expected cpu or cuda");
+}
+
+const char* to_string(BackendType type)
+{
+    switch (type) {
+        case BackendType::Cpu: return "cpu";
+        case BackendType::Cuda: return "cuda";
+    }
+    return "unknown";
+}
+
+bool backend_available(BackendType type)
+{
+    switch (type) {
+        case BackendType::Cpu:
+            return true;
+        case BackendType::Cuda:
+#if defined(EOS_ENABLE_CUDA)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+std::unique_ptr<NeuralBackend> make_backend(
+    BackendType type, std::shared_ptr<const LifModel> model, const LifConfig& config)
+{
+    switch (type) {
+        case BackendType::Cpu:
+            return std::make_unique<CpuBackend>(std::move(model), config);
+        case BackendType::Cuda:
+#if defined(EOS_ENABLE_CUDA)
+            return make_cuda_backend(std::move(model), config);
+#else
+            throw std::runtime_error(
+                "neural.backend 'cuda' requested, but this build has no CUDA "
+                "support (configure with -DEOS_ENABLE_CUDA=ON)");
+#endif
+    }
+    throw std::invalid_argument("Unknown neural backend");
+}
+
+}  // namespace eos
@@ -0,0 +1,107 @@
+/**
+* @file neural_bridge.cpp
+* @brief Bridge between ROS sensor messages and the native LIF engine
+*/
+
+#include "eos_robotics/neural_bridge.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace eos
+{
+
+NeuralBridge::NeuralBridge(const std::string& model_path, const LifConfig& config,
+                           const ScanPreprocessorConfig& preprocessing,
+                           BackendType backend)
+    : model_path_(model_path),
+      config_(config),
+      backend_type_(backend),
+      backend_(build_backend(LifModel::open_shared(model_path, config))),
+      input_size_(backend_->input_size()),
+      output_size_(backend_->output_size()),
+      preprocessor_(preprocessing)
+{
+    if (preprocessing.bins != input_size_) {
+        throw std::invalid_argument(
+            "Model has " + std::to_string(input_size_) + " inputs but scan "
+            "preprocessing produces " + std::to_string(preprocessing.bins) + " bins");
+    }
+}
+
+NeuralBridge::~NeuralBridge()
+{
+    delete staged_.exchange(nullptr);
+    delete retired_.exchange(nullptr);
+}
+
+std::unique_ptr<NeuralBackend> NeuralBridge::build_backend(
+    std::shared_ptr<const LifModel> model) const
+{
+    return make_backend(backend_type_, std::move(model), config_);
+}
+
+void NeuralBridge::stage(std::unique_ptr<NeuralBackend> backend)
+{
+    if (backend->input_size() != input_size_ || backend->output_size() != output_size_) {
+        throw std::invalid_argument(
+            "Replacement model is " + std::to_string(backend->input_size()) + " -> " +
+            std::to_string(backend->output_size()) + ", the running one " +
+            std::to_string(input_size_) + " -> " + std::to_string(output_size_));
+    }
+    reclaim_retired();
+    delete staged_.exchange(backend.release(), std::memory_order_acq_rel);
+}
+
+bool NeuralBridge::swap_staged()
+{
+    if (staged_.load(std::memory_order_relaxed) == nullptr) {
+        return false;
+    }
+    // Nothing is freed here: until reclaim_retired() has taken the previous
+    // backend, the staged one waits
+    if (retired_.load(std::memory_order_acquire) != nullptr) {
+        return false;
+    }
+    NeuralBackend* next = staged_.exchange(nullptr, std::memory_order_acq_rel);
+    if (next == nullptr) {
+        return false;
+    }
+    retired_.store(backend_.release(), std::memory_order_release);
+    backend_.reset(next);
+    return true;
+}
+
+void NeuralBridge::reclaim_retired()
+{
+    if (retired_.load(std::memory_order_relaxed) != nullptr) {
+        delete retired_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+}
+
+const float* NeuralBridge::preprocess(const sensor_msgs::msg::LaserScan& laser)
+{
+    preprocessor_.process(laser.ranges.data(), laser.ranges.size(), laser.range_min,
+                          laser.range_max, laser.angle_min, laser.angle_increment);
+    return preprocessor_.output();
+}
+
+void NeuralBridge::process(
+    const sensor_msgs::msg::LaserScan& laser,
+    const sensor_msgs::msg::Imu& imu,
+    const nav_msgs::msg::Odometry& odom,
+    float* output)
+{
+    process_features(preprocess(laser), imu, odom, output);
+}
+
+void NeuralBridge::process_features(
+    const float* features,
+    const sensor_msgs::msg::Imu& /*imu*/,
+    const nav_msgs::msg::Odometry& /*odom*/,
+    float* output)
+{
+    backend_->run(features, output);
+}
+
+}  // namespace eos
@@ -0,0 +1,85 @@
+/**
+* @file node_metrics.cpp
+* @brief Callback latency, sensor age and timer jitter metrics for the node
+*/
+
+#include "eos_robotics/node_metrics.hpp"
+
+#include <iomanip>
+
+namespace eos
+{
+
+const char* to_string(LatencyMetric metric)
+{
+    switch (metric) {
+        case LatencyMetric::LaserCallback: return "laser_callback";
+        case LatencyMetric::ImuCallback: return "imu_callback";
+        case LatencyMetric::OdomCallback: return "odom_callback";
+        case LatencyMetric::GoalCallback: return "goal_callback";
+        case LatencyMetric::InferenceCallback: return "neural_processing_callback";
+        case LatencyMetric::NavigationCallback: return "navigation_control_callback";
+        case LatencyMetric::StatusCallback: return "status_publishing_callback";
+        case LatencyMetric::LaserAgeAtInference: return "laser_age_at_inference";
+        case LatencyMetric::ImuAgeAtInference: return "imu_age_at_inference";
+        case LatencyMetric::OdomAgeAtInference: return "odom_age_at_inference";
+        case LatencyMetric::SenseToCmdVel: return "sense_to_cmd_vel";
+        case LatencyMetric::ServerRoundTrip: return "server_round_trip";
+        case LatencyMetric::InferenceJitter: return "inference_timer_jitter";
+        case LatencyMetric::NavigationJitter: return "navigation_timer_jitter";
+        case LatencyMetric::Count: break;
+    }
+    return "unknown";
+}
+
+const char* to_string(MonitoredLoop loop)
+{
+    switch (loop) {
+        case MonitoredLoop::Inference: return "inference_loop";
+        case MonitoredLoop::Navigation: return "navigation_loop";
+        case MonitoredLoop::Count: break;
+    }
+    return "unknown";
+}
+
+void NodeMetrics::configure_loop(MonitoredLoop loop, std::int64_t period_ns, LatencyMetric jitter)
+{
+    loops_[static_cast<std::size_t>(loop)].configure(period_ns, &histogram(jitter));
+}
+
+void NodeMetrics::write_report(std::ostream& out) const
+{
+    const auto us = [](double ns) { return ns / 1000.0; };
+
+    out << std::left << std::setw(30) << "metric" << std::right
+        << std::setw(10) << "count" << std::setw(12) << "mean_us"
+        << std::setw(12) << "p50_us" << std::setw(12) << "p90_us"
+        << std::setw(12) << "p99_us" << std::setw(12) << "p99.9_us"
+        << std::setw(12) << "max_us" << '\n';
+    out << std::fixed << std::setprecision(1);
+
+    for (std::size_t i = 0; i < histograms_.size(); ++i) {
+        const HistogramSummary summary = histograms_[i].summarize();
+        if (summary.count == 0) {
+            continue;
+        }
+        out << std::left << std::setw(30) << to_string(static_cast<LatencyMetric>(i)) << std::right
+            << std::setw(10) << summary.count << std::setw(12) << us(summary.mean_ns)
+            << std::setw(12) << us(summary.p50_ns) << std::setw(12) << us(summary.p90_ns)
+            << std::setw(12) << us(summary.p99_ns) << std::setw(12) << us(summary.p999_ns)
+            << std::setw(12) << us(summary.max_ns) << '\n';
+    }
+
+    for (std::size_t i = 0; i < loops_.size(); ++i) {
+        const LoopMonitor& monitor = loops_[i];
+        if (monitor.period_ns() <= 0) {
+            continue;
+        }
+        out << std::left << std::setw(30) << to_string(static_cast<MonitoredLoop>(i)) << std::right
+            << " period_us=" << us(monitor.period_ns())
+            << " overruns=" << monitor.overruns()
+            << " missed_periods=" << monitor.missed_periods() << '\n';
+    }
+}
+
+}  // namespace eos
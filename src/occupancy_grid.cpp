@@ -0,0 +1,197 @@
+/**
+* @file occupancy_grid.cpp
+* @brief Rolling log-odds occupancy grid with Bresenham ray casting
+*/
+
+#include "eos_robotics/occupancy_grid.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace eos
+{
+
+namespace
+{
+
+/// Quantise a log-odds value to the int8 storage steps
+int quantise(float log_odds)
+{
+    return static_cast<int>(std::lround(log_odds / OccupancyGrid::kLogOddsStep));
+}
+
+}  // namespace
+
+OccupancyGrid::OccupancyGrid(const OccupancyGridConfig& config)
+    : config_(config)
+{
+    const std::size_t cells = config_.cells;
+    if (cells < kTileSide || (cells & (cells - 1)) != 0) {
+        throw std::invalid_argument(
+            "Occupancy grid size must be a power of two of at least 16 cells");
+    }
+    if (config_.resolution <= 0.0f || config_.max_range <= 0.0f) {
+        throw std::invalid_argument("Occupancy grid resolution and range must be positive");
+    }
+
+    hit_ = quantise(config_.hit_log_odds);
+    miss_ = quantise(config_.miss_log_odds);
+    min_ = quantise(config_.min_log_odds);
+    max_ = quantise(config_.max_log_odds);
+    occupied_threshold_ = quantise(config_.occupied_log_odds);
+    if (hit_ <= 0 || miss_ >= 0 || min_ >= 0 || max_ <= 0 ||
+        min_ < std::numeric_limits<std::int8_t>::min() ||
+        max_ > std::numeric_limits<std::int8_t>::max() ||
+        occupied_threshold_ < min_ || occupied_threshold_ >= max_) {
+        throw std::invalid_argument(
+            "Occupancy grid needs a positive hit, a negative miss and bounds within +/-7.9 "
+            "around the occupied threshold");
+    }
+
+    mask_ = cells - 1;
+    tiles_per_side_ = cells >> kTileShift;
+    cells_ = AlignedBuffer<std::int8_t>(cells * cells);
+}
+
+void OccupancyGrid::recenter(float x, float y)
+{
+    const long half = static_cast<long>(config_.cells / 2);
+    const long size = static_cast<long>(config_.cells);
+    const long origin_x = cell_of(x) - half;
+    const long origin_y = cell_of(y) - half;
+    const long dx = origin_x - origin_x_;
+    const long dy = origin_y - origin_y_;
+    if (dx == 0 && dy == 0) {
+        return;
+    }
+
+    if (std::labs(dx) >= size || std::labs(dy) >= size) {
+        cells_.zero();
+    } else {
+        // The cells that enter reuse the storage of the cells that left
+        if (dx > 0) {
+            clear_columns(origin_x_ + size, origin_x + size - 1);
+        } else if (dx < 0) {
+            clear_columns(origin_x, origin_x_ - 1);
+        }
+        if (dy > 0) {
+            clear_rows(origin_y_ + size, origin_y + size - 1);
+        } else if (dy < 0) {
+            clear_rows(origin_y, origin_y_ - 1);
+        }
+    }
+    origin_x_ = origin_x;
+    origin_y_ = origin_y;
+}
+
+void OccupancyGrid::clear_columns(long first, long last)
+{
+    const long size = static_cast<long>(config_.cells);
+    for (long cx = first; cx <= last; ++cx) {
+        for (long cy = 0; cy < size; ++cy) {
+            cells_[index(cx, cy)] = 0;
+        }
+    }
+}
+
+void OccupancyGrid::clear_rows(long first, long last)
+{
+    // A row is one contiguous run of kTileSide cells per tile
+    for (long cy = first; cy <= last; ++cy) {
+        for (std::size_t tile = 0; tile < tiles_per_side_; ++tile) {
+            const long cx = static_cast<long>(tile << kTileShift);
+            std::memset(cells_.data() + index(cx, cy), 0, kTileSide);
+        }
+    }
+}
+
+void OccupancyGrid::update_cell(long cx, long cy, int delta)
+{
+    std::int8_t& cell = cells_[index(cx, cy)];
+    const bool was_occupied = cell > occupied_threshold_;
+    cell = static_cast<std::int8_t>(std::clamp(cell + delta, min_, max_));
+    if ((cell > occupied_threshold_) != was_occupied) {
+        dirty_.include(cx, cy);
+    }
+}
+
+void OccupancyGrid::trace_ray(long x0, long y0, long x1, long y1, bool hit)
+{
+    const long dx = std::labs(x1 - x0);
+    const long dy = -std::labs(y1 - y0);
+    const long sx = x0 < x1 ? 1 : -1;
+    const long sy = y0 < y1 ? 1 : -1;
+    long error = dx + dy;
+    long x = x0;
+    long y = y0;
+    while (x != x1 || y != y1) {
+        if (!contains_cell(x, y)) {
+            return;
+        }
+        update_cell(x, y, miss_);
+        const long doubled = 2 * error;
+        if (doubled >= dy) {
+            error += dy;
+            x += sx;
+        }
+        if (doubled <= dx) {
+            error += dx;
+            y += sy;
+        }
+    }
+    if (contains_cell(x, y)) {
+        update_cell(x, y, hit ? hit_ : miss_);
+    }
+}
+
+void OccupancyGrid::update_beam_table(std::size_t count, float angle_min, float angle_increment)
+{
+    if (count == table_count_ && angle_min == table_angle_min_ &&
+        angle_increment == table_angle_increment_) {
+        return;
+    }
+    beam_cos_.resize(count);
+    beam_sin_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float angle = angle_min + static_cast<float>(i) * angle_increment;
+        beam_cos_[i] = std::cos(angle);
+        beam_sin_[i] = std::sin(angle);
+    }
+    table_count_ = count;
+    table_angle_min_ = angle_min;
+    table_angle_increment_ = angle_increment;
+}
+
+void OccupancyGrid::integrate_scan(const Pose2D& pose, const float* ranges, std::size_t count,
+                                   float range_min, float range_max, float angle_min,
+                                   float angle_increment)
+{
+    update_beam_table(count, angle_min, angle_increment);
+
+    const float c = std::cos(pose.theta);
+    const float s = std::sin(pose.theta);
+    const float free_range = std::min(range_max, config_.max_range);
+    const long x0 = cell_of(pose.x);
+    const long y0 = cell_of(pose.y);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float range = ranges[i];
+        // Ordered compare rejects NaN
+        if (!(range >= range_min)) {
+            continue;
+        }
+        // Drivers report "no return" as range_max (or inf), which is no wall
+        const bool hit = range < range_max && range <= config_.max_range;
+        const float length = std::min(range, free_range);
+
+        // Sensor-frame direction rotated into the odom frame
+        const float dir_x = c * beam_cos_[i] - s * beam_sin_[i];
+        const float dir_y = s * beam_cos_[i] + c * beam_sin_[i];
+        trace_ray(x0, y0, cell_of(pose.x + length * dir_x), cell_of(pose.y + length * dir_y), hit);
+    }
+    ++scans_;
+}
+
+}  // namespace eos
@@ -0,0 +1,98 @@
+/**
+* @file qos_config.cpp
+* @brief Per-topic QoS profiles loaded from parameters
+*/
+
+#include "eos_robotics/qos_config.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace eos
+{
+
+QosSettings sensor_qos_defaults()
+{
+    QosSettings settings;
+    settings.depth = 1;
+    settings.reliability = "best_effort";
+    settings.durability = "volatile";
+    return settings;
+}
+
+rclcpp::QoS make_qos(const QosSettings& settings)
+{
+    rclcpp::QoS qos(rclcpp::KeepLast(settings.depth > 0 ? settings.depth : 1));
+
+    if (settings.reliability == "reliable") {
+        qos.reliable();
+    } else if (settings.reliability == "best_effort") {
+        qos.best_effort();
+    } else {
+        throw std::invalid_argument("Unknown QoS reliability '" + settings.reliability +
+                                    "', expected reliable or best_effort");
+    }
+
+    if (settings.durability == "volatile") {
+        qos.durability_volatile();
+    } else if (settings.durability == "transient_local") {
+        qos.transient_local();
+    } else {
+        throw std::invalid_argument("Unknown QoS durability '" + settings.durability +
+                                    "', expected volatile or transient_local");
+    }
+
+    return qos;
+}
+
+namespace
+{
+
+rclcpp::ParameterValue declare_once(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters,
+    const std::string& name,
+    const rclcpp::ParameterValue& default_value)
+{
+    if (parameters->has_parameter(name)) {
+        return parameters->get_parameter(name).get_parameter_value();
+    }
+    return parameters->declare_parameter(name, default_value);
+}
+
+}  // namespace
+
+rclcpp::QoS declare_topic_qos(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr& parameters,
+    const std::string& key,
+    const QosSettings& defaults)
+{
+    const std::string prefix = "ros.qos." + key + ".";
+
+    QosSettings settings;
+    const int64_t depth = declare_once(
+        parameters, prefix + "depth",
+        rclcpp::ParameterValue(static_cast<int64_t>(defaults.depth))).get<int64_t>();
+    if (depth < 1) {
+        throw std::invalid_argument(prefix + "depth must be at least 1, got " +
+                                    std::to_string(depth));
+    }
+    settings.depth = static_cast<std::size_t>(depth);
+    settings.reliability = declare_once(
+        parameters, prefix + "reliability",
+        rclcpp::ParameterValue(defaults.reliability)).get<std::string>();
+    settings.durability = declare_once(
+        parameters, prefix + "durability",
+        rclcpp::ParameterValue(defaults.durability)).get<std::string>();
+
+    return make_qos(settings);
+}
+
+rclcpp::IntraProcessSetting intra_process_setting(const rclcpp::QoS& qos)
+{
+    if (qos.durability() == rclcpp::DurabilityPolicy::TransientLocal) {
+        return rclcpp::IntraProcessSetting::Disable;
+    }
+    return rclcpp::IntraProcessSetting::NodeDefault;
+}
+
+}  // namespace eos
@@ -14,6 +14,7 @@ use std::time::Duration;
 
 pub use publisher::*;
 pub use subscriber::*;
+pub use crate::types::{MotionCommand, Pose2D};
 
 /// ROS 2 interface manager
 pub struct RosInterface {
@@ -236,26 +237,6 @@ pub struct SensorData {
     pub odom_data: r2r::nav_msgs::msg::Odometry,
 }
 
-/// Simple 2D pose representation
-#[derive(Debug, Clone, Copy)]
-pub struct Pose2D {
-    /// X position
-    pub x: f32,
-    /// Y position
-    pub y: f32,
-    /// Orientation (theta)
-    pub theta: f32,
-}
-
-/// Motion command for the robot
-#[derive(Debug, Clone, Copy)]
-pub struct MotionCommand {
-    /// Linear velocity (m/s)
-    pub linear: f32,
-    /// Angular velocity (rad/s)
-    pub angular: f32,
-}
-
 impl MotionCommand {
     /// Convert to ROS Twist message
     pub fn to_ros_message(&self) -> r2r::geometry_msgs::msg::Twist {
@@ -0,0 +1,81 @@
+/**
+* @file rust_core.cpp
+* @brief RAII wrappers around the C ABI of the in-process Rust core
+*/
+
+#include "eos_robotics/rust_core.hpp"
+
+#include <stdexcept>
+
+namespace eos
+{
+
+void check_core_status(EosStatus status, const char* call)
+{
+    if (status == EOS_STATUS_OK) {
+        return;
+    }
+    const std::string message = std::string(call) + ": " + eos_last_error_message();
+    if (status == EOS_STATUS_INVALID_ARGUMENT) {
+        throw std::invalid_argument(message);
+    }
+    throw std::runtime_error(message);
+}
+
+RustNavigator::RustNavigator(const EosNavigationParams& params)
+    : handle_(eos_navigator_new(&params))
+{
+    if (!handle_) {
+        throw std::runtime_error(std::string("eos_navigator_new: ") + eos_last_error_message());
+    }
+}
+
+void RustNavigator::set_goal(const EosPose2D& goal)
+{
+    check_core_status(eos_navigator_set_goal(handle_.get(), goal), "eos_navigator_set_goal");
+}
+
+void RustNavigator::clear_goal()
+{
+    check_core_status(eos_navigator_clear_goal(handle_.get()), "eos_navigator_clear_goal");
+}
+
+EosMotionCommand RustNavigator::step(const EosScan& scan, const float* neural,
+                                     std::size_t neural_count, const EosPose2D* pose)
+{
+    EosMotionCommand command{0.0f, 0.0f};
+    check_core_status(eos_navigator_step(handle_.get(), &scan, neural, neural_count, pose, &command),
+                      "eos_navigator_step");
+    return command;
+}
+
+EosMotionCommand RustNavigator::emergency_stop()
+{
+    EosMotionCommand command{0.0f, 0.0f};
+    check_core_status(eos_navigator_emergency_stop(handle_.get(), &command),
+                      "eos_navigator_emergency_stop");
+    return command;
+}
+
+RustSnn::RustSnn(const EosNeuralParams& params)
+    : handle_(eos_snn_new(&params)),
+      input_size_(params.input_size),
+      output_size_(params.output_size)
+{
+    if (!handle_) {
+        throw std::runtime_error(std::string("eos_snn_new: ") + eos_last_error_message());
+    }
+}
+
+void RustSnn::load_model(const std::string& path)
+{
+    check_core_status(eos_snn_load_model(handle_.get(), path.c_str()), "eos_snn_load_model");
+}
+
+void RustSnn::process(const float* input, float* output) const
+{
+    check_core_status(eos_snn_process(handle_.get(), input, input_size_, output, output_size_),
+                      "eos_snn_process");
+}
+
+}  // namespace eos
@@ -0,0 +1,147 @@
+/**
+* @file scan_preprocessor.cpp
+* @brief LaserScan -> network input: sanitise, bin and normalise the ranges
+*/
+
+#include "eos_robotics/scan_preprocessor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "eos_robotics/kernels.hpp"
+
+namespace eos
+{
+
+BinningStrategy parse_binning_strategy(const std::string& name)
+{
+    if (name == "min") {
+        return BinningStrategy::Min;
+    }
+    if (name == "mean") {
+        return BinningStrategy::Mean;
+    }
+    if (name == "sector") {
+        return BinningStrategy::Sector;
+    }
+    throw std::invalid_argument("Unknown binning strategy '" + name +
+                                "', expected min, mean or sector");
+}
+
+ScanPreprocessor::ScanPreprocessor(const ScanPreprocessorConfig& config)
+    : config_(config),
+      output_(config.bins)
+{
+    if (config_.bins == 0) {
+        throw std::invalid_argument("Scan preprocessing needs at least one bin");
+    }
+    bin_segments_.assign(config_.bins + 1, 0);
+}
+
+void ScanPreprocessor::update_bin_table(std::size_t count, float angle_min,
+                                        float angle_increment)
+{
+    table_count_ = count;
+    table_angle_min_ = angle_min;
+    table_angle_increment_ = angle_increment;
+    segments_.clear();
+
+    const std::size_t bins = config_.bins;
+    std::vector<std::vector<Segment>> per_bin(bins);
+
+    if (config_.strategy != BinningStrategy::Sector || angle_increment <= 0.0f) {
+        // Equal beam counts per bin
+        for (std::size_t b = 0; b < bins; ++b) {
+            const std::size_t begin = b * count / bins;
+            const std::size_t end = std::min(count, std::max(begin + 1, (b + 1) * count / bins));
+            if (begin < end) {
+                per_bin[b].push_back({static_cast<std::uint32_t>(begin),
+                                      static_cast<std::uint32_t>(end)});
+            }
+        }
+    } else {
+        // Fixed sectors of the field of view centred on the heading (+x)
+        const float pi = 3.14159265358979f;
+        const float half_fov = 0.5f * config_.sector_fov;
+        const float width = config_.sector_fov / static_cast<float>(bins);
+        long current_bin = -1;
+        std::uint32_t run_begin = 0;
+
+        for (std::size_t i = 0; i <= count; ++i) {
+            long bin = -1;
+            if (i < count) {
+                const float angle = angle_min + static_cast<float>(i) * angle_increment;
+                const float wrapped = std::remainder(angle, 2.0f * pi);
+                const float offset = wrapped + half_fov;
+                if (offset >= 0.0f && offset < config_.sector_fov) {
+                    bin = std::min(static_cast<long>(bins) - 1, static_cast<long>(offset / width));
+                }
+            }
+            if (bin != current_bin) {
+                if (current_bin >= 0) {
+                    per_bin[current_bin].push_back({run_begin, static_cast<std::uint32_t>(i)});
+                }
+                current_bin = bin;
+                run_begin = static_cast<std::uint32_t>(i);
+            }
+        }
+    }
+
+    for (std::size_t b = 0; b < bins; ++b) {
+        bin_segments_[b] = static_cast<std::uint32_t>(segments_.size());
+        segments_.insert(segments_.end(), per_bin[b].begin(), per_bin[b].end());
+    }
+    bin_segments_[bins] = static_cast<std::uint32_t>(segments_.size());
+}
+
+void ScanPreprocessor::process(const float* ranges, std::size_t count, float range_min,
+                               float range_max, float angle_min, float angle_increment)
+{
+    if (count == 0 || !(range_max > 0.0f)) {
+        std::fill(output_.begin(), output_.end(), 1.0f);
+        return;
+    }
+
+    if (count != table_count_ || angle_min != table_angle_min_ ||
+        angle_increment != table_angle_increment_)
+    {
+        update_bin_table(count, angle_min, angle_increment);
+    }
+    if (sanitized_.size() < count) {
+        sanitized_ = AlignedBuffer<float>(count);
+    }
+
+    kernels::sanitize_ranges(ranges, count, range_min, range_max, sanitized_.data());
+
+    const float inv_range_max = 1.0f / range_max;
+    const bool mean = config_.strategy == BinningStrategy::Mean;
+    for (std::size_t b = 0; b < config_.bins; ++b) {
+        const std::uint32_t first = bin_segments_[b];
+        const std::uint32_t last = bin_segments_[b + 1];
+        if (first == last) {
+            output_[b] = 1.0f;  // no beam falls in this bin: free space
+            continue;
+        }
+
+        float value = mean ? 0.0f : range_max;
+        std::size_t beams = 0;
+        for (std::uint32_t s = first; s < last; ++s) {
+            const Segment& segment = segments_[s];
+            const float* begin = sanitized_.data() + segment.begin;
+            const std::size_t length = segment.end - segment.begin;
+            if (mean) {
+                value += kernels::reduce_sum(begin, length);
+                beams += length;
+            } else {
+                value = std::min(value, kernels::reduce_min(begin, length));
+            }
+        }
+        if (mean) {
+            value /= static_cast<float>(beams);
+        }
+        output_[b] = value * inv_range_max;
+    }
+}
+
+}  // namespace eos
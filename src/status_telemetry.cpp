@@ -0,0 +1,130 @@
+/**
+* @file status_telemetry.cpp
+* @brief Delta encoding of per-stage latencies and process CPU/memory sampling for /eos/status
+*/
+
+#include "eos_robotics/status_telemetry.hpp"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+
+namespace eos
+{
+
+namespace
+{
+
+std::uint32_t to_us(std::int64_t ns)
+{
+    const std::int64_t us = std::max<std::int64_t>(ns, 0) / 1000;
+    return static_cast<std::uint32_t>(
+        std::min<std::int64_t>(us, std::numeric_limits<std::uint32_t>::max()));
+}
+
+std::uint32_t distance(std::uint32_t a, std::uint32_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+std::int64_t timeval_us(const timeval& tv)
+{
+    return static_cast<std::int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+}  // namespace
+
+StageLatencySample StageLatencySample::from_summary(std::uint8_t stage,
+                                                    const HistogramSummary& summary)
+{
+    StageLatencySample sample;
+    sample.stage = stage;
+    sample.p50_us = to_us(summary.p50_ns);
+    sample.p99_us = to_us(summary.p99_ns);
+    sample.max_us = to_us(summary.max_ns);
+    return sample;
+}
+
+StatusDeltaEncoder::StatusDeltaEncoder(const StatusEncoderConfig& config)
+    : config_(config)
+{
+    if (config_.keyframe_interval == 0) {
+        throw std::invalid_argument("status.keyframe_interval must be at least 1");
+    }
+}
+
+bool StatusDeltaEncoder::changed(const StageLatencySample& sample) const
+{
+    if (sample.stage >= sent_.size() || !has_sent_[sample.stage]) {
+        return true;
+    }
+    const StageLatencySample& last = sent_[sample.stage];
+    return distance(sample.p50_us, last.p50_us) > config_.deadband_us ||
+           distance(sample.p99_us, last.p99_us) > config_.deadband_us ||
+           distance(sample.max_us, last.max_us) > config_.deadband_us;
+}
+
+bool StatusDeltaEncoder::encode(const StageLatencySample* current, std::size_t count,
+                                std::vector<StageLatencySample>& out)
+{
+    const bool keyframe =
+        !config_.delta || force_keyframe_ || since_keyframe_ >= config_.keyframe_interval;
+
+    out.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        const StageLatencySample& sample = current[i];
+        if (!keyframe && !changed(sample)) {
+            continue;
+        }
+        out.push_back(sample);
+        if (sample.stage >= sent_.size()) {
+            sent_.resize(sample.stage + 1u);
+            has_sent_.resize(sample.stage + 1u, false);
+        }
+        sent_[sample.stage] = sample;
+        has_sent_[sample.stage] = true;
+    }
+
+    since_keyframe_ = keyframe ? 1 : since_keyframe_ + 1;
+    force_keyframe_ = false;
+    ++sequence_;
+    return keyframe;
+}
+
+ProcessUsageSample ProcessUsage::sample()
+{
+    ProcessUsageSample usage;
+
+    rusage ru{};
+    if (getrusage(RUSAGE_SELF, &ru) == 0) {
+        const std::int64_t cpu_us = timeval_us(ru.ru_utime) + timeval_us(ru.ru_stime);
+        const std::int64_t wall_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (started_ && wall_us > last_wall_us_) {
+            usage.cpu_percent = 100.0 * static_cast<double>(cpu_us - last_cpu_us_) /
+                                static_cast<double>(wall_us - last_wall_us_);
+        }
+        started_ = true;
+        last_cpu_us_ = cpu_us;
+        last_wall_us_ = wall_us;
+    }
+
+    // Second field of statm is the resident set in pages
+    if (std::FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        unsigned long long size = 0;
+        unsigned long long resident = 0;
+        if (std::fscanf(statm, "%llu %llu", &size, &resident) == 2) {
+            const long page = sysconf(_SC_PAGESIZE);
+            usage.rss_kib = resident * static_cast<unsigned long long>(page > 0 ? page : 4096) / 1024;
+        }
+        std::fclose(statm);
+    }
+    return usage;
+}
+
+}  // namespace eos
@@ -0,0 +1,408 @@
+/**
+* @file topological_memory.cpp
+* @brief Topological map and trajectory memory with a spatial-hash index and an append-only journal
+*/
+
+#include "eos_robotics/topological_memory.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+
+namespace eos
+{
+
+namespace
+{
+
+constexpr float kTwoPi = 6.28318530717959f;
+
+std::uint64_t pack_cell(std::int32_t cx, std::int32_t cy)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cx)) << 32) |
+           static_cast<std::uint32_t>(cy);
+}
+
+float distance_squared(const Pose2D& a, float x, float y)
+{
+    const float dx = a.x - x;
+    const float dy = a.y - y;
+    return dx * dx + dy * dy;
+}
+
+// Visit every indexed node in the square of cells within @p reach of (cx, cy)
+template <typename Grid, typename F>
+void for_each_in_cells(const Grid& grid, std::int32_t cx, std::int32_t cy, std::int32_t reach,
+                       F&& visit)
+{
+    for (std::int32_t dx = -reach; dx <= reach; ++dx) {
+        for (std::int32_t dy = -reach; dy <= reach; ++dy) {
+            const auto cell = grid.find(pack_cell(cx + dx, cy + dy));
+            if (cell == grid.end()) {
+                continue;
+            }
+            for (const std::uint32_t index : cell->second) {
+                visit(index);
+            }
+        }
+    }
+}
+
+// Journal layout: a 16-byte header, then fixed-size records
+constexpr char kJournalMagic[8] = {'E', 'O', 'S', 'M', 'E', 'M', 'J', '1'};
+constexpr std::uint32_t kJournalVersion = 1;
+
+enum class RecordType : std::uint32_t
+{
+    Node = 1,
+    Closure = 2,
+};
+
+struct JournalHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t record_size;
+};
+
+struct JournalRecord
+{
+    std::uint32_t type = 0;
+    std::uint32_t checksum = 0;  ///< FNV-1a of the record with this field zeroed
+    std::uint64_t id = 0;        ///< node id, or the closure's from
+    std::uint64_t target = 0;    ///< the closure's to
+    std::int64_t stamp_ns = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+    float theta = 0.0f;
+    float reserved = 0.0f;
+};
+
+static_assert(sizeof(JournalHeader) == 16, "journal header layout changed");
+static_assert(sizeof(JournalRecord) == 48, "journal record layout changed");
+
+std::uint32_t checksum_of(JournalRecord record)
+{
+    record.checksum = 0;
+    unsigned char bytes[sizeof(JournalRecord)];
+    std::memcpy(bytes, &record, sizeof(bytes));
+    std::uint32_t hash = 2166136261u;
+    for (const unsigned char byte : bytes) {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+
+void write_record(std::FILE* file, JournalRecord record)
+{
+    record.checksum = checksum_of(record);
+    if (std::fwrite(&record, sizeof(record), 1, file) != 1) {
+        throw std::runtime_error("Failed to append to the memory journal");
+    }
+}
+
+}  // namespace
+
+TopologicalMemory::TopologicalMemory(const TopologicalMemoryConfig& config)
+    : config_(config)
+{
+    if (!(config_.node_spacing > 0.0f) || !(config_.loop_closure_radius > 0.0f)) {
+        throw std::invalid_argument("Memory node spacing and loop closure radius must be positive");
+    }
+    if (!(config_.loop_closure_heading >= 0.0f)) {
+        throw std::invalid_argument("Memory loop closure heading tolerance must not be negative");
+    }
+    if (config_.trajectory_length == 0) {
+        throw std::invalid_argument("Memory trajectory length must be positive");
+    }
+    inverse_cell_size_ = 1.0f / config_.loop_closure_radius;
+    trajectory_.resize(config_.trajectory_length);
+}
+
+std::uint64_t TopologicalMemory::cell_key(float x, float y) const
+{
+    return pack_cell(static_cast<std::int32_t>(std::floor(x * inverse_cell_size_)),
+                     static_cast<std::int32_t>(std::floor(y * inverse_cell_size_)));
+}
+
+void TopologicalMemory::index_node(std::size_t index)
+{
+    const Pose2D& pose = nodes_[index].pose;
+    grid_[cell_key(pose.x, pose.y)].push_back(static_cast<std::uint32_t>(index));
+}
+
+MemoryUpdate TopologicalMemory::observe(const Pose2D& pose, std::int64_t stamp_ns)
+{
+    trajectory_[trajectory_head_] = TrajectoryPoint{pose, stamp_ns};
+    trajectory_head_ = (trajectory_head_ + 1) % trajectory_.size();
+    trajectory_size_ = std::min(trajectory_size_ + 1, trajectory_.size());
+
+    MemoryUpdate update;
+    if (current_ >= 0) {
+        const MapNode& at = nodes_[static_cast<std::size_t>(current_)];
+        update.node_id = at.id;
+        if (distance_squared(at.pose, pose.x, pose.y) <
+            config_.node_spacing * config_.node_spacing) {
+            return update;
+        }
+    }
+
+    // One node step further along the path
+    ++step_;
+    const std::int64_t match = find_loop_closure(pose);
+    if (match >= 0) {
+        MapNode& node = nodes_[static_cast<std::size_t>(match)];
+        ++node.visits;
+        // The first node of a run re-enters the map; it closes no loop
+        if (current_ >= 0) {
+            closures_.push_back(
+                LoopClosure{nodes_[static_cast<std::size_t>(current_)].id, node.id, stamp_ns});
+        }
+        visited_step_[static_cast<std::size_t>(match)] = step_;
+        current_ = match;
+        update.loop_closed = true;
+        update.node_id = node.id;
+        return update;
+    }
+    if (full()) {
+        return update;
+    }
+
+    MapNode node;
+    node.id = nodes_.size();
+    node.pose = pose;
+    node.stamp_ns = stamp_ns;
+    nodes_.push_back(node);
+    visited_step_.push_back(step_);
+    index_node(nodes_.size() - 1);
+    current_ = static_cast<std::int64_t>(nodes_.size() - 1);
+    update.node_added = true;
+    update.node_id = node.id;
+    return update;
+}
+
+std::int64_t TopologicalMemory::find_loop_closure(const Pose2D& pose) const
+{
+    const float radius_squared = config_.loop_closure_radius * config_.loop_closure_radius;
+    std::int64_t best = -1;
+    float best_distance = std::numeric_limits<float>::infinity();
+    // Cells are one radius wide, so the closest node is in the 3x3 block
+    for_each_in_cells(
+        grid_, static_cast<std::int32_t>(std::floor(pose.x * inverse_cell_size_)),
+        static_cast<std::int32_t>(std::floor(pose.y * inverse_cell_size_)), 1,
+        [&](std::uint32_t index) {
+            // Zero: not visited yet in this run, e.g. restored from a journal
+            const std::uint64_t visited = visited_step_[index];
+            if (visited != 0 && visited + config_.loop_closure_min_separation > step_) {
+                return;
+            }
+            const MapNode& node = nodes_[index];
+            const float d = distance_squared(node.pose, pose.x, pose.y);
+            if (d >= radius_squared || d >= best_distance) {
+                return;
+            }
+            if (std::abs(std::remainder(pose.theta - node.pose.theta, kTwoPi)) >
+                config_.loop_closure_heading) {
+                return;
+            }
+            best = index;
+            best_distance = d;
+        });
+    return best;
+}
+
+void TopologicalMemory::query_radius(float x, float y, float radius,
+                                     std::vector<std::size_t>& out) const
+{
+    if (!(radius >= 0.0f)) {
+        return;
+    }
+    const auto reach = static_cast<std::int32_t>(std::ceil(radius * inverse_cell_size_));
+    const float radius_squared = radius * radius;
+    for_each_in_cells(grid_, static_cast<std::int32_t>(std::floor(x * inverse_cell_size_)),
+                      static_cast<std::int32_t>(std::floor(y * inverse_cell_size_)), reach,
+                      [&](std::uint32_t index) {
+                          if (distance_squared(nodes_[index].pose, x, y) <= radius_squared) {
+                              out.push_back(index);
+                          }
+                      });
+}
+
+void TopologicalMemory::trajectory(std::vector<TrajectoryPoint>& out) const
+{
+    const std::size_t start =
+        (trajectory_head_ + trajectory_.size() - trajectory_size_) % trajectory_.size();
+    for (std::size_t i = 0; i < trajectory_size_; ++i) {
+        out.push_back(trajectory_[(start + i) % trajectory_.size()]);
+    }
+}
+
+void TopologicalMemory::restore_node(const MapNode& node)
+{
+    if (node.id != nodes_.size()) {
+        throw std::invalid_argument("Memory nodes must be restored in id order");
+    }
+    MapNode restored = node;
+    restored.visits = 1;
+    nodes_.push_back(restored);
+    visited_step_.push_back(0);
+    index_node(nodes_.size() - 1);
+}
+
+void TopologicalMemory::restore_closure(const LoopClosure& closure)
+{
+    if (closure.from >= nodes_.size() || closure.to >= nodes_.size()) {
+        throw std::invalid_argument("Memory loop closure refers to an unknown node");
+    }
+    ++nodes_[closure.to].visits;
+    closures_.push_back(closure);
+}
+
+MemoryJournal::MemoryJournal(const std::string& path, TopologicalMemory& memory)
+    : path_(path)
+{
+    std::error_code error;
+    const bool exists = std::filesystem::exists(path, error);
+    std::uintmax_t valid_bytes = 0;
+    if (exists) {
+        std::FILE* in = std::fopen(path.c_str(), "rb");
+        if (!in) {
+            throw std::runtime_error("Failed to open memory journal " + path);
+        }
+        JournalHeader header{};
+        const std::size_t header_read = std::fread(&header, sizeof(header), 1, in);
+        if (header_read == 1) {
+            if (std::memcmp(header.magic, kJournalMagic, sizeof(kJournalMagic)) != 0 ||
+                header.version != kJournalVersion || header.record_size != sizeof(JournalRecord)) {
+                std::fclose(in);
+                throw std::runtime_error(path + " is not a version " +
+                                         std::to_string(kJournalVersion) + " memory journal");
+            }
+            valid_bytes = sizeof(header);
+            JournalRecord record;
+            try {
+                while (std::fread(&record, sizeof(record), 1, in) == 1 &&
+                       record.checksum == checksum_of(record)) {
+                    if (record.type == static_cast<std::uint32_t>(RecordType::Node)) {
+                        MapNode node;
+                        node.id = record.id;
+                        node.pose = Pose2D{record.x, record.y, record.theta};
+                        node.stamp_ns = record.stamp_ns;
+                        memory.restore_node(node);
+                    } else if (record.type == static_cast<std::uint32_t>(RecordType::Closure)) {
+                        memory.restore_closure(LoopClosure{record.id, record.target, record.stamp_ns});
+                    } else {
+                        break;
+                    }
+                    valid_bytes += sizeof(record);
+                    ++restored_;
+                }
+            }
+            catch (const std::invalid_argument& e) {
+                std::fclose(in);
+                throw std::runtime_error("Corrupt memory journal " + path + ": " + e.what());
+            }
+        }
+        std::fclose(in);
+        // Cut a torn tail so the records appended next stay aligned
+        if (valid_bytes > 0 && std::filesystem::file_size(path, error) != valid_bytes) {
+            std::filesystem::resize_file(path, valid_bytes, error);
+            if (error) {
+                throw std::runtime_error("Failed to truncate memory journal " + path + ": " +
+                                         error.message());
+            }
+        }
+    }
+
+    file_ = std::fopen(path.c_str(), valid_bytes > 0 ? "ab" : "wb");
+    if (!file_) {
+        throw std::runtime_error("Failed to open memory journal " + path + " for writing");
+    }
+    if (valid_bytes == 0) {
+        JournalHeader header{};
+        std::memcpy(header.magic, kJournalMagic, sizeof(kJournalMagic));
+        header.version = kJournalVersion;
+        header.record_size = sizeof(JournalRecord);
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1 || std::fflush(file_) != 0) {
+            std::fclose(file_);
+            throw std::runtime_error("Failed to write memory journal " + path);
+        }
+    }
+    written_nodes_ = memory.nodes().size();
+    written_closures_ = memory.loop_closures().size();
+}
+
+MemoryJournal::~MemoryJournal()
+{
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+std::size_t MemoryJournal::append(const TopologicalMemory& memory)
+{
+    if (failed_) {
+        throw std::runtime_error("Memory journal " + path_ + " failed an earlier append");
+    }
+    const auto& nodes = memory.nodes();
+    const auto& closures = memory.loop_closures();
+    if (written_nodes_ == nodes.size() && written_closures_ == closures.size()) {
+        return 0;
+    }
+    // The end of the last complete batch; a failed batch is cut back to it
+    // so retrying it does not leave its first records in the file twice
+    const off_t offset = ::lseek(::fileno(file_), 0, SEEK_END);
+    if (offset < 0) {
+        throw std::runtime_error("Failed to seek memory journal " + path_);
+    }
+
+    // Nodes first: a closure only refers to nodes laid before it
+    std::size_t node = written_nodes_;
+    std::size_t closure = written_closures_;
+    try {
+        for (; node < nodes.size(); ++node) {
+            JournalRecord record;
+            record.type = static_cast<std::uint32_t>(RecordType::Node);
+            record.id = nodes[node].id;
+            record.stamp_ns = nodes[node].stamp_ns;
+            record.x = nodes[node].pose.x;
+            record.y = nodes[node].pose.y;
+            record.theta = nodes[node].pose.theta;
+            write_record(file_, record);
+        }
+        for (; closure < closures.size(); ++closure) {
+            JournalRecord record;
+            record.type = static_cast<std::uint32_t>(RecordType::Closure);
+            record.id = closures[closure].from;
+            record.target = closures[closure].to;
+            record.stamp_ns = closures[closure].stamp_ns;
+            write_record(file_, record);
+        }
+        if (std::fflush(file_) != 0) {
+            throw std::runtime_error("Failed to flush memory journal " + path_);
+        }
+    }
+    catch (const std::runtime_error&) {
+        // Closing drops whatever the stream still buffers, so none of the
+        // batch can reach the file after the cut
+        std::fclose(file_);
+        std::error_code error;
+        std::filesystem::resize_file(path_, static_cast<std::uintmax_t>(offset), error);
+        file_ = error ? nullptr : std::fopen(path_.c_str(), "ab");
+        failed_ = file_ == nullptr;
+        throw;
+    }
+    const std::size_t written = (node - written_nodes_) + (closure - written_closures_);
+    written_nodes_ = node;
+    written_closures_ = closure;
+    return written;
+}
+
+}  // namespace eos
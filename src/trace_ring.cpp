@@ -0,0 +1,256 @@
+/**
+* @file trace_ring.cpp
+* @brief Per-thread lock-free trace rings, dumped as Chrome/Perfetto trace JSON
+*/
+
+#include "eos_robotics/trace_ring.hpp"
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+
+namespace eos
+{
+namespace trace
+{
+
+namespace
+{
+
+std::atomic<bool> g_enabled{true};
+std::atomic<std::size_t> g_buffer_events{8192};
+volatile std::sig_atomic_t g_dump_requested = 0;
+
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+std::int64_t current_tid()
+{
+#if defined(SYS_gettid)
+    return static_cast<std::int64_t>(syscall(SYS_gettid));
+#else
+    return static_cast<std::int64_t>(getpid());
+#endif
+}
+
+ThreadRing& local_ring()
+{
+    thread_local ThreadRing* ring = nullptr;
+    if (!ring) {
+        char name[16] = {};
+        if (pthread_getname_np(pthread_self(), name, sizeof(name)) != 0 || name[0] == '\0') {
+            std::snprintf(name, sizeof(name), "thread");
+        }
+        auto created = std::make_shared<ThreadRing>(
+            g_buffer_events.load(std::memory_order_relaxed), current_tid(), name);
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.rings.push_back(created);
+        ring = created.get();
+    }
+    return *ring;
+}
+
+void write_escaped(std::ostream& out, const char* text)
+{
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\' << *c;
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            out << ' ';
+        } else {
+            out << *c;
+        }
+    }
+    out << '"';
+}
+
+// Microseconds with nanosecond digits, without going through a double
+void write_us(std::ostream& out, std::int64_t ns)
+{
+    if (ns < 0) {
+        out << '-';
+        ns = -ns;
+    }
+    const std::int64_t fraction = ns % 1000;
+    out << ns / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+        << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+}
+
+}  // namespace
+
+ThreadRing::ThreadRing(std::size_t capacity, std::int64_t tid, std::string thread_name)
+    : tid_(tid),
+      thread_name_(std::move(thread_name))
+{
+    std::size_t rounded = 16;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    slots_ = std::make_unique<Slot[]>(rounded);
+    mask_ = rounded - 1;
+}
+
+std::size_t ThreadRing::snapshot(std::vector<TraceEvent>& out) const
+{
+    const std::uint64_t capacity = mask_ + 1;
+    const std::uint64_t end = head_.load(std::memory_order_acquire);
+    const std::uint64_t begin = end > capacity ? end - capacity : 0;
+    const std::size_t first = out.size();
+    for (std::uint64_t i = begin; i < end; ++i) {
+        const Slot& slot = slots_[i & mask_];
+        out.push_back(TraceEvent{slot.start_ns.load(std::memory_order_relaxed),
+                                 slot.duration_ns.load(std::memory_order_relaxed),
+                                 slot.name.load(std::memory_order_relaxed),
+                                 slot.arg.load(std::memory_order_relaxed)});
+    }
+
+    // The writer may have lapped the oldest slots while they were copied;
+    // slot i is intact only if position i + capacity was not yet being written
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::uint64_t after = head_.load(std::memory_order_relaxed);
+    const std::uint64_t valid_from = after >= capacity ? after - capacity + 1 : 0;
+    if (valid_from > begin) {
+        const std::size_t torn =
+            static_cast<std::size_t>(std::min<std::uint64_t>(valid_from - begin, end - begin));
+        out.erase(out.begin() + static_cast<std::ptrdiff_t>(first),
+                  out.begin() + static_cast<std::ptrdiff_t>(first + torn));
+    }
+    return out.size() - first;
+}
+
+std::int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void set_enabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool enabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void set_buffer_events(std::size_t events)
+{
+    g_buffer_events.store(events, std::memory_order_relaxed);
+}
+
+void complete(const char* name, std::int64_t start_ns, std::int64_t duration_ns,
+              std::uint64_t arg)
+{
+    if (!enabled()) {
+        return;
+    }
+    local_ring().push(TraceEvent{start_ns, duration_ns < 0 ? 0 : duration_ns, name, arg});
+}
+
+void instant(const char* name, std::uint64_t arg)
+{
+    if (!enabled()) {
+        return;
+    }
+    local_ring().push(TraceEvent{now_ns(), -1, name, arg});
+}
+
+std::size_t write_chrome_trace(std::ostream& out)
+{
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        rings = reg.rings;
+    }
+
+    const long pid = static_cast<long>(getpid());
+    std::size_t written = 0;
+    bool first = true;
+    const auto separator = [&] {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    std::vector<TraceEvent> events;
+    for (const auto& ring : rings) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << ring->tid()
+            << ",\"args\":{\"name\":";
+        write_escaped(out, ring->thread_name().c_str());
+        out << "}}";
+
+        events.clear();
+        ring->snapshot(events);
+        for (const TraceEvent& event : events) {
+            separator();
+            out << "{\"name\":";
+            write_escaped(out, event.name ? event.name : "?");
+            out << ",\"ph\":\"" << (event.duration_ns < 0 ? 'i' : 'X') << "\",\"ts\":";
+            write_us(out, event.start_ns);
+            if (event.duration_ns >= 0) {
+                out << ",\"dur\":";
+                write_us(out, event.duration_ns);
+            } else {
+                out << ",\"s\":\"t\"";
+            }
+            out << ",\"pid\":" << pid << ",\"tid\":" << ring->tid()
+                << ",\"args\":{\"arg\":" << event.arg << "}}";
+            ++written;
+        }
+    }
+    out << "\n]}\n";
+    return written;
+}
+
+std::size_t write_chrome_trace(const std::string& path)
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot write trace to " + path);
+    }
+    const std::size_t written = write_chrome_trace(out);
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Failed writing trace to " + path);
+    }
+    return written;
+}
+
+void request_dump_from_signal(int)
+{
+    g_dump_requested = 1;
+}
+
+bool take_dump_request()
+{
+    if (!g_dump_requested) {
+        return false;
+    }
+    g_dump_requested = 0;
+    return true;
+}
+
+}  // namespace trace
+}  // namespace eos
@@ -0,0 +1,25 @@
+//! Plain data types shared by navigation, the ROS interface and the C ABI
+//!
+//! Kept free of r2r so the FFI staticlib builds without ROS.
+
+/// Simple 2D pose representation
+#[derive(Debug, Clone, Copy)]
+#[repr(C)]
+pub struct Pose2D {
+    /// X position
+    pub x: f32,
+    /// Y position
+    pub y: f32,
+    /// Orientation (theta)
+    pub theta: f32,
+}
+
+/// Motion command for the robot
+#[derive(Debug, Clone, Copy)]
+#[repr(C)]
+pub struct MotionCommand {
+    /// Linear velocity (m/s)
+    pub linear: f32,
+    /// Angular velocity (rad/s)
+    pub angular: f32,
+}
@@ -0,0 +1,92 @@
+// Unit tests for the allocation counter and the allocation-free inference path
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "eos_robotics/allocation_guard.hpp"
+#include "eos_robotics/distance_field.hpp"
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/navigation_controller.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+#include "eos_robotics/scan_preprocessor.hpp"
+
+// The replaced operator new counts every allocation on the calling thread
+TEST(AllocationGuard, CountsThreadAllocations)
+{
+    ASSERT_TRUE(eos::allocation_hooks_enabled());
+
+    const auto before = eos::thread_allocation_count();
+    auto value = std::make_unique<int>(7);
+    std::vector<float> buffer(32);
+    EXPECT_EQ(eos::thread_allocation_count() - before, 2u);
+    EXPECT_EQ(*value, 7);
+    EXPECT_EQ(buffer.size(), 32u);
+}
+
+// A guarded scope that allocates aborts the process
+TEST(AllocationGuardDeathTest, AbortsOnAllocationInScope)
+{
+    EXPECT_DEATH(
+        {
+            EOS_ASSERT_NO_ALLOCATIONS("test scope");
+            std::vector<float> buffer(16, 1.0f);
+            EXPECT_FLOAT_EQ(buffer.back(), 1.0f);
+        },
+        "allocation-free scope 'test scope'");
+}
+
+// Steady-state preprocessing and inference never touch the heap
+TEST(AllocationGuard, InferencePathIsAllocationFree)
+{
+    eos::LifConfig config;
+    eos::LifEngine engine(config);
+    eos::ScanPreprocessorConfig scan_config;
+    scan_config.bins = config.input_size;
+    eos::ScanPreprocessor preprocessor(scan_config);
+
+    std::vector<float> ranges(720);
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+        ranges[i] = 1.0f + std::sin(0.01f * static_cast<float>(i));
+    }
+    std::vector<float> output(engine.output_size());
+
+    // The first scan sizes the preprocessor's scratch for this geometry
+    preprocessor.process(ranges.data(), ranges.size(), 0.1f, 10.0f, -3.14f, 0.0087f);
+
+    const auto before = eos::thread_allocation_count();
+    for (int cycle = 0; cycle < 10; ++cycle) {
+        preprocessor.process(ranges.data(), ranges.size(), 0.1f, 10.0f, -3.14f, 0.0087f);
+        engine.run(preprocessor.output(), output.data());
+    }
+    EXPECT_EQ(eos::thread_allocation_count(), before);
+}
+
+// Scan intake and a control tick of the local planner never touch the heap
+TEST(AllocationGuard, NavigationPathIsAllocationFree)
+{
+    eos::NavigationController controller(eos::NavigationControllerConfig{});
+    eos::OccupancyGrid map(eos::OccupancyGridConfig{});
+    eos::DistanceField field(map, 0.8f);
+    controller.use_map(&field);
+    controller.set_goal(eos::Pose2D{2.0f, 1.0f, 0.0f});
+    std::vector<float> ranges(720);
+    for (std::size_t i = 0; i < ranges.size(); ++i) {
+        ranges[i] = 1.0f + std::sin(0.01f * static_cast<float>(i));
+    }
+    // The first scan of a geometry builds the map's beam table
+    map.integrate_scan(eos::Pose2D{}, ranges.data(), ranges.size(), 0.1f, 10.0f, -3.14f, 0.0087f);
+
+    const auto before = eos::thread_allocation_count();
+    for (int cycle = 0; cycle < 10; ++cycle) {
+        const eos::Pose2D pose{0.1f * static_cast<float>(cycle), 0.0f, 0.0f};
+        map.recenter(pose.x, pose.y);
+        map.integrate_scan(pose, ranges.data(), ranges.size(), 0.1f, 10.0f, -3.14f, 0.0087f);
+        field.update();
+        controller.update_scan(ranges.data(), ranges.size(), 0.1f, 10.0f, -3.14f, 0.0087f);
+        controller.compute_command(pose);
+    }
+    EXPECT_EQ(eos::thread_allocation_count(), before);
+}
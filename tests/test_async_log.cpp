@@ -0,0 +1,186 @@
+// Unit tests for the asynchronous hot-path logger
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "eos_robotics/async_log.hpp"
+
+namespace
+{
+
+template <typename... Args>
+std::string format(const char* fmt, Args... args)
+{
+    eos::LogRecord record;
+    record.format = fmt;
+    record.arg_count = sizeof...(Args);
+    std::size_t i = 0;
+    ((record.args[i++] = eos::LogArg::from(args)), ...);
+    return eos::format_record(record);
+}
+
+struct Collector
+{
+    std::mutex mutex;
+    std::vector<std::string> lines;
+
+    eos::AsyncLog::Sink sink()
+    {
+        return [this](eos::LogLevel, eos::LogSubsystem, const std::string& text) {
+            std::lock_guard<std::mutex> lock(mutex);
+            lines.push_back(text);
+        };
+    }
+};
+
+// One EOS_HOT_LOG call site, shared by every log it is called with
+void hot_log(eos::AsyncLog& log, int robot)
+{
+    EOS_HOT_LOG(log, eos::LogSubsystem::Perception, eos::LogLevel::Info, 60000, 1, "robot %d",
+                robot);
+}
+
+}  // namespace
+
+// Conversions keep their flags, width and precision and follow the argument's type
+TEST(AsyncLog, FormatsLikePrintf)
+{
+    EXPECT_EQ(format("Laser scan: %zu points, first: %.2f, last: %.2f", std::size_t{360}, 1.234f,
+                     5.0),
+              "Laser scan: 360 points, first: 1.23, last: 5.00");
+    EXPECT_EQ(format("%5d|%-4u|%x|%s|100%%", -7, 3u, 255, "skip"), "   -7|3   |ff|skip|100%");
+    // A mismatched length modifier cannot misread the argument
+    EXPECT_EQ(format("%d and %.1f", 2.5, 3), "2.5 and 3.0");
+    EXPECT_EQ(format("missing %d"), "missing ?");
+}
+
+// Records from several threads all reach the sink once the log is flushed
+TEST(AsyncLog, DeliversFromManyThreads)
+{
+    Collector collector;
+    eos::AsyncLog log(1024, collector.sink());
+    log.set_level(eos::LogSubsystem::Perception, eos::LogLevel::Debug);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 100; ++i) {
+                eos::LogSite site(0, 1);
+                log.write(site, eos::LogSubsystem::Perception, eos::LogLevel::Debug,
+                          "thread %d message %d", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    log.flush();
+
+    EXPECT_EQ(log.dropped(), 0u);
+    std::lock_guard<std::mutex> lock(collector.mutex);
+    EXPECT_EQ(collector.lines.size(), 400u);
+}
+
+// Below the subsystem's level nothing is queued
+TEST(AsyncLog, FiltersBySubsystemLevel)
+{
+    Collector collector;
+    eos::AsyncLog log(16, collector.sink());
+    log.set_level(eos::LogSubsystem::Neural, eos::LogLevel::Debug);
+    log.set_level(eos::LogSubsystem::Navigation, eos::LogLevel::Warn);
+
+    eos::LogSite site(0, 1);
+    EXPECT_TRUE(log.write(site, eos::LogSubsystem::Neural, eos::LogLevel::Debug, "neural"));
+    EXPECT_FALSE(log.write(site, eos::LogSubsystem::Navigation, eos::LogLevel::Info, "nav"));
+    EXPECT_TRUE(log.write(site, eos::LogSubsystem::Navigation, eos::LogLevel::Error, "nav error"));
+    EXPECT_FALSE(log.write(site, eos::LogSubsystem::Perception, eos::LogLevel::Debug, "scan"));
+    log.flush();
+
+    std::lock_guard<std::mutex> lock(collector.mutex);
+    EXPECT_EQ(collector.lines, (std::vector<std::string>{"neural", "nav error"}));
+}
+
+// Sampling lets one call in N through and reports what it skipped
+TEST(AsyncLog, SamplesAndCountsSuppressedCalls)
+{
+    Collector collector;
+    eos::AsyncLog log(64, collector.sink());
+    log.set_level(eos::LogSubsystem::Perception, eos::LogLevel::Debug);
+
+    eos::LogSite site(0, 10);
+    std::size_t queued = 0;
+    for (int i = 0; i < 25; ++i) {
+        queued += log.write(site, eos::LogSubsystem::Perception, eos::LogLevel::Debug, "imu %d", i);
+    }
+    log.flush();
+
+    EXPECT_EQ(queued, 3u);
+    std::lock_guard<std::mutex> lock(collector.mutex);
+    EXPECT_EQ(collector.lines,
+              (std::vector<std::string>{"imu 0", "imu 10 [9 suppressed]", "imu 20 [9 suppressed]"}));
+}
+
+// Throttling keeps at most one call per interval
+TEST(AsyncLog, ThrottlesByInterval)
+{
+    eos::LogSite site(1000000000, 1);
+    std::uint64_t suppressed = 0;
+    EXPECT_TRUE(site.admit(10, suppressed));
+    EXPECT_FALSE(site.admit(20, suppressed));
+    EXPECT_FALSE(site.admit(999999999, suppressed));
+    EXPECT_TRUE(site.admit(1000000010, suppressed));
+    EXPECT_EQ(suppressed, 2u);
+}
+
+// Each log throttles an EOS_HOT_LOG site on its own, so robots in one process do not silence each other
+TEST(AsyncLog, ThrottlesSitesPerLog)
+{
+    Collector first;
+    Collector second;
+    {
+        eos::AsyncLog a(16, first.sink());
+        eos::AsyncLog b(16, second.sink());
+        hot_log(a, 0);
+        hot_log(b, 1);
+        hot_log(a, 2);
+        hot_log(b, 3);
+    }
+    EXPECT_EQ(first.lines, (std::vector<std::string>{"robot 0"}));
+    EXPECT_EQ(second.lines, (std::vector<std::string>{"robot 1"}));
+}
+
+// A full queue drops and counts instead of blocking
+TEST(AsyncLog, DropsWhenFull)
+{
+    std::mutex gate;
+    std::unique_lock<std::mutex> hold(gate);
+    eos::AsyncLog log(4, [&](eos::LogLevel, eos::LogSubsystem, const std::string&) {
+        std::lock_guard<std::mutex> wait(gate);
+    });
+    log.set_level(eos::LogSubsystem::Perception, eos::LogLevel::Debug);
+
+    // The first record may be taken by the logger thread, which then blocks in the sink
+    eos::LogSite site(0, 1);
+    std::size_t queued = 0;
+    for (int i = 0; i < 20; ++i) {
+        queued += log.write(site, eos::LogSubsystem::Perception, eos::LogLevel::Debug, "x");
+    }
+    EXPECT_LE(queued, 5u);
+    EXPECT_EQ(log.dropped(), 20u - queued);
+    hold.unlock();
+    log.flush();
+}
+
+// Level names from debug.log_level
+TEST(AsyncLog, ParsesLevels)
+{
+    EXPECT_EQ(eos::parse_log_level("debug"), eos::LogLevel::Debug);
+    EXPECT_EQ(eos::parse_log_level("warn"), eos::LogLevel::Warn);
+    EXPECT_EQ(eos::parse_log_level("off"), eos::LogLevel::Off);
+    EXPECT_THROW(eos::parse_log_level("verbose"), std::invalid_argument);
+}
@@ -0,0 +1,150 @@
+// Unit tests for the incremental obstacle distance layer
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/distance_field.hpp"
+
+namespace
+{
+
+constexpr float kPi = 3.14159265f;
+
+eos::OccupancyGridConfig small_config()
+{
+    eos::OccupancyGridConfig config;
+    config.resolution = 0.1f;
+    config.cells = 64;
+    config.max_range = 2.5f;
+    return config;
+}
+
+/// Integrate a scan of @p beams returns between 0.5 and 2 m from @p pose
+void random_scan(eos::OccupancyGrid& grid, const eos::Pose2D& pose, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> range(0.5f, 2.0f);
+    std::bernoulli_distribution missing(0.3);
+    std::vector<float> ranges(90);
+    for (auto& r : ranges) {
+        r = missing(rng) ? std::numeric_limits<float>::infinity() : range(rng);
+    }
+    grid.integrate_scan(pose, ranges.data(), ranges.size(), 0.05f, 10.0f, -kPi,
+                        2.0f * kPi / static_cast<float>(ranges.size()));
+}
+
+/// Brute-force distance of every window cell, compared with the field
+void expect_exact(const eos::DistanceField& field)
+{
+    const eos::OccupancyGrid& grid = field.grid();
+    const long size = static_cast<long>(grid.cells());
+    std::vector<long> occupied_x;
+    std::vector<long> occupied_y;
+    for (long cx = grid.origin_x(); cx < grid.origin_x() + size; ++cx) {
+        for (long cy = grid.origin_y(); cy < grid.origin_y() + size; ++cy) {
+            if (grid.occupied_cell(cx, cy)) {
+                occupied_x.push_back(cx);
+                occupied_y.push_back(cy);
+            }
+        }
+    }
+    for (long cx = grid.origin_x(); cx < grid.origin_x() + size; ++cx) {
+        for (long cy = grid.origin_y(); cy < grid.origin_y() + size; ++cy) {
+            float nearest = field.max_distance();
+            for (std::size_t i = 0; i < occupied_x.size(); ++i) {
+                const float dx = static_cast<float>(cx - occupied_x[i]);
+                const float dy = static_cast<float>(cy - occupied_y[i]);
+                nearest = std::min(nearest, std::sqrt(dx * dx + dy * dy) * grid.resolution());
+            }
+            ASSERT_NEAR(field.distance_cell(cx, cy), nearest, 1e-5f) << cx << ", " << cy;
+        }
+    }
+}
+
+}  // namespace
+
+// A non-positive range is rejected
+TEST(DistanceField, RejectsInvalidRange)
+{
+    eos::OccupancyGrid grid(small_config());
+    EXPECT_THROW(eos::DistanceField(grid, 0.0f), std::invalid_argument);
+}
+
+// Distances grow from a single obstacle and saturate at the range
+TEST(DistanceField, MeasuresFromObstacle)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    eos::DistanceField field(grid, 0.5f);
+    EXPECT_FLOAT_EQ(field.distance(0.05f, 0.05f), 0.5f);
+
+    // Only the beam straight ahead returns, 1 m out
+    std::vector<float> ranges(360, std::numeric_limits<float>::quiet_NaN());
+    ranges[180] = 1.0f;
+    grid.integrate_scan(eos::Pose2D{0.05f, 0.05f, 0.0f}, ranges.data(), ranges.size(), 0.05f,
+                        10.0f, -kPi, 2.0f * kPi / 360.0f);
+    field.update();
+
+    EXPECT_FLOAT_EQ(field.distance(1.05f, 0.05f), 0.0f);
+    EXPECT_NEAR(field.distance(1.35f, 0.05f), 0.3f, 1e-5f);
+    EXPECT_NEAR(field.distance(1.35f, 0.45f), 0.5f, 1e-5f);
+    EXPECT_FLOAT_EQ(field.distance(0.25f, 0.05f), 0.5f);
+    // Outside the window nothing is known
+    EXPECT_FLOAT_EQ(field.distance(50.0f, 0.0f), 0.5f);
+}
+
+// Random scans and moves of the window keep the field exact
+TEST(DistanceField, IncrementalUpdatesStayExact)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    eos::DistanceField field(grid, 0.5f);
+    std::mt19937 rng(3);
+
+    eos::Pose2D pose;
+    for (int step = 0; step < 40; ++step) {
+        pose.x += 0.13f * std::cos(0.2f * static_cast<float>(step));
+        pose.y += 0.11f * std::sin(0.15f * static_cast<float>(step));
+        pose.theta += 0.1f;
+        grid.recenter(pose.x, pose.y);
+        random_scan(grid, pose, rng);
+        field.update();
+        ASSERT_NO_FATAL_FAILURE(expect_exact(field)) << "step " << step;
+    }
+
+    // A jump beyond the window recomputes it whole
+    pose.x += 20.0f;
+    grid.recenter(pose.x, pose.y);
+    random_scan(grid, pose, rng);
+    EXPECT_EQ(field.update(), grid.cells() * grid.cells());
+    expect_exact(field);
+}
+
+// Only the cells near a change are recomputed
+TEST(DistanceField, UpdatesOnlyDirtyCells)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    eos::DistanceField field(grid, 0.5f);
+    EXPECT_EQ(field.update(), 0u);
+
+    std::vector<float> ranges(360, std::numeric_limits<float>::quiet_NaN());
+    ranges[180] = 1.0f;
+    grid.integrate_scan(eos::Pose2D{0.05f, 0.05f, 0.0f}, ranges.data(), ranges.size(), 0.05f,
+                        10.0f, -kPi, 2.0f * kPi / 360.0f);
+    // One new obstacle cell: an 11 x 11 patch around it
+    EXPECT_EQ(field.update(), 121u);
+    EXPECT_EQ(field.update(), 0u);
+
+    // One cell east: the entering column and the band along the edge left behind
+    grid.recenter(0.15f, 0.0f);
+    const std::size_t moved = field.update();
+    EXPECT_GT(moved, 0u);
+    EXPECT_LE(moved, 2u * 6u * grid.cells());
+    expect_exact(field);
+}
@@ -0,0 +1,143 @@
+// Unit tests for the latched obstacle stop
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/emergency_stop.hpp"
+
+namespace
+{
+
+constexpr float kPi = 3.14159265f;
+
+/// 360-beam scan from angle_min with every beam at @p range
+struct Scan
+{
+    Scan(float range, float angle_min) : ranges(360, range), angle_min(angle_min) {}
+
+    bool check(eos::EmergencyStop& stop) const
+    {
+        return stop.check_scan(ranges.data(), ranges.size(), 0.05f, angle_min, increment);
+    }
+
+    /// Beam closest to @p angle
+    float& at(float angle)
+    {
+        const long i = std::lround((angle - angle_min) / increment);
+        return ranges[static_cast<std::size_t>((i % 360 + 360) % 360)];
+    }
+
+    std::vector<float> ranges;
+    float angle_min;
+    float increment = 2.0f * kPi / 360.0f;
+};
+
+}  // namespace
+
+// Inverted or empty distances and sectors are rejected
+TEST(EmergencyStop, RejectsInvalidConfig)
+{
+    eos::EmergencyStopConfig config;
+    config.release_distance = 0.1f;
+    EXPECT_THROW(eos::EmergencyStop{config}, std::invalid_argument);
+
+    config = eos::EmergencyStopConfig{};
+    config.half_angle = 0.0f;
+    EXPECT_THROW(eos::EmergencyStop{config}, std::invalid_argument);
+}
+
+// An obstacle ahead latches the stop until the sector clears past the release distance
+TEST(EmergencyStop, LatchesWithHysteresis)
+{
+    eos::EmergencyStop stop(eos::EmergencyStopConfig{});
+    Scan scan(5.0f, -kPi);
+    EXPECT_FALSE(scan.check(stop));
+
+    scan.at(0.2f) = 0.15f;
+    EXPECT_TRUE(scan.check(stop));
+    EXPECT_TRUE(stop.stopped());
+    EXPECT_FLOAT_EQ(stop.nearest(), 0.15f);
+    EXPECT_EQ(stop.triggers(), 1u);
+
+    // Backing off to between the two distances keeps it latched
+    scan.at(0.2f) = 0.25f;
+    EXPECT_TRUE(scan.check(stop));
+
+    scan.at(0.2f) = 0.35f;
+    EXPECT_FALSE(scan.check(stop));
+    EXPECT_FALSE(stop.stopped());
+    EXPECT_EQ(stop.triggers(), 1u);
+}
+
+// Returns outside the sector, invalid readings and echoes below range_min are ignored
+TEST(EmergencyStop, OnlyChecksValidReturnsAhead)
+{
+    eos::EmergencyStop stop(eos::EmergencyStopConfig{});
+    Scan scan(std::numeric_limits<float>::infinity(), -kPi);
+    scan.at(1.5f) = 0.1f;
+    scan.at(kPi) = 0.1f;
+    scan.at(0.0f) = std::numeric_limits<float>::quiet_NaN();
+    scan.at(0.1f) = 0.01f;
+    EXPECT_FALSE(scan.check(stop));
+    EXPECT_TRUE(std::isinf(stop.nearest()));
+}
+
+// Scans from 0 to 2 pi cover the sector across their wrap-around
+TEST(EmergencyStop, HandlesScansThatWrapAtHeading)
+{
+    eos::EmergencyStop stop(eos::EmergencyStopConfig{});
+    Scan scan(5.0f, 0.0f);
+    scan.at(2.0f * kPi - 0.5f) = 0.1f;
+    EXPECT_TRUE(scan.check(stop));
+
+    stop.reset();
+    scan.at(2.0f * kPi - 0.5f) = 5.0f;
+    scan.at(0.5f) = 0.1f;
+    EXPECT_TRUE(scan.check(stop));
+
+    // Clockwise scans index the same sector from the other end
+    stop.reset();
+    Scan clockwise(5.0f, kPi);
+    clockwise.increment = -clockwise.increment;
+    clockwise.at(-0.3f) = 0.1f;
+    EXPECT_TRUE(clockwise.check(stop));
+}
+
+// While latched only reversing and turning pass, and a blocked robot turns towards the open side
+TEST(EmergencyStop, LimitsLatchedCommandsToRecovery)
+{
+    eos::EmergencyStop stop(eos::EmergencyStopConfig{});
+    double linear = 0.3;
+    double angular = 0.2;
+    stop.limit(linear, angular);
+    EXPECT_DOUBLE_EQ(linear, 0.3);
+
+    Scan scan(5.0f, -kPi);
+    scan.at(-0.2f) = 0.1f;
+    ASSERT_TRUE(scan.check(stop));
+    stop.limit(linear, angular);
+    EXPECT_DOUBLE_EQ(linear, 0.0);
+    EXPECT_DOUBLE_EQ(angular, 0.2);
+
+    linear = -0.1;
+    angular = 0.0;
+    stop.limit(linear, angular);
+    EXPECT_DOUBLE_EQ(linear, -0.1);
+    EXPECT_DOUBLE_EQ(angular, 0.0);
+
+    // The obstacle is on the right, so recovery turns left
+    linear = 0.0;
+    stop.limit(linear, angular);
+    EXPECT_DOUBLE_EQ(angular, eos::EmergencyStopConfig{}.recovery_turn_rate);
+
+    scan.at(-0.2f) = 5.0f;
+    scan.at(0.2f) = 0.15f;
+    ASSERT_TRUE(scan.check(stop));
+    angular = 0.0;
+    stop.limit(linear, angular);
+    EXPECT_LT(angular, 0.0);
+}
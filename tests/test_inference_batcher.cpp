@@ -0,0 +1,136 @@
+// Unit tests for micro-batching requests from several clients onto one engine
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/inference_batcher.hpp"
+#include "eos_robotics/lif_engine.hpp"
+
+namespace
+{
+
+struct Reply
+{
+    std::int64_t tag = -1;
+    std::size_t batch_size = 0;
+    std::vector<float> output;
+};
+
+// Records replies per client and lets the test wait for a number of them
+class ReplyLog
+{
+public:
+    explicit ReplyLog(std::size_t clients) : replies_(clients) {}
+
+    eos::InferenceBatcher::ReplyCallback callback()
+    {
+        return [this](std::size_t client, std::int64_t tag, const float* output,
+                      std::size_t batch_size) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Reply& reply = replies_[client];
+            reply.tag = tag;
+            reply.batch_size = batch_size;
+            reply.output.assign(output, output + output_size);
+            ++received_;
+            done_.notify_all();
+        };
+    }
+
+    bool wait_for(std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return done_.wait_for(lock, std::chrono::seconds(10),
+                              [this, count]() { return received_ >= count; });
+    }
+
+    Reply get(std::size_t client)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return replies_[client];
+    }
+
+    std::size_t output_size = 0;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::vector<Reply> replies_;
+    std::size_t received_ = 0;
+};
+
+std::vector<float> features_for(std::size_t client, std::size_t size)
+{
+    std::vector<float> features(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        features[i] = static_cast<float>((i + client * 3) % 10) / 10.0f;
+    }
+    return features;
+}
+
+}  // namespace
+
+// Requests from every client run as one batch and match a private engine's output
+TEST(InferenceBatcher, BatchesAllClientsAndMatchesSingleRuns)
+{
+    const std::size_t clients = 3;
+    eos::LifConfig config;
+    config.propagation = eos::PropagationMode::Dense;
+    config.max_batch = clients;
+    auto engine = std::make_unique<eos::LifEngine>(config);
+    eos::LifEngine reference(engine->model(), config);
+
+    ReplyLog log(clients);
+    log.output_size = config.output_size;
+    // A budget far beyond the test's runtime: only a full batch can run
+    eos::InferenceBatcher batcher(std::move(engine), clients, std::chrono::seconds(30),
+                                  log.callback());
+    for (std::size_t client = 0; client < clients; ++client) {
+        batcher.submit(client, 100 + client, features_for(client, config.input_size).data());
+    }
+    ASSERT_TRUE(log.wait_for(clients));
+    EXPECT_EQ(batcher.batches(), 1u);
+    EXPECT_EQ(batcher.requests(), clients);
+
+    std::vector<float> expected(config.output_size);
+    for (std::size_t client = 0; client < clients; ++client) {
+        reference.run(features_for(client, config.input_size).data(), expected.data());
+        const Reply reply = log.get(client);
+        EXPECT_EQ(reply.tag, static_cast<std::int64_t>(100 + client));
+        EXPECT_EQ(reply.batch_size, clients);
+        EXPECT_EQ(reply.output, expected);
+    }
+}
+
+// A lone request runs once the latency budget expires instead of waiting for the others
+TEST(InferenceBatcher, PartialBatchRunsAfterLatencyBudget)
+{
+    eos::LifConfig config;
+    config.max_batch = 4;
+    ReplyLog log(4);
+    log.output_size = config.output_size;
+    eos::InferenceBatcher batcher(std::make_unique<eos::LifEngine>(config), 4,
+                                  std::chrono::milliseconds(5), log.callback());
+
+    batcher.submit(2, 7, features_for(2, config.input_size).data());
+    ASSERT_TRUE(log.wait_for(1));
+    EXPECT_EQ(log.get(2).tag, 7);
+    EXPECT_EQ(log.get(2).batch_size, 1u);
+    EXPECT_EQ(log.get(0).tag, -1);
+}
+
+// The engine must be able to hold one sample per client
+TEST(InferenceBatcher, RejectsEngineSmallerThanClientCount)
+{
+    eos::LifConfig config;
+    config.max_batch = 2;
+    EXPECT_THROW(eos::InferenceBatcher(std::make_unique<eos::LifEngine>(config), 3,
+                                       std::chrono::milliseconds(1), nullptr),
+                 std::invalid_argument);
+}
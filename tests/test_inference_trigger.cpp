@@ -0,0 +1,121 @@
+// Unit tests for the inference trigger gate and the IMU stamp history
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "eos_robotics/inference_trigger.hpp"
+
+namespace
+{
+
+constexpr std::int64_t kMs = 1000000;
+
+}  // namespace
+
+// Without limits every new scan runs, and only once
+TEST(InferenceTrigger, RunsEachScanOnce)
+{
+    eos::InferenceTrigger trigger;
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 110 * kMs), eos::TriggerDecision::Run);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 120 * kMs), eos::TriggerDecision::Unchanged);
+    EXPECT_EQ(trigger.evaluate(200 * kMs, 0, 210 * kMs), eos::TriggerDecision::Run);
+}
+
+// A scan older than the deadline is skipped and can still be followed by a fresh one
+TEST(InferenceTrigger, SkipsScansPastTheDeadline)
+{
+    eos::InferenceTriggerConfig config;
+    config.deadline_ns = 50 * kMs;
+    eos::InferenceTrigger trigger(config);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 151 * kMs), eos::TriggerDecision::DeadlineMissed);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 150 * kMs), eos::TriggerDecision::Run);
+}
+
+// Inferences closer together than min_interval are held back
+TEST(InferenceTrigger, RateLimitsFromTheLastRun)
+{
+    eos::InferenceTriggerConfig config;
+    config.min_interval_ns = 100 * kMs;
+    eos::InferenceTrigger trigger(config);
+    EXPECT_EQ(trigger.evaluate(0, 0, 10 * kMs), eos::TriggerDecision::Run);
+    EXPECT_EQ(trigger.evaluate(50 * kMs, 0, 60 * kMs), eos::TriggerDecision::RateLimited);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 110 * kMs), eos::TriggerDecision::Run);
+}
+
+// With sync_imu the matched IMU sample has to lie within the slop, on either side
+TEST(InferenceTrigger, RequiresAnImuSampleWithinTheSlop)
+{
+    eos::InferenceTriggerConfig config;
+    config.sync_imu = true;
+    config.sync_slop_ns = 20 * kMs;
+    eos::InferenceTrigger trigger(config);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 121 * kMs, 130 * kMs),
+              eos::TriggerDecision::Unsynchronized);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 79 * kMs, 130 * kMs),
+              eos::TriggerDecision::Unsynchronized);
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 120 * kMs, 130 * kMs), eos::TriggerDecision::Run);
+}
+
+// The same scan is Unchanged before it is late, late before rate limited,
+// and rate limited before unsynchronized
+TEST(InferenceTrigger, DecisionsKeepTheirPriority)
+{
+    eos::InferenceTriggerConfig config;
+    config.deadline_ns = 50 * kMs;
+    config.min_interval_ns = 100 * kMs;
+    config.sync_imu = true;
+    config.sync_slop_ns = 10 * kMs;
+    eos::InferenceTrigger trigger(config);
+    ASSERT_EQ(trigger.evaluate(100 * kMs, 100 * kMs, 110 * kMs), eos::TriggerDecision::Run);
+
+    // Already consumed, even though it is also late, too soon and unsynchronized
+    EXPECT_EQ(trigger.evaluate(100 * kMs, 0, 190 * kMs), eos::TriggerDecision::Unchanged);
+    // New but late, too soon and unsynchronized
+    EXPECT_EQ(trigger.evaluate(120 * kMs, 0, 180 * kMs), eos::TriggerDecision::DeadlineMissed);
+    // In time but too soon and unsynchronized
+    EXPECT_EQ(trigger.evaluate(150 * kMs, 0, 160 * kMs), eos::TriggerDecision::RateLimited);
+    // In time, not too soon, but unsynchronized
+    EXPECT_EQ(trigger.evaluate(200 * kMs, 0, 220 * kMs), eos::TriggerDecision::Unsynchronized);
+}
+
+// Every evaluation is counted under its decision, and skips do not consume the scan
+TEST(InferenceTrigger, CountsEveryDecision)
+{
+    eos::InferenceTriggerConfig config;
+    config.deadline_ns = 50 * kMs;
+    config.min_interval_ns = 100 * kMs;
+    config.sync_imu = true;
+    config.sync_slop_ns = 10 * kMs;
+    eos::InferenceTrigger trigger(config);
+    trigger.evaluate(200 * kMs, 0, 210 * kMs);          // unsynchronized
+    trigger.evaluate(200 * kMs, 205 * kMs, 260 * kMs);  // deadline missed
+    trigger.evaluate(200 * kMs, 205 * kMs, 210 * kMs);  // run
+    trigger.evaluate(200 * kMs, 205 * kMs, 220 * kMs);  // unchanged
+    trigger.evaluate(250 * kMs, 250 * kMs, 260 * kMs);  // rate limited
+    trigger.evaluate(250 * kMs, 250 * kMs, 261 * kMs);  // rate limited
+    EXPECT_EQ(trigger.count(eos::TriggerDecision::Run), 1u);
+    EXPECT_EQ(trigger.count(eos::TriggerDecision::Unchanged), 1u);
+    EXPECT_EQ(trigger.count(eos::TriggerDecision::DeadlineMissed), 1u);
+    EXPECT_EQ(trigger.count(eos::TriggerDecision::RateLimited), 2u);
+    EXPECT_EQ(trigger.count(eos::TriggerDecision::Unsynchronized), 1u);
+}
+
+// The history matches a stamp to its closest sample among the last kCapacity
+TEST(StampHistory, FindsTheClosestRecentSample)
+{
+    eos::StampHistory history;
+    EXPECT_EQ(history.nearest(100 * kMs), 0);
+
+    // A 200 Hz IMU; a scan stamped at 103 ms arrives and is matched at 160 ms
+    for (std::int64_t stamp = 0; stamp <= 160 * kMs; stamp += 5 * kMs) {
+        history.push(stamp);
+    }
+    EXPECT_EQ(history.size(), eos::StampHistory::kCapacity);
+    EXPECT_EQ(history.nearest(103 * kMs), 105 * kMs);
+    EXPECT_EQ(history.nearest(101 * kMs), 100 * kMs);
+    EXPECT_EQ(history.nearest(500 * kMs), 160 * kMs);
+    // Overwritten samples are no longer matched
+    EXPECT_EQ(history.nearest(0), 160 * kMs - static_cast<std::int64_t>(
+                                      eos::StampHistory::kCapacity - 1) * 5 * kMs);
+}
@@ -0,0 +1,87 @@
+// Unit tests for the latency histogram and loop monitoring
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "eos_robotics/latency_histogram.hpp"
+#include "eos_robotics/node_metrics.hpp"
+
+// Bucket bounds are exact below 16 and within 1/16 relative error above
+TEST(LatencyHistogram, BucketBoundsHaveBoundedRelativeError)
+{
+    for (std::uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull,
+                                (1ull << 62) + 12345ull})
+    {
+        const std::size_t index = eos::LatencyHistogram::bucket_index(value);
+        ASSERT_LT(index, eos::LatencyHistogram::kBuckets);
+        const std::uint64_t upper = eos::LatencyHistogram::bucket_upper_bound(index);
+        EXPECT_GE(upper, value);
+        EXPECT_LE(static_cast<double>(upper - value), static_cast<double>(value) / 16.0);
+    }
+    EXPECT_EQ(eos::LatencyHistogram::bucket_index(~0ull), eos::LatencyHistogram::kBuckets - 1);
+}
+
+// Percentiles of a uniform 1..1000 us distribution land within bucket precision
+TEST(LatencyHistogram, PercentilesOfUniformDistribution)
+{
+    eos::LatencyHistogram histogram;
+    for (std::int64_t us = 1; us <= 1000; ++us) {
+        histogram.record(us * 1000);
+    }
+
+    const eos::HistogramSummary summary = histogram.summarize();
+    EXPECT_EQ(summary.count, 1000u);
+    EXPECT_NEAR(summary.mean_ns, 500500.0, 1.0);
+    EXPECT_EQ(summary.max_ns, 1000000);
+    EXPECT_NEAR(summary.p50_ns, 500000, 500000 / 16);
+    EXPECT_NEAR(summary.p99_ns, 990000, 990000 / 16);
+    EXPECT_EQ(summary.p999_ns, 1000000);
+    EXPECT_EQ(histogram.percentile(0.5), summary.p50_ns);
+}
+
+// Concurrent writers never lose samples
+TEST(LatencyHistogram, ConcurrentRecordingKeepsEveryCount)
+{
+    eos::LatencyHistogram histogram;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&histogram, t]() {
+            for (int i = 0; i < 10000; ++i) {
+                histogram.record(t * 1000 + i);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(histogram.summarize().count, 40000u);
+}
+
+// Late ticks show up as jitter and missed periods, long callbacks as overruns
+TEST(LoopMonitor, CountsJitterMissedPeriodsAndOverruns)
+{
+    eos::NodeMetrics metrics;
+    metrics.configure_loop(eos::MonitoredLoop::Navigation, 1000, eos::LatencyMetric::NavigationJitter);
+    eos::LoopMonitor& loop = metrics.loop(eos::MonitoredLoop::Navigation);
+
+    loop.begin(0);
+    loop.end(100);
+    loop.begin(1100);   // 100 ns late
+    loop.end(2500);     // ran for 1400 ns > period
+    loop.begin(4100);   // 3000 ns interval: two periods skipped
+    loop.end(4200);
+
+    EXPECT_EQ(loop.overruns(), 1u);
+    EXPECT_EQ(loop.missed_periods(), 2u);
+    const auto jitter = metrics.histogram(eos::LatencyMetric::NavigationJitter).summarize();
+    EXPECT_EQ(jitter.count, 2u);
+    EXPECT_EQ(jitter.max_ns, 2000);
+
+    std::ostringstream report;
+    metrics.write_report(report);
+    EXPECT_NE(report.str().find("navigation_timer_jitter"), std::string::npos);
+    EXPECT_NE(report.str().find("overruns=1"), std::string::npos);
+}
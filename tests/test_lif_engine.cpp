@@ -0,0 +1,239 @@
+// Unit tests for the native LIF engine and its SIMD kernels
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/aligned_buffer.hpp"
+#include "eos_robotics/kernels.hpp"
+#include "eos_robotics/lif_engine.hpp"
+
+// lif_step must match the scalar LIF update, including the non-vector tail
+TEST(Kernels, LifStepMatchesScalarReference)
+{
+    const std::size_t count = 19;
+    std::vector<float> membrane(count), current(count), spikes(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        membrane[i] = 0.05f * static_cast<float>(i);
+        current[i] = 0.02f * static_cast<float>(i % 7);
+    }
+    std::vector<float> expected_membrane = membrane;
+
+    const std::size_t fired = eos::kernels::lif_step(
+        membrane.data(), current.data(), spikes.data(), count, 0.9f, 0.5f);
+
+    std::size_t expected_fired = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const float v = expected_membrane[i] * 0.9f + current[i];
+        const bool spike = v >= 0.5f;
+        expected_fired += spike ? 1 : 0;
+        EXPECT_FLOAT_EQ(spikes[i], spike ? 1.0f : 0.0f);
+        EXPECT_NEAR(membrane[i], spike ? 0.0f : v, 1e-6f);
+    }
+    EXPECT_EQ(fired, expected_fired);
+}
+
+// min_squared_distance only ever lowers each lane to its nearest point, tail included
+TEST(Kernels, MinSquaredDistanceMatchesScalarReference)
+{
+    const std::size_t count = 21;
+    std::vector<float> x(count), y(count), min_sq(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] = 0.1f * static_cast<float>(i);
+        y[i] = 0.05f * static_cast<float>(i % 5);
+        min_sq[i] = i % 4 == 0 ? 0.01f : 1e9f;
+    }
+    const std::vector<float> px{0.5f, 1.2f, -0.3f};
+    const std::vector<float> py{0.1f, 0.0f, 0.2f};
+    std::vector<float> expected = min_sq;
+
+    eos::kernels::min_squared_distance(x.data(), y.data(), count, px.data(), py.data(),
+                                       px.size(), min_sq.data());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j < px.size(); ++j) {
+            const float dx = x[i] - px[j];
+            const float dy = y[i] - py[j];
+            expected[i] = std::min(expected[i], dx * dx + dy * dy);
+        }
+        EXPECT_NEAR(min_sq[i], expected[i], 1e-6f);
+    }
+}
+
+// Invalid readings never win the minimum, in the vector body or the tail
+TEST(Kernels, MinValidRangeSkipsInvalidReadings)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> ranges(19, 4.0f);
+    ranges[2] = nan;
+    ranges[5] = 0.01f;
+    ranges[9] = 1.5f;
+    ranges[17] = nan;
+    EXPECT_FLOAT_EQ(eos::kernels::min_valid_range(ranges.data(), ranges.size(), 0.05f), 1.5f);
+
+    ranges[18] = 0.8f;
+    EXPECT_FLOAT_EQ(eos::kernels::min_valid_range(ranges.data(), ranges.size(), 0.05f), 0.8f);
+    EXPECT_TRUE(std::isinf(eos::kernels::min_valid_range(ranges.data(), 3, 5.0f)));
+}
+
+// The active implementation is one the CPU runs, and unknown names change nothing
+TEST(Kernels, SelectsOnlyAvailableInstructionSets)
+{
+    const std::vector<std::string> available = eos::kernels::available_instruction_sets();
+    ASSERT_FALSE(available.empty());
+    const std::string active = eos::kernels::instruction_set();
+    EXPECT_NE(std::find(available.begin(), available.end(), active), available.end());
+
+    EXPECT_FALSE(eos::kernels::select_instruction_set("sse1"));
+    EXPECT_EQ(eos::kernels::instruction_set(), active);
+}
+
+// Every build linked in gives the results of the fallback build, which always runs
+TEST(Kernels, InstructionSetsAgree)
+{
+    const std::size_t rows = 5;
+    const std::size_t stride = 24;
+    const std::size_t count = 21;
+    // matvec loads aligned, so its operands come from AlignedBuffer as in the engine
+    eos::AlignedBuffer<float> weights(rows * stride), x(stride);
+    std::vector<float> ranges(count);
+    for (std::size_t i = 0; i < rows * stride; ++i) {
+        weights[i] = std::sin(0.37f * static_cast<float>(i));
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        x[i] = 0.1f * static_cast<float>(i % 5);
+        ranges[i] = 0.3f * static_cast<float>((i * 7) % 11);
+    }
+    ranges[4] = std::numeric_limits<float>::quiet_NaN();
+
+    struct Results
+    {
+        std::vector<float> y, sanitized, membrane, spikes;
+        std::size_t fired;
+        float sum, nearest;
+    };
+    const auto run_all = [&] {
+        Results r;
+        r.y.assign(rows, 0.0f);
+        eos::kernels::matvec(weights.data(), rows, stride, x.data(), r.y.data());
+        r.sanitized.assign(count, 0.0f);
+        eos::kernels::sanitize_ranges(ranges.data(), count, 0.1f, 3.0f, r.sanitized.data());
+        r.membrane.assign(x.begin(), x.begin() + count);
+        r.spikes.assign(count, 0.0f);
+        r.fired = eos::kernels::lif_step(r.membrane.data(), r.sanitized.data(), r.spikes.data(),
+                                         count, 0.9f, 1.0f);
+        r.sum = eos::kernels::reduce_sum(r.sanitized.data(), count);
+        r.nearest = eos::kernels::min_valid_range(ranges.data(), count, 0.1f);
+        return r;
+    };
+
+    const std::string active = eos::kernels::instruction_set();
+    const std::vector<std::string> available = eos::kernels::available_instruction_sets();
+    ASSERT_TRUE(eos::kernels::select_instruction_set(available.back()));
+    const Results expected = run_all();
+    for (const std::string& name : available) {
+        SCOPED_TRACE(name);
+        ASSERT_TRUE(eos::kernels::select_instruction_set(name));
+        EXPECT_EQ(eos::kernels::instruction_set(), name);
+        const Results r = run_all();
+        for (std::size_t i = 0; i < rows; ++i) {
+            EXPECT_NEAR(r.y[i], expected.y[i], 1e-5f);
+        }
+        EXPECT_EQ(r.sanitized, expected.sanitized);
+        EXPECT_EQ(r.spikes, expected.spikes);
+        EXPECT_EQ(r.fired, expected.fired);
+        EXPECT_NEAR(r.sum, expected.sum, 1e-5f);
+        EXPECT_FLOAT_EQ(r.nearest, expected.nearest);
+    }
+    eos::kernels::select_instruction_set(active);
+}
+
+// Output size follows the config and rates are bounded and deterministic
+TEST(LifEngine, ProducesBoundedDeterministicRates)
+{
+    eos::LifConfig config;
+    eos::LifEngine first(config);
+    eos::LifEngine second(config);
+
+    std::vector<float> input(config.input_size, 0.8f);
+    std::vector<float> out_a(config.output_size), out_b(config.output_size);
+    first.run(input.data(), out_a.data());
+    second.run(input.data(), out_b.data());
+
+    for (std::size_t i = 0; i < config.output_size; ++i) {
+        EXPECT_GE(out_a[i], 0.0f);
+        EXPECT_LE(out_a[i], 1.0f);
+        EXPECT_FLOAT_EQ(out_a[i], out_b[i]);
+    }
+}
+
+// A zero-sized topology is rejected
+TEST(LifEngine, RejectsEmptyTopology)
+{
+    eos::LifConfig config;
+    config.hidden_neurons = 0;
+    EXPECT_THROW(eos::LifEngine engine(config), std::invalid_argument);
+}
+
+// Dense and event-driven propagation must agree on the network output
+TEST(LifEngine, SparseAndDensePathsAgree)
+{
+    eos::LifConfig config;
+    config.hidden_neurons = 256;
+    config.synapse_prune_threshold = 0.02f;
+
+    config.propagation = eos::PropagationMode::Dense;
+    eos::LifEngine dense(config);
+    config.propagation = eos::PropagationMode::Sparse;
+    eos::LifEngine sparse(config);
+
+    std::vector<float> input(config.input_size);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<float>(i % 10) / 10.0f;
+    }
+    std::vector<float> out_dense(config.output_size), out_sparse(config.output_size);
+    dense.run(input.data(), out_dense.data());
+    sparse.run(input.data(), out_sparse.data());
+
+    EXPECT_GT(sparse.last_sparse_propagations(), 0u);
+    EXPECT_EQ(dense.last_sparse_propagations(), 0u);
+    for (std::size_t i = 0; i < config.output_size; ++i) {
+        EXPECT_FLOAT_EQ(out_dense[i], out_sparse[i]);
+    }
+}
+
+// A batch reproduces per-sample runs exactly for a fixed propagation path
+TEST(LifEngine, BatchMatchesIndividualRuns)
+{
+    for (const auto mode : {eos::PropagationMode::Dense, eos::PropagationMode::Sparse}) {
+        eos::LifConfig config;
+        config.input_size = 37;
+        config.propagation = mode;
+        config.max_batch = 6;
+        eos::LifEngine batched(config);
+        eos::LifEngine single(batched.model(), config);
+
+        // Five samples: one full SIMD block plus a tail, below max_batch
+        const std::size_t batch = 5;
+        std::vector<float> inputs(batch * config.input_size);
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            inputs[i] = static_cast<float>((i * 7) % 11) / 10.0f;
+        }
+        std::vector<float> outputs(batch * config.output_size);
+        batched.run_batch(inputs.data(), batch, outputs.data());
+
+        std::vector<float> expected(config.output_size);
+        for (std::size_t b = 0; b < batch; ++b) {
+            single.run(inputs.data() + b * config.input_size, expected.data());
+            const std::vector<float> actual(outputs.begin() + b * config.output_size,
+                                            outputs.begin() + (b + 1) * config.output_size);
+            EXPECT_EQ(actual, expected) << "sample " << b;
+        }
+        EXPECT_THROW(batched.run_batch(inputs.data(), 7, outputs.data()), std::invalid_argument);
+    }
+}
@@ -0,0 +1,152 @@
+// Unit tests for the .eosm model format and model/engine separation
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+
+namespace
+{
+
+std::string temp_path(const char* name)
+{
+    return testing::TempDir() + name + std::to_string(::getpid()) + ".eosm";
+}
+
+std::vector<float> ramp(std::size_t size)
+{
+    std::vector<float> values(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<float>(i % 10) / 10.0f;
+    }
+    return values;
+}
+
+}  // namespace
+
+// A saved and re-mapped model reproduces the weights and engine outputs exactly
+TEST(LifModel, SaveThenLoadRoundTrips)
+{
+    eos::LifConfig config;
+    config.input_size = 37;   // exercises row padding
+    config.hidden_neurons = 24;
+    const auto original = eos::LifModel::random(config);
+    const std::string path = temp_path("roundtrip");
+    eos::LifModel::save(*original, path);
+
+    const auto mapped = eos::LifModel::load(path);
+    EXPECT_TRUE(mapped->memory_mapped());
+    ASSERT_EQ(mapped->layers().size(), original->layers().size());
+    for (std::size_t l = 0; l < mapped->layers().size(); ++l) {
+        const eos::ModelLayer& a = original->layers()[l];
+        const eos::ModelLayer& b = mapped->layers()[l];
+        ASSERT_EQ(a.inputs, b.inputs);
+        ASSERT_EQ(a.neurons, b.neurons);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b.weights) % eos::kModelBlobAlignment, 0u);
+        for (std::size_t r = 0; r < a.neurons; ++r) {
+            for (std::size_t c = 0; c < a.inputs; ++c) {
+                ASSERT_EQ(a.weights[r * a.stride + c], b.weights[r * b.stride + c]);
+            }
+        }
+    }
+
+    eos::LifEngine from_memory(original, config);
+    eos::LifEngine from_file(mapped, config);
+    const std::vector<float> input = ramp(config.input_size);
+    std::vector<float> expected(config.output_size), actual(config.output_size);
+    from_memory.run(input.data(), expected.data());
+    from_file.run(input.data(), actual.data());
+    EXPECT_EQ(expected, actual);
+    std::remove(path.c_str());
+}
+
+// Engines sharing one model keep independent state
+TEST(LifModel, EnginesShareOneModel)
+{
+    eos::LifConfig config;
+    const auto model = eos::LifModel::random(config);
+    eos::LifEngine first(model, config);
+    eos::LifEngine second(model, config);
+    EXPECT_EQ(first.model().get(), second.model().get());
+    EXPECT_EQ(first.synapses().get(), second.synapses().get());
+
+    const std::vector<float> input = ramp(config.input_size);
+    std::vector<float> a(config.output_size), b(config.output_size);
+    first.run(input.data(), a.data());
+    second.run(input.data(), b.data());
+    EXPECT_EQ(a, b);
+}
+
+// Instances in one process get one model per file or seed, and one synapse layout per threshold
+TEST(LifModel, SharedLoadsReuseLiveModels)
+{
+    eos::LifConfig config;
+    const auto seeded = eos::LifModel::open_shared("", config);
+    EXPECT_EQ(eos::LifModel::open_shared("", config).get(), seeded.get());
+    config.seed += 1;
+    EXPECT_NE(eos::LifModel::open_shared("", config).get(), seeded.get());
+
+    const std::string path = temp_path("shared");
+    eos::LifModel::save(*seeded, path);
+    const auto mapped = eos::LifModel::load_shared(path);
+    EXPECT_EQ(eos::LifModel::open_shared(path, config).get(), mapped.get());
+
+    eos::LifConfig pruned = config;
+    pruned.synapse_prune_threshold = 0.05f;
+    eos::LifEngine a(mapped, config);
+    eos::LifEngine b(mapped, config);
+    eos::LifEngine c(mapped, pruned);
+    EXPECT_EQ(a.synapses().get(), b.synapses().get());
+    EXPECT_NE(a.synapses().get(), c.synapses().get());
+
+    // A rewritten file is a different model
+    const std::uint32_t seed = config.seed;
+    config.seed = seed + 7;
+    eos::LifModel::save(*eos::LifModel::random(config), path);
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) +
+                                               std::chrono::seconds(1));
+    EXPECT_NE(eos::LifModel::load_shared(path).get(), mapped.get());
+    std::remove(path.c_str());
+}
+
+// Corrupt or truncated files are rejected instead of mapped
+TEST(LifModel, RejectsMalformedFiles)
+{
+    eos::LifConfig config;
+    const std::string path = temp_path("malformed");
+    eos::LifModel::save(*eos::LifModel::random(config), path);
+
+    std::vector<char> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const auto write = [&path](const std::vector<char>& data) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+    std::vector<char> truncated(bytes.begin(), bytes.end() - 64);
+    write(truncated);
+    EXPECT_THROW(eos::LifModel::load(path), std::runtime_error);
+
+    std::vector<char> bad_magic = bytes;
+    bad_magic[0] = 'X';
+    write(bad_magic);
+    EXPECT_THROW(eos::LifModel::load(path), std::runtime_error);
+
+    EXPECT_THROW(eos::LifModel::load(path + ".missing"), std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,131 @@
+// Unit tests for staging replacement models onto a running NeuralBridge
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+#include "eos_robotics/model_loader.hpp"
+#include "eos_robotics/neural_backend.hpp"
+#include "eos_robotics/neural_bridge.hpp"
+
+namespace
+{
+
+std::string temp_path(const char* name)
+{
+    return testing::TempDir() + name + std::to_string(::getpid()) + ".eosm";
+}
+
+eos::ScanPreprocessorConfig preprocessing_for(const eos::LifConfig& config)
+{
+    eos::ScanPreprocessorConfig preprocessing;
+    preprocessing.bins = config.input_size;
+    return preprocessing;
+}
+
+struct LoadResult
+{
+    std::mutex mutex;
+    std::condition_variable done;
+    bool finished = false;
+    bool success = false;
+    std::string message;
+
+    eos::ModelLoader::Callback callback()
+    {
+        return [this](bool ok, const std::string& text) {
+            std::lock_guard<std::mutex> lock(mutex);
+            success = ok;
+            message = text;
+            finished = true;
+            done.notify_all();
+        };
+    }
+
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return done.wait_for(lock, std::chrono::seconds(10), [this]() { return finished; });
+    }
+};
+
+}  // namespace
+
+// A loaded model is staged, takes over at the next swap and the old engine is reclaimed
+TEST(ModelLoader, StagesModelForNextInference)
+{
+    eos::LifConfig config;
+    eos::NeuralBridge bridge("", config, preprocessing_for(config));
+    const eos::NeuralBackend* original = &bridge.backend();
+    EXPECT_FALSE(bridge.swap_staged());
+
+    eos::LifConfig replacement = config;
+    replacement.seed = config.seed + 1;
+    const std::string path = temp_path("reload");
+    eos::LifModel::save(*eos::LifModel::random(replacement), path);
+
+    LoadResult result;
+    {
+        eos::ModelLoader loader(bridge);
+        loader.request(path, result.callback());
+        ASSERT_TRUE(result.wait());
+    }
+    EXPECT_TRUE(result.success) << result.message;
+
+    EXPECT_TRUE(bridge.swap_staged());
+    EXPECT_NE(&bridge.backend(), original);
+    EXPECT_TRUE(bridge.backend().model()->memory_mapped());
+    EXPECT_FALSE(bridge.swap_staged());
+
+    // Staging reclaims the backend the last swap replaced, so the next swap can go ahead
+    bridge.stage(bridge.build_backend(eos::LifModel::random(config)));
+    const eos::NeuralBackend* loaded = &bridge.backend();
+    EXPECT_TRUE(bridge.swap_staged());
+    EXPECT_NE(&bridge.backend(), loaded);
+    bridge.reclaim_retired();
+
+    std::vector<float> features(bridge.input_size(), 0.5f);
+    std::vector<float> output(bridge.output_size());
+    bridge.process_features(features.data(), {}, {}, output.data());
+    std::remove(path.c_str());
+}
+
+// Models with a different topology or unreadable files are rejected and leave the engine alone
+TEST(ModelLoader, RejectsIncompatibleModels)
+{
+    eos::LifConfig config;
+    eos::NeuralBridge bridge("", config, preprocessing_for(config));
+
+    eos::LifConfig wider = config;
+    wider.output_size = config.output_size + 2;
+    const std::string path = temp_path("mismatch");
+    eos::LifModel::save(*eos::LifModel::random(wider), path);
+
+    LoadResult mismatch;
+    LoadResult missing;
+    {
+        eos::ModelLoader loader(bridge);
+        loader.request(path, mismatch.callback());
+        loader.request(path + ".missing", missing.callback());
+        ASSERT_TRUE(mismatch.wait());
+        ASSERT_TRUE(missing.wait());
+    }
+    EXPECT_FALSE(mismatch.success);
+    EXPECT_FALSE(missing.success);
+    EXPECT_FALSE(missing.message.empty());
+    EXPECT_FALSE(bridge.swap_staged());
+
+    EXPECT_THROW(bridge.stage(std::make_unique<eos::CpuBackend>(eos::LifModel::random(wider), wider)),
+                 std::invalid_argument);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,233 @@
+// Unit tests for the dynamic-window local planner
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/distance_field.hpp"
+#include "eos_robotics/navigation_controller.hpp"
+#include "eos_robotics/occupancy_grid.hpp"
+
+namespace
+{
+
+constexpr float kPi = 3.14159265f;
+
+/// 360-beam scan around the robot, every beam at @p range
+struct Scan
+{
+    explicit Scan(float range) : ranges(360, range) {}
+
+    void feed(eos::NavigationController& controller) const
+    {
+        controller.update_scan(ranges.data(), ranges.size(), 0.05f, 10.0f, -kPi,
+                               2.0f * kPi / static_cast<float>(ranges.size()));
+    }
+
+    /// Beam index closest to @p angle
+    std::size_t beam(float angle) const
+    {
+        return static_cast<std::size_t>(std::lround((angle + kPi) / (2.0f * kPi) * ranges.size())) %
+               ranges.size();
+    }
+
+    std::vector<float> ranges;
+};
+
+/// Integrate one control tick of @p command into @p pose
+void advance(eos::Pose2D& pose, const eos::VelocityCommand& command, float dt)
+{
+    pose.theta += command.angular * dt;
+    pose.x += command.linear * dt * std::cos(pose.theta);
+    pose.y += command.linear * dt * std::sin(pose.theta);
+}
+
+}  // namespace
+
+// Bad limits are rejected up front
+TEST(NavigationController, RejectsInvalidConfig)
+{
+    eos::NavigationControllerConfig config;
+    config.max_linear_acceleration = 0.0f;
+    EXPECT_THROW(eos::NavigationController{config}, std::invalid_argument);
+
+    config = eos::NavigationControllerConfig{};
+    config.angular_samples = 1;
+    EXPECT_THROW(eos::NavigationController{config}, std::invalid_argument);
+}
+
+// Nothing moves before the first scan
+TEST(NavigationController, HoldsStillWithoutScan)
+{
+    eos::NavigationController controller(eos::NavigationControllerConfig{});
+    const auto command = controller.compute_command(eos::Pose2D{});
+    EXPECT_EQ(command.linear, 0.0f);
+    EXPECT_EQ(command.angular, 0.0f);
+}
+
+// Commands ramp within the acceleration limits and never exceed the velocity limits
+TEST(NavigationController, RespectsDynamicWindow)
+{
+    eos::NavigationControllerConfig config;
+    eos::NavigationController controller(config);
+    Scan(5.0f).feed(controller);
+    controller.set_goal(eos::Pose2D{3.0f, 2.0f, 0.0f});
+
+    eos::Pose2D pose;
+    eos::VelocityCommand previous;
+    for (int tick = 0; tick < 60; ++tick) {
+        const auto command = controller.compute_command(pose);
+        EXPECT_LE(std::abs(command.linear - previous.linear),
+                  config.max_linear_acceleration * config.control_period + 1e-5f);
+        EXPECT_LE(std::abs(command.angular - previous.angular),
+                  config.max_angular_acceleration * config.control_period + 1e-5f);
+        EXPECT_GE(command.linear, 0.0f);
+        EXPECT_LE(command.linear, config.max_linear_velocity + 1e-5f);
+        EXPECT_LE(std::abs(command.angular), config.max_angular_velocity + 1e-5f);
+        EXPECT_GT(controller.evaluated_samples(), 0u);
+        previous = command;
+        advance(pose, command, config.control_period);
+    }
+    EXPECT_GT(previous.linear, 0.2f);
+}
+
+// A goal off to the left turns the robot left and it eventually arrives
+TEST(NavigationController, DrivesToGoal)
+{
+    eos::NavigationControllerConfig config;
+    eos::NavigationController controller(config);
+    Scan(8.0f).feed(controller);
+    controller.set_goal(eos::Pose2D{1.0f, 1.0f, 0.0f});
+
+    eos::Pose2D pose;
+    bool turned_left = false;
+    for (int tick = 0; tick < 600 && controller.has_goal(); ++tick) {
+        const auto command = controller.compute_command(pose);
+        turned_left = turned_left || command.angular > 0.1f;
+        advance(pose, command, config.control_period);
+    }
+    EXPECT_TRUE(turned_left);
+    EXPECT_FALSE(controller.has_goal());
+    EXPECT_NEAR(pose.x, 1.0f, 2.0f * config.goal_tolerance);
+    EXPECT_NEAR(pose.y, 1.0f, 2.0f * config.goal_tolerance);
+
+    // It holds at the goal instead of exploring on
+    const auto command = controller.compute_command(pose);
+    EXPECT_EQ(command.linear, 0.0f);
+}
+
+// A post on the straight line to the goal is driven around without contact
+TEST(NavigationController, DrivesAroundObstacle)
+{
+    eos::NavigationControllerConfig config;
+    eos::NavigationController controller(config);
+    controller.set_goal(eos::Pose2D{3.0f, 0.0f, 0.0f});
+
+    // Post of radius 0.2 m at (1.5, 0), ray-cast into a scan from each pose
+    const float post_x = 1.5f;
+    const float post_radius = 0.2f;
+    std::vector<float> ranges(360);
+    eos::Pose2D pose;
+    float closest = 1e9f;
+    float detour = 0.0f;
+    for (int tick = 0; tick < 600 && controller.has_goal(); ++tick) {
+        std::fill(ranges.begin(), ranges.end(), std::numeric_limits<float>::infinity());
+        for (int i = 0; i < 64; ++i) {
+            const float a = static_cast<float>(i) * 2.0f * kPi / 64.0f;
+            const float dx = post_x + post_radius * std::cos(a) - pose.x;
+            const float dy = post_radius * std::sin(a) - pose.y;
+            const float bearing = std::remainder(std::atan2(dy, dx) - pose.theta, 2.0f * kPi);
+            const std::size_t beam =
+                static_cast<std::size_t>(std::lround((bearing + kPi) / (2.0f * kPi) * 360.0f)) % 360;
+            ranges[beam] = std::min(ranges[beam], std::hypot(dx, dy));
+        }
+        controller.update_scan(ranges.data(), ranges.size(), 0.05f, 10.0f, -kPi, 2.0f * kPi / 360.0f);
+        advance(pose, controller.compute_command(pose), config.control_period);
+        closest = std::min(closest, std::hypot(pose.x - post_x, pose.y) - post_radius);
+        detour = std::max(detour, std::abs(pose.y));
+    }
+    EXPECT_FALSE(controller.has_goal());
+    EXPECT_GE(closest, config.robot_radius - 0.02f);
+    EXPECT_GT(detour, post_radius + config.robot_radius);
+    EXPECT_NEAR(pose.x, 3.0f, 2.0f * config.goal_tolerance);
+}
+
+// Surrounded within the robot radius, every rollout collides and the robot stops
+TEST(NavigationController, StopsWhenBoxedIn)
+{
+    eos::NavigationControllerConfig config;
+    eos::NavigationController controller(config);
+    Scan(0.5f * config.robot_radius).feed(controller);
+    controller.set_goal(eos::Pose2D{2.0f, 0.0f, 0.0f});
+
+    const auto command = controller.compute_command(eos::Pose2D{});
+    EXPECT_EQ(command.linear, 0.0f);
+    EXPECT_EQ(command.angular, 0.0f);
+    EXPECT_EQ(controller.admissible_samples(), 0u);
+}
+
+// Without a goal the robot explores forward through free space
+TEST(NavigationController, ExploresForwardWithoutGoal)
+{
+    eos::NavigationControllerConfig config;
+    eos::NavigationController controller(config);
+    std::vector<float> nan_scan(360, std::nanf(""));
+    controller.update_scan(nan_scan.data(), nan_scan.size(), 0.05f, 10.0f, -kPi, 2.0f * kPi / 360.0f);
+
+    eos::VelocityCommand command;
+    for (int tick = 0; tick < 20; ++tick) {
+        command = controller.compute_command(eos::Pose2D{});
+    }
+    EXPECT_GT(command.linear, 0.1f);
+    EXPECT_NEAR(command.angular, 0.0f, 0.05f);
+    EXPECT_EQ(controller.admissible_samples(), controller.evaluated_samples());
+}
+
+// Obstacles remembered by the map block rollouts the scan no longer sees
+TEST(NavigationController, KeepsClearOfMappedObstacles)
+{
+    eos::NavigationController controller(eos::NavigationControllerConfig{});
+    eos::OccupancyGridConfig map_config;
+    eos::OccupancyGrid map(map_config);
+    map.recenter(0.0f, 0.0f);
+
+    // A wall 0.825 m ahead, seen from 1.5 m behind the robot's current pose
+    Scan wall(std::numeric_limits<float>::infinity());
+    for (float angle = -0.6f; angle <= 0.6f; angle += 0.01f) {
+        wall.ranges[wall.beam(angle)] = 2.325f / std::cos(angle);
+    }
+    for (int i = 0; i < 3; ++i) {
+        map.integrate_scan(eos::Pose2D{-1.5f, 0.0f, 0.0f}, wall.ranges.data(),
+                           wall.ranges.size(), 0.05f, 10.0f, -kPi,
+                           2.0f * kPi / static_cast<float>(wall.ranges.size()));
+    }
+    ASSERT_TRUE(map.occupied(0.825f, 0.0f));
+    const eos::NavigationControllerConfig config;
+    eos::DistanceField field(map, config.robot_radius + config.safety_distance);
+
+    // The live scan sees nothing; only the map stops the robot at the wall
+    const Scan open(std::numeric_limits<float>::infinity());
+    const float dt = eos::NavigationControllerConfig{}.control_period;
+    eos::Pose2D blind;
+    for (int tick = 0; tick < 150; ++tick) {
+        open.feed(controller);
+        advance(blind, controller.compute_command(blind), dt);
+    }
+    EXPECT_GT(blind.x, 1.0f);
+
+    // With the field the robot keeps its radius from the wall
+    eos::NavigationController mapped(config);
+    mapped.use_map(&field);
+    eos::Pose2D pose;
+    for (int tick = 0; tick < 150; ++tick) {
+        open.feed(mapped);
+        advance(pose, mapped.compute_command(pose), dt);
+        ASSERT_GE(field.distance(pose.x, pose.y), config.robot_radius) << "tick " << tick;
+    }
+    // Distances run between cell centres
+    EXPECT_LT(pose.x, 0.825f - config.robot_radius + map_config.resolution);
+}
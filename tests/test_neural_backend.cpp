@@ -0,0 +1,85 @@
+// Unit tests for NeuralBackend selection and the backends built into this binary
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/lif_engine.hpp"
+#include "eos_robotics/lif_model.hpp"
+#include "eos_robotics/neural_backend.hpp"
+
+namespace
+{
+
+std::vector<float> ramp(std::size_t size)
+{
+    std::vector<float> values(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<float>(i % 10) / 10.0f;
+    }
+    return values;
+}
+
+}  // namespace
+
+// Backend names round-trip and unknown ones are rejected
+TEST(NeuralBackend, ParsesBackendNames)
+{
+    EXPECT_EQ(eos::parse_backend_type("cpu"), eos::BackendType::Cpu);
+    EXPECT_EQ(eos::parse_backend_type("cuda"), eos::BackendType::Cuda);
+    EXPECT_STREQ(eos::to_string(eos::BackendType::Cuda), "cuda");
+    EXPECT_THROW(eos::parse_backend_type("tpu"), std::invalid_argument);
+    EXPECT_TRUE(eos::backend_available(eos::BackendType::Cpu));
+}
+
+// The CPU backend is a LifEngine on the shared model
+TEST(NeuralBackend, CpuBackendMatchesEngine)
+{
+    eos::LifConfig config;
+    const auto model = eos::LifModel::random(config);
+    const auto backend = eos::make_backend(eos::BackendType::Cpu, model, config);
+    eos::LifEngine engine(model, config);
+    EXPECT_EQ(backend->model().get(), model.get());
+    EXPECT_EQ(backend->type(), eos::BackendType::Cpu);
+
+    const std::vector<float> input = ramp(config.input_size);
+    std::vector<float> expected(config.output_size), actual(config.output_size);
+    engine.run(input.data(), expected.data());
+    backend->run(input.data(), actual.data());
+    EXPECT_EQ(actual, expected);
+}
+
+// The CUDA backend agrees with dense CPU propagation, or is refused when not built in
+TEST(NeuralBackend, CudaBackendMatchesCpuOrIsUnavailable)
+{
+    eos::LifConfig config;
+    config.propagation = eos::PropagationMode::Dense;
+    const auto model = eos::LifModel::random(config);
+
+    if (!eos::backend_available(eos::BackendType::Cuda)) {
+        EXPECT_THROW(eos::make_backend(eos::BackendType::Cuda, model, config), std::runtime_error);
+        return;
+    }
+
+    std::unique_ptr<eos::NeuralBackend> gpu;
+    try {
+        gpu = eos::make_backend(eos::BackendType::Cuda, model, config);
+    }
+    catch (const std::runtime_error& e) {
+        GTEST_SKIP() << e.what();
+    }
+    eos::LifEngine cpu(model, config);
+
+    const std::vector<float> input = ramp(config.input_size);
+    std::vector<float> expected(config.output_size), actual(config.output_size);
+    cpu.run(input.data(), expected.data());
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        gpu->run(input.data(), actual.data());
+        // Summation order differs, so allow a neuron near threshold to flip once
+        for (std::size_t i = 0; i < actual.size(); ++i) {
+            EXPECT_LE(std::fabs(actual[i] - expected[i]), 1.0f / config.time_steps + 1e-6f);
+        }
+    }
+}
@@ -0,0 +1,197 @@
+// Unit tests for the rolling occupancy grid
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/occupancy_grid.hpp"
+
+namespace
+{
+
+constexpr float kPi = 3.14159265f;
+
+/// Centre of cell (0, 0) at the test resolution; beams from here end mid-cell
+constexpr float kCentre = 0.05f;
+const eos::Pose2D kOrigin{kCentre, kCentre, 0.0f};
+
+/// 360-beam scan around the sensor, every beam at @p range
+struct Scan
+{
+    explicit Scan(float range) : ranges(360, range) {}
+
+    void integrate(eos::OccupancyGrid& grid, const eos::Pose2D& pose) const
+    {
+        grid.integrate_scan(pose, ranges.data(), ranges.size(), 0.05f, 10.0f, -kPi,
+                            2.0f * kPi / static_cast<float>(ranges.size()));
+    }
+
+    std::vector<float> ranges;
+};
+
+eos::OccupancyGridConfig small_config()
+{
+    eos::OccupancyGridConfig config;
+    config.resolution = 0.1f;
+    config.cells = 64;
+    config.max_range = 3.0f;
+    return config;
+}
+
+}  // namespace
+
+// Sizes that are not whole tiles and inverted sensor models are rejected
+TEST(OccupancyGrid, RejectsInvalidConfig)
+{
+    eos::OccupancyGridConfig config = small_config();
+    config.cells = 48;
+    EXPECT_THROW(eos::OccupancyGrid{config}, std::invalid_argument);
+
+    config = small_config();
+    config.cells = 8;
+    EXPECT_THROW(eos::OccupancyGrid{config}, std::invalid_argument);
+
+    config = small_config();
+    config.miss_log_odds = 0.4f;
+    EXPECT_THROW(eos::OccupancyGrid{config}, std::invalid_argument);
+
+    config = small_config();
+    config.max_log_odds = 10.0f;
+    EXPECT_THROW(eos::OccupancyGrid{config}, std::invalid_argument);
+}
+
+// A ring of returns marks the ring occupied and the disc inside it free
+TEST(OccupancyGrid, MarksHitsAndClearsBeams)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    const Scan scan(1.0f);
+    for (int i = 0; i < 3; ++i) {
+        scan.integrate(grid, kOrigin);
+    }
+
+    EXPECT_EQ(grid.scans(), 3u);
+    EXPECT_TRUE(grid.occupied(1.05f, 0.05f));
+    EXPECT_TRUE(grid.occupied(-0.95f, 0.05f));
+    EXPECT_TRUE(grid.occupied(0.05f, 1.05f));
+    EXPECT_FALSE(grid.occupied(0.55f, 0.05f));
+    EXPECT_LT(grid.probability(0.55f, 0.05f), 0.5f);
+    EXPECT_GT(grid.probability(1.05f, 0.05f), 0.5f);
+    // Beyond the ring nothing was observed
+    EXPECT_FLOAT_EQ(grid.probability(1.5f, 0.05f), 0.5f);
+}
+
+// Returns past range_max clear the beam without leaving a hit
+TEST(OccupancyGrid, NoReturnOnlyClears)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    Scan scan(std::numeric_limits<float>::infinity());
+    scan.ranges[7] = std::numeric_limits<float>::quiet_NaN();
+    scan.integrate(grid, kOrigin);
+
+    EXPECT_LT(grid.probability(2.5f, 0.05f), 0.5f);
+    EXPECT_LT(grid.probability(-2.5f, 0.05f), 0.5f);
+    EXPECT_FALSE(grid.occupied(2.95f, 0.05f));
+}
+
+// A return reported at range_max means nothing was seen, not a wall there
+TEST(OccupancyGrid, ReturnAtRangeMaxIsNoHit)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    Scan scan(2.0f);
+    grid.integrate_scan(kOrigin, scan.ranges.data(), scan.ranges.size(), 0.05f, 2.0f, -kPi,
+                        2.0f * kPi / static_cast<float>(scan.ranges.size()));
+
+    EXPECT_FALSE(grid.occupied(kCentre + 2.0f, kCentre));
+    EXPECT_FALSE(grid.occupied(kCentre, kCentre - 2.0f));
+    EXPECT_LT(grid.probability(kCentre + 1.5f, kCentre), 0.5f);
+}
+
+// The scan is rotated by the robot heading before it is traced
+TEST(OccupancyGrid, UsesPoseHeading)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    // Only the beam straight ahead of the sensor returns
+    Scan scan(std::numeric_limits<float>::quiet_NaN());
+    scan.ranges[180] = 1.0f;
+    for (int i = 0; i < 3; ++i) {
+        scan.integrate(grid, eos::Pose2D{kCentre, kCentre, kPi / 2.0f});
+    }
+
+    EXPECT_TRUE(grid.occupied(0.05f, 1.05f));
+    EXPECT_FALSE(grid.occupied(1.05f, 0.05f));
+}
+
+// Repeated hits saturate, so a cell can still be cleared afterwards
+TEST(OccupancyGrid, LogOddsSaturate)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    const Scan ring(1.0f);
+    for (int i = 0; i < 100; ++i) {
+        ring.integrate(grid, kOrigin);
+    }
+    EXPECT_NEAR(grid.log_odds_cell(grid.cell_of(1.05f), grid.cell_of(0.05f)),
+                grid.config().max_log_odds, eos::OccupancyGrid::kLogOddsStep);
+
+    const Scan clear(2.0f);
+    for (int i = 0; i < 20; ++i) {
+        clear.integrate(grid, kOrigin);
+    }
+    EXPECT_FALSE(grid.occupied(1.05f, 0.05f));
+}
+
+// Moving the window keeps the cells that stay inside it and forgets the rest
+TEST(OccupancyGrid, RecenterKeepsOverlap)
+{
+    eos::OccupancyGrid grid(small_config());
+    grid.recenter(0.0f, 0.0f);
+    const Scan scan(1.0f);
+    for (int i = 0; i < 3; ++i) {
+        scan.integrate(grid, kOrigin);
+    }
+    ASSERT_TRUE(grid.occupied(-0.95f, 0.05f));
+
+    // 1.5 m east and north: the west side of the ring is still in the window
+    grid.recenter(1.5f, 1.5f);
+    EXPECT_EQ(grid.origin_x(), grid.cell_of(1.5f) - 32);
+    EXPECT_TRUE(grid.occupied(-0.95f, 0.05f));
+    EXPECT_TRUE(grid.occupied(1.05f, 0.05f));
+
+    // Cells that entered the window reuse storage and must start unknown
+    for (long cx = grid.origin_x(); cx < grid.origin_x() + 64; ++cx) {
+        for (long cy = grid.origin_y(); cy < grid.origin_y() + 64; ++cy) {
+            if (cx > grid.cell_of(3.2f) || cy > grid.cell_of(3.2f)) {
+                ASSERT_EQ(grid.log_odds_cell(cx, cy), 0.0f) << cx << ", " << cy;
+            }
+        }
+    }
+
+    // Back west far enough that the ring left the window and came back cleared
+    grid.recenter(-20.0f, 0.0f);
+    grid.recenter(0.0f, 0.0f);
+    EXPECT_FALSE(grid.occupied(-0.95f, 0.05f));
+    EXPECT_FLOAT_EQ(grid.probability(0.55f, 0.05f), 0.5f);
+}
+
+// Rays that leave the window stop at its edge
+TEST(OccupancyGrid, RaysStopAtWindowEdge)
+{
+    eos::OccupancyGridConfig config = small_config();
+    config.max_range = 10.0f;
+    eos::OccupancyGrid grid(config);
+    grid.recenter(0.0f, 0.0f);
+    Scan scan(std::numeric_limits<float>::infinity());
+    scan.ranges[180] = 8.0f;
+    scan.integrate(grid, kOrigin);
+
+    EXPECT_LT(grid.probability(3.15f, 0.05f), 0.5f);
+    EXPECT_FALSE(grid.contains_cell(grid.cell_of(8.0f), 0));
+    EXPECT_FALSE(grid.occupied(8.0f, 0.0f));
+}
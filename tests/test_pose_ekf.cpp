@@ -0,0 +1,145 @@
+// Unit tests for the odometry + IMU pose filter
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+
+#include "eos_robotics/pose_ekf.hpp"
+
+namespace
+{
+
+constexpr std::int64_t kMillisecond = 1000000;
+
+/// Ground truth of a robot on a constant (v, w) arc from the origin
+struct Arc
+{
+    double v;
+    double w;
+
+    double theta(double t) const { return w * t; }
+    double x(double t) const { return std::abs(w) > 1e-9 ? v / w * std::sin(w * t) : v * t; }
+    double y(double t) const { return std::abs(w) > 1e-9 ? v / w * (1.0 - std::cos(w * t)) : 0.0; }
+};
+
+}  // namespace
+
+// Non-positive noise is rejected
+TEST(PoseEkf, RejectsInvalidConfig)
+{
+    eos::PoseEkfConfig config;
+    config.gyro_stddev = 0.0;
+    EXPECT_THROW(eos::PoseEkf{config}, std::invalid_argument);
+}
+
+// The first odometry message initialises the filter; IMU samples before it are ignored
+TEST(PoseEkf, InitialisesFromOdometry)
+{
+    eos::PoseEkf ekf;
+    ekf.add_imu(1 * kMillisecond, 0.5, 1.0);
+    EXPECT_FALSE(ekf.initialized());
+    EXPECT_FALSE(ekf.estimate().valid);
+
+    ekf.add_odometry(2 * kMillisecond, 1.0, 2.0, 0.3, 0.4, 0.1);
+    const eos::PoseEstimate estimate = ekf.estimate();
+    EXPECT_TRUE(estimate.valid);
+    EXPECT_FLOAT_EQ(estimate.pose.x, 1.0f);
+    EXPECT_FLOAT_EQ(estimate.pose.theta, 0.3f);
+    EXPECT_FLOAT_EQ(estimate.linear_velocity, 0.4f);
+    EXPECT_EQ(estimate.stamp_ns, 2 * kMillisecond);
+}
+
+// Noisy odometry on a straight line is smoothed towards the truth
+TEST(PoseEkf, SmoothsNoisyOdometry)
+{
+    const Arc truth{0.5, 0.0};
+    eos::PoseEkf ekf;
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.02);
+
+    double raw_error = 0.0;
+    double filtered_error = 0.0;
+    for (int i = 0; i <= 200; ++i) {
+        const double t = 0.05 * i;
+        const double measured = truth.x(t) + noise(rng);
+        ekf.add_odometry(static_cast<std::int64_t>(t * 1e9), measured, noise(rng), noise(rng),
+                         truth.v + noise(rng), noise(rng));
+        if (i >= 100) {
+            raw_error += std::abs(measured - truth.x(t));
+            filtered_error += std::abs(ekf.state()(eos::PoseEkf::X) - truth.x(t));
+        }
+    }
+    EXPECT_LT(filtered_error, raw_error);
+    EXPECT_NEAR(ekf.state()(eos::PoseEkf::V), truth.v, 0.03);
+}
+
+// Between slow odometry messages the gyro keeps the heading current
+TEST(PoseEkf, TracksTurnsAtImuRate)
+{
+    const Arc truth{0.3, 0.8};
+    eos::PoseEkf ekf;
+    double last_odom_theta = 0.0;
+    for (int ms = 0; ms <= 2050; ms += 5) {
+        const double t = ms * 1e-3;
+        if (ms % 200 == 0) {
+            ekf.add_odometry(ms * kMillisecond, truth.x(t), truth.y(t), truth.theta(t), truth.v,
+                             truth.w);
+            last_odom_theta = truth.theta(t);
+        } else {
+            ekf.add_imu(ms * kMillisecond, truth.w, 0.0);
+        }
+    }
+    // 50 ms after the last odometry message
+    const double t = 2.05;
+    const eos::PoseEstimate estimate = ekf.estimate();
+    EXPECT_NEAR(estimate.pose.theta, truth.theta(t), 0.01);
+    EXPECT_GT(std::abs(last_odom_theta - truth.theta(t)), 0.03);
+    EXPECT_NEAR(estimate.pose.x, truth.x(t), 0.01);
+    EXPECT_NEAR(estimate.pose.y, truth.y(t), 0.01);
+}
+
+// Headings wrap at +/-pi without a jump through zero
+TEST(PoseEkf, WrapsHeading)
+{
+    eos::PoseEkf ekf;
+    ekf.add_odometry(0, 0.0, 0.0, 3.13, 0.0, 0.0);
+    ekf.add_odometry(50 * kMillisecond, 0.0, 0.0, -3.13, 0.0, 0.0);
+    const double theta = ekf.state()(eos::PoseEkf::Theta);
+    EXPECT_GT(std::abs(theta), 3.1);
+}
+
+// An odometry message older than the filter is applied without rewinding it
+TEST(PoseEkf, AppliesLateMeasurementsInPlace)
+{
+    eos::PoseEkf ekf;
+    ekf.add_odometry(0, 0.0, 0.0, 0.0, 0.0, 0.0);
+    ekf.add_imu(20 * kMillisecond, 0.0, 0.0);
+    ekf.add_odometry(10 * kMillisecond, 0.1, 0.0, 0.0, 0.0, 0.0);
+    EXPECT_EQ(ekf.stamp_ns(), 20 * kMillisecond);
+    EXPECT_GT(ekf.state()(eos::PoseEkf::X), 0.0);
+}
+
+// Extrapolation follows the arc of the current twist both ways and is clamped in time
+TEST(PoseEstimate, ExtrapolatesAlongArc)
+{
+    const Arc truth{0.4, 1.0};
+    eos::PoseEstimate estimate;
+    estimate.linear_velocity = static_cast<float>(truth.v);
+    estimate.angular_velocity = static_cast<float>(truth.w);
+    estimate.stamp_ns = 1000 * kMillisecond;
+    estimate.valid = true;
+
+    const eos::Pose2D ahead = estimate.at(1100 * kMillisecond, 0.5f);
+    EXPECT_NEAR(ahead.x, truth.x(0.1), 1e-5);
+    EXPECT_NEAR(ahead.y, truth.y(0.1), 1e-5);
+    EXPECT_NEAR(ahead.theta, truth.theta(0.1), 1e-5);
+
+    const eos::Pose2D capped = estimate.at(5000 * kMillisecond, 0.5f);
+    EXPECT_NEAR(capped.theta, truth.theta(0.5), 1e-5);
+    const eos::Pose2D before = estimate.at(900 * kMillisecond, 0.5f);
+    EXPECT_NEAR(before.x, truth.x(-0.1), 1e-5);
+    EXPECT_NEAR(before.theta, truth.theta(-0.1), 1e-5);
+}
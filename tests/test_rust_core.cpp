@@ -0,0 +1,111 @@
+// Unit tests for the C ABI of the Rust core, through the C++ wrappers
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/rust_core.hpp"
+
+namespace
+{
+
+EosNavigationParams navigation_params()
+{
+    EosNavigationParams params{};
+    params.max_linear_velocity = 0.5f;
+    params.max_angular_velocity = 1.0f;
+    params.max_acceleration = 0.3f;
+    params.safety_distance = 0.5f;
+    params.goal_tolerance = 0.1f;
+    params.obstacle_inflation = 0.3f;
+    return params;
+}
+
+EosScan scan_of(const std::vector<float>& ranges)
+{
+    EosScan scan{};
+    scan.ranges = ranges.data();
+    scan.count = ranges.size();
+    scan.angle_min = -3.14159f;
+    scan.angle_increment = 6.28318f / static_cast<float>(ranges.size());
+    scan.range_min = 0.1f;
+    scan.range_max = 10.0f;
+    return scan;
+}
+
+}  // namespace
+
+// With open space ahead the controller ramps up within its acceleration limit
+TEST(RustCore, NavigatorAcceleratesInFreeSpace)
+{
+    eos::RustNavigator navigator(navigation_params());
+    const std::vector<float> ranges(360, 5.0f);
+
+    const EosMotionCommand first = navigator.step(scan_of(ranges), nullptr, 0, nullptr);
+    EXPECT_GT(first.linear, 0.0f);
+    EXPECT_LE(first.linear, 0.3f * 0.1f + 1e-6f);
+
+    const EosMotionCommand second = navigator.step(scan_of(ranges), nullptr, 0, nullptr);
+    EXPECT_GT(second.linear, first.linear);
+    EXPECT_LE(second.linear, 0.5f);
+}
+
+// A wall at arm's length makes the path unsafe and the step fails
+TEST(RustCore, NavigatorRejectsUnsafePath)
+{
+    eos::RustNavigator navigator(navigation_params());
+    const std::vector<float> ranges(360, 0.2f);
+    EXPECT_THROW(navigator.step(scan_of(ranges), nullptr, 0, nullptr), std::runtime_error);
+
+    const EosMotionCommand stop = navigator.emergency_stop();
+    EXPECT_EQ(stop.linear, 0.0f);
+    EXPECT_EQ(stop.angular, 0.0f);
+}
+
+// Null buffers are reported as invalid arguments, not dereferenced
+TEST(RustCore, RejectsNullBuffers)
+{
+    eos::RustNavigator navigator(navigation_params());
+    EosScan scan = scan_of(std::vector<float>(10, 1.0f));
+    scan.ranges = nullptr;
+    EXPECT_THROW(navigator.step(scan, nullptr, 0, nullptr), std::invalid_argument);
+    EXPECT_EQ(eos_navigator_step(nullptr, &scan, nullptr, 0, nullptr, nullptr),
+              EOS_STATUS_INVALID_ARGUMENT);
+    EXPECT_STRNE(eos_last_error_message(), "");
+}
+
+// The SNN engine writes exactly output_size binary outputs in place
+TEST(RustCore, SnnProcessesFeaturesInPlace)
+{
+    EosNeuralParams params{};
+    params.input_size = 16;
+    params.output_size = 4;
+    params.hidden_layers = 1;
+    params.hidden_neurons = 8;
+    params.time_steps = 10;
+    params.spike_threshold = 0.5f;
+    const eos::RustSnn snn(params);
+
+    const std::vector<float> input(16, 1.0f);
+    std::vector<float> output(5, -1.0f);
+    snn.process(input.data(), output.data());
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_TRUE(output[i] == 0.0f || output[i] == 1.0f);
+    }
+    EXPECT_EQ(output[4], -1.0f);
+
+    EXPECT_THROW(snn.process(nullptr, output.data()), std::invalid_argument);
+}
+
+// A missing model file leaves the engine usable and reports why
+TEST(RustCore, SnnReportsLoadFailure)
+{
+    EosNeuralParams params{};
+    params.input_size = 4;
+    params.output_size = 2;
+    params.spike_threshold = 0.5f;
+    eos::RustSnn snn(params);
+    EXPECT_THROW(snn.load_model("/nonexistent/model.json"), std::runtime_error);
+}
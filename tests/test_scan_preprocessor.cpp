@@ -0,0 +1,75 @@
+// Unit tests for the LaserScan preprocessing stage
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "eos_robotics/scan_preprocessor.hpp"
+
+namespace
+{
+
+constexpr float kPi = 3.14159265358979f;
+
+}  // namespace
+
+// Invalid readings count as free space and bins take their nearest return
+TEST(ScanPreprocessor, MinBinningSanitizesAndNormalizes)
+{
+    eos::ScanPreprocessorConfig config;
+    config.bins = 4;
+    eos::ScanPreprocessor preprocessor(config);
+
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> ranges = {2.0f, 1.0f, inf, nan, 0.01f, 3.0f, 4.0f, 9.0f};
+    preprocessor.process(ranges.data(), ranges.size(), 0.1f, 4.0f, 0.0f, 0.1f);
+
+    const float* out = preprocessor.output();
+    EXPECT_FLOAT_EQ(out[0], 0.25f);  // min(2, 1) / 4
+    EXPECT_FLOAT_EQ(out[1], 1.0f);   // inf and NaN -> range_max
+    EXPECT_FLOAT_EQ(out[2], 0.75f);  // below range_min ignored, then 3
+    EXPECT_FLOAT_EQ(out[3], 1.0f);   // 4 and clamped 9
+}
+
+// Mean binning averages the sanitized ranges of each bin
+TEST(ScanPreprocessor, MeanBinningAverages)
+{
+    eos::ScanPreprocessorConfig config;
+    config.bins = 2;
+    config.strategy = eos::BinningStrategy::Mean;
+    eos::ScanPreprocessor preprocessor(config);
+
+    std::vector<float> ranges(20, 2.0f);
+    ranges[0] = 1.0f;
+    preprocessor.process(ranges.data(), ranges.size(), 0.1f, 4.0f, 0.0f, 0.1f);
+
+    EXPECT_NEAR(preprocessor.output()[0], (1.0f + 9 * 2.0f) / 10.0f / 4.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(preprocessor.output()[1], 0.5f);
+}
+
+// Sectors are centred on the heading even when the scan starts at 0 rad
+TEST(ScanPreprocessor, SectorBinningWrapsAroundHeading)
+{
+    eos::ScanPreprocessorConfig config;
+    config.bins = 4;
+    config.strategy = eos::BinningStrategy::Sector;
+    config.sector_fov = kPi;  // front half only, four 45 degree sectors
+    eos::ScanPreprocessor preprocessor(config);
+
+    const std::size_t beams = 360;
+    const float increment = 2.0f * kPi / beams;
+    std::vector<float> ranges(beams, 3.5f);
+    ranges[2] = 1.0f;           // just left of the heading -> sector 2
+    ranges[beams - 2] = 2.0f;   // just right of the heading -> sector 1
+    ranges[180] = 0.5f;         // behind the robot, outside the field of view
+    preprocessor.process(ranges.data(), beams, 0.1f, 4.0f, 0.0f, increment);
+
+    const float* out = preprocessor.output();
+    EXPECT_FLOAT_EQ(out[0], 3.5f / 4.0f);
+    EXPECT_FLOAT_EQ(out[1], 2.0f / 4.0f);
+    EXPECT_FLOAT_EQ(out[2], 1.0f / 4.0f);
+    EXPECT_FLOAT_EQ(out[3], 3.5f / 4.0f);
+}
@@ -0,0 +1,141 @@
+// Unit tests for the /eos/status delta encoder and process usage sampling
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include "eos_robotics/latency_histogram.hpp"
+#include "eos_robotics/status_telemetry.hpp"
+
+namespace
+{
+
+eos::StageLatencySample stage(std::uint8_t id, std::uint32_t p50, std::uint32_t p99,
+                              std::uint32_t max)
+{
+    eos::StageLatencySample sample;
+    sample.stage = id;
+    sample.p50_us = p50;
+    sample.p99_us = p99;
+    sample.max_us = max;
+    return sample;
+}
+
+}  // namespace
+
+// Summaries are converted to microseconds, clamped at zero and saturated
+TEST(StageLatencySample, ConvertsSummaryToMicroseconds)
+{
+    eos::LatencyHistogram histogram;
+    for (std::int64_t us = 1; us <= 100; ++us) {
+        histogram.record(us * 1000);
+    }
+    const auto sample = eos::StageLatencySample::from_summary(4, histogram.summarize());
+    EXPECT_EQ(sample.stage, 4u);
+    EXPECT_NEAR(sample.p50_us, 50.0, 50.0 / 16);
+    EXPECT_NEAR(sample.p99_us, 99.0, 99.0 / 16);
+    EXPECT_EQ(sample.max_us, 100u);
+
+    eos::HistogramSummary extreme;
+    extreme.p50_ns = -5;
+    extreme.max_ns = std::int64_t{1} << 62;
+    const auto clamped = eos::StageLatencySample::from_summary(0, extreme);
+    EXPECT_EQ(clamped.p50_us, 0u);
+    EXPECT_EQ(clamped.max_us, 0xffffffffu);
+}
+
+// Without delta encoding every message is a keyframe with every stage
+TEST(StatusDeltaEncoder, FullMessagesWithoutDelta)
+{
+    eos::StatusDeltaEncoder encoder;
+    const std::vector<eos::StageLatencySample> stages{stage(0, 10, 20, 30), stage(4, 100, 200, 300)};
+    std::vector<eos::StageLatencySample> out;
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        EXPECT_TRUE(encoder.encode(stages.data(), stages.size(), out));
+        EXPECT_EQ(out.size(), stages.size());
+        EXPECT_EQ(encoder.sequence(), i);
+    }
+}
+
+// Between keyframes only new stages and moves beyond the deadband are sent
+TEST(StatusDeltaEncoder, SendsOnlyChangedStagesBetweenKeyframes)
+{
+    eos::StatusEncoderConfig config;
+    config.delta = true;
+    config.keyframe_interval = 4;
+    config.deadband_us = 50;
+    eos::StatusDeltaEncoder encoder(config);
+
+    std::vector<eos::StageLatencySample> stages{stage(0, 100, 200, 300), stage(4, 1000, 2000, 3000)};
+    std::vector<eos::StageLatencySample> out;
+
+    ASSERT_TRUE(encoder.encode(stages.data(), stages.size(), out));
+    EXPECT_EQ(out.size(), 2u);
+
+    // Within the deadband: nothing to send
+    stages[0].p99_us += 50;
+    EXPECT_FALSE(encoder.encode(stages.data(), stages.size(), out));
+    EXPECT_TRUE(out.empty());
+
+    // Beyond it, and a stage seen for the first time
+    stages[1].max_us += 51;
+    stages.push_back(stage(10, 5, 6, 7));
+    EXPECT_FALSE(encoder.encode(stages.data(), stages.size(), out));
+    ASSERT_EQ(out.size(), 2u);
+    EXPECT_EQ(out[0].stage, 4u);
+    EXPECT_EQ(out[1].stage, 10u);
+
+    // Small steps are measured from the last value sent, so they cannot creep
+    stages[0].p99_us += 1;
+    EXPECT_FALSE(encoder.encode(stages.data(), stages.size(), out));
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].stage, 0u);
+
+    // keyframe_interval messages after the last keyframe
+    EXPECT_TRUE(encoder.encode(stages.data(), stages.size(), out));
+    EXPECT_EQ(out.size(), stages.size());
+    EXPECT_EQ(encoder.sequence(), 4u);
+}
+
+// A forced keyframe resends everything at the next message
+TEST(StatusDeltaEncoder, ForcedKeyframe)
+{
+    eos::StatusEncoderConfig config;
+    config.delta = true;
+    config.keyframe_interval = 100;
+    eos::StatusDeltaEncoder encoder(config);
+    const std::vector<eos::StageLatencySample> stages{stage(2, 1, 2, 3)};
+    std::vector<eos::StageLatencySample> out;
+
+    EXPECT_TRUE(encoder.encode(stages.data(), stages.size(), out));
+    EXPECT_FALSE(encoder.encode(stages.data(), stages.size(), out));
+    encoder.force_keyframe();
+    EXPECT_TRUE(encoder.encode(stages.data(), stages.size(), out));
+    EXPECT_EQ(out.size(), 1u);
+}
+
+// A keyframe interval of zero is rejected
+TEST(StatusDeltaEncoder, RejectsZeroKeyframeInterval)
+{
+    eos::StatusEncoderConfig config;
+    config.keyframe_interval = 0;
+    EXPECT_THROW(eos::StatusDeltaEncoder encoder(config), std::invalid_argument);
+}
+
+// Busy work shows up as CPU time and the process has resident memory
+TEST(ProcessUsage, ReportsCpuAndMemory)
+{
+    eos::ProcessUsage usage;
+    EXPECT_DOUBLE_EQ(usage.sample().cpu_percent, 0.0);
+
+    volatile double sink = 0.0;
+    const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+    while (std::chrono::steady_clock::now() < until) {
+        sink = sink + 1.0;
+    }
+    const eos::ProcessUsageSample sample = usage.sample();
+    EXPECT_GT(sample.cpu_percent, 10.0);
+    EXPECT_GT(sample.rss_kib, 0u);
+}
@@ -0,0 +1,262 @@
+// Unit tests for the topological memory, its spatial index and its journal
+
+#include <gtest/gtest.h>
+
+#include <sys/resource.h>
+
+#include <csignal>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "eos_robotics/topological_memory.hpp"
+
+namespace
+{
+
+std::string journal_path(const std::string& name)
+{
+    const auto path = std::filesystem::temp_directory_path() / ("eos_memory_" + name + ".journal");
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+// Drive a square loop of side @p side, @p laps times, in 0.1 m steps
+void drive_square(eos::TopologicalMemory& memory, float side, int laps, std::int64_t& stamp)
+{
+    const float headings[4] = {0.0f, 1.5707963f, 3.1415927f, -1.5707963f};
+    eos::Pose2D pose;
+    for (int lap = 0; lap < laps; ++lap) {
+        for (const float heading : headings) {
+            pose.theta = heading;
+            for (int step = 0; step < static_cast<int>(side * 10.0f + 0.5f); ++step) {
+                pose.x += 0.1f * std::cos(heading);
+                pose.y += 0.1f * std::sin(heading);
+                memory.observe(pose, stamp++);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// Nodes are laid every node_spacing along the path, not on every pose
+TEST(TopologicalMemory, LaysNodesAtSpacing)
+{
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    std::int64_t stamp = 1;
+    for (int i = 0; i <= 50; ++i) {
+        memory.observe(eos::Pose2D{0.1f * i, 0.0f, 0.0f}, stamp++);
+    }
+    EXPECT_EQ(memory.nodes().size(), 11u);
+    EXPECT_TRUE(memory.loop_closures().empty());
+
+    std::vector<eos::TrajectoryPoint> trajectory;
+    memory.trajectory(trajectory);
+    ASSERT_EQ(trajectory.size(), 51u);
+    EXPECT_EQ(trajectory.front().stamp_ns, 1);
+    EXPECT_EQ(trajectory.back().stamp_ns, 51);
+}
+
+// Driving the same loop again closes on the first lap's nodes instead of growing the map
+TEST(TopologicalMemory, RevisitClosesLoopsWithoutGrowing)
+{
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    std::int64_t stamp = 1;
+    drive_square(memory, 4.0f, 1, stamp);
+    const std::size_t first_lap = memory.nodes().size();
+    EXPECT_GT(first_lap, 20u);
+
+    drive_square(memory, 4.0f, 3, stamp);
+    EXPECT_LE(memory.nodes().size(), first_lap + 4);
+    EXPECT_GT(memory.loop_closures().size(), 2 * first_lap);
+}
+
+// Travelling back the other way is not a loop closure
+TEST(TopologicalMemory, HeadingMustMatch)
+{
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    std::int64_t stamp = 1;
+    for (int i = 0; i <= 100; ++i) {
+        memory.observe(eos::Pose2D{0.1f * i, 0.0f, 0.0f}, stamp++);
+    }
+    for (int i = 100; i >= 0; --i) {
+        memory.observe(eos::Pose2D{0.1f * i, 0.0f, 3.1415927f}, stamp++);
+    }
+    EXPECT_TRUE(memory.loop_closures().empty());
+}
+
+// Radius queries through the grid agree with a full scan
+TEST(TopologicalMemory, RadiusQueryMatchesBruteForce)
+{
+    eos::TopologicalMemoryConfig config;
+    config.loop_closure_min_separation = 1000000;
+    config.max_nodes = 100000;
+    eos::TopologicalMemory memory(config);
+    std::int64_t stamp = 1;
+    // A boustrophedon sweep lays a dense field of nodes
+    for (int row = 0; row < 100; ++row) {
+        for (int i = 0; i < 100; ++i) {
+            const float x = (row % 2 == 0) ? 0.6f * i : 0.6f * (99 - i);
+            memory.observe(eos::Pose2D{x, 0.6f * row, 0.0f}, stamp++);
+        }
+    }
+    ASSERT_GT(memory.nodes().size(), 5000u);
+
+    for (const float radius : {0.3f, 1.0f, 2.7f}) {
+        std::vector<std::size_t> found;
+        memory.query_radius(20.1f, 30.2f, radius, found);
+        std::size_t expected = 0;
+        for (const auto& node : memory.nodes()) {
+            const float dx = node.pose.x - 20.1f;
+            const float dy = node.pose.y - 30.2f;
+            expected += dx * dx + dy * dy <= radius * radius;
+        }
+        EXPECT_EQ(found.size(), expected) << "radius " << radius;
+    }
+}
+
+// No node is laid past max_nodes
+TEST(TopologicalMemory, StopsAtMaxNodes)
+{
+    eos::TopologicalMemoryConfig config;
+    config.max_nodes = 5;
+    eos::TopologicalMemory memory(config);
+    for (int i = 0; i < 100; ++i) {
+        memory.observe(eos::Pose2D{0.5f * i, 0.0f, 0.0f}, i);
+    }
+    EXPECT_EQ(memory.nodes().size(), 5u);
+    EXPECT_TRUE(memory.full());
+}
+
+// Appends only write what is new, and reopening replays all of it
+TEST(MemoryJournal, AppendsIncrementallyAndReplays)
+{
+    const std::string path = journal_path("replay");
+    std::int64_t stamp = 1;
+    std::size_t nodes = 0;
+    std::size_t closures = 0;
+    {
+        eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+        eos::MemoryJournal journal(path, memory);
+        drive_square(memory, 4.0f, 1, stamp);
+        const std::size_t first = journal.append(memory);
+        EXPECT_EQ(first, memory.nodes().size());
+        EXPECT_EQ(journal.append(memory), 0u);
+        drive_square(memory, 4.0f, 1, stamp);
+        EXPECT_EQ(journal.append(memory),
+                  memory.nodes().size() + memory.loop_closures().size() - first);
+        nodes = memory.nodes().size();
+        closures = memory.loop_closures().size();
+    }
+
+    eos::TopologicalMemory restored(eos::TopologicalMemoryConfig{});
+    eos::MemoryJournal journal(path, restored);
+    EXPECT_EQ(journal.restored(), nodes + closures);
+    ASSERT_EQ(restored.nodes().size(), nodes);
+    EXPECT_EQ(restored.loop_closures().size(), closures);
+    std::size_t revisited = 0;
+    for (const auto& node : restored.nodes()) {
+        revisited += node.visits > 1;
+    }
+    EXPECT_GT(revisited, 0u);
+    // Restored nodes can be closed on straight away
+    EXPECT_GE(restored.find_loop_closure(restored.nodes()[3].pose), 0);
+    std::filesystem::remove(path);
+}
+
+// A record torn by a crash is dropped and the journal stays appendable
+TEST(MemoryJournal, DropsTornTail)
+{
+    const std::string path = journal_path("torn");
+    {
+        eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+        eos::MemoryJournal journal(path, memory);
+        for (int i = 0; i < 10; ++i) {
+            memory.observe(eos::Pose2D{0.5f * i, 0.0f, 0.0f}, i);
+        }
+        journal.append(memory);
+    }
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 7);
+
+    {
+        eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+        eos::MemoryJournal journal(path, memory);
+        EXPECT_EQ(memory.nodes().size(), 9u);
+        memory.observe(eos::Pose2D{20.0f, 0.0f, 0.0f}, 100);
+        EXPECT_EQ(journal.append(memory), 1u);
+    }
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    eos::MemoryJournal journal(path, memory);
+    EXPECT_EQ(memory.nodes().size(), 10u);
+    EXPECT_FLOAT_EQ(memory.nodes().back().pose.x, 20.0f);
+    std::filesystem::remove(path);
+}
+
+// A batch cut short by a write error is retried whole, without duplicating its head
+TEST(MemoryJournal, FailedAppendLeavesNoPartialBatch)
+{
+    const std::string path = journal_path("failed");
+    std::size_t nodes = 0;
+    {
+        eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+        eos::MemoryJournal journal(path, memory);
+        for (int i = 0; i < 4; ++i) {
+            memory.observe(eos::Pose2D{0.5f * i, 0.0f, 0.0f}, i);
+        }
+        journal.append(memory);
+        const auto size = std::filesystem::file_size(path);
+        for (int i = 4; i < 400; ++i) {
+            memory.observe(eos::Pose2D{0.5f * i, 0.0f, 0.0f}, i);
+        }
+
+        // Let the file grow by a few records only, then fail with EFBIG
+        rlimit saved{};
+        ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &saved), 0);
+        const auto handler = std::signal(SIGXFSZ, SIG_IGN);
+        rlimit limit = saved;
+        limit.rlim_cur = size + 100;
+        ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+        EXPECT_THROW(journal.append(memory), std::runtime_error);
+        setrlimit(RLIMIT_FSIZE, &saved);
+        std::signal(SIGXFSZ, handler);
+        EXPECT_EQ(std::filesystem::file_size(path), size);
+
+        EXPECT_EQ(journal.append(memory), memory.nodes().size() - 4);
+        nodes = memory.nodes().size();
+    }
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    eos::MemoryJournal journal(path, memory);
+    EXPECT_EQ(journal.restored(), nodes);
+    EXPECT_EQ(memory.nodes().size(), nodes);
+    std::filesystem::remove(path);
+}
+
+// Other files are refused rather than overwritten
+TEST(MemoryJournal, RejectsForeignFiles)
+{
+    const std::string path = journal_path("foreign");
+    {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        std::fputs("{\"topological_map\": {}, \"padding\": 0}", file);
+        std::fclose(file);
+    }
+    eos::TopologicalMemory memory(eos::TopologicalMemoryConfig{});
+    EXPECT_THROW(eos::MemoryJournal(path, memory), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+// Invalid configurations are rejected up front
+TEST(TopologicalMemory, RejectsInvalidConfig)
+{
+    eos::TopologicalMemoryConfig config;
+    config.loop_closure_radius = 0.0f;
+    EXPECT_THROW(eos::TopologicalMemory{config}, std::invalid_argument);
+    config = eos::TopologicalMemoryConfig{};
+    config.trajectory_length = 0;
+    EXPECT_THROW(eos::TopologicalMemory{config}, std::invalid_argument);
+}
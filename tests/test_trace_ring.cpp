@@ -0,0 +1,127 @@
+// Unit tests for the per-thread trace rings and the Chrome trace dump
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <csignal>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "eos_robotics/trace_ring.hpp"
+
+namespace
+{
+
+std::size_t occurrences(const std::string& text, const std::string& needle)
+{
+    std::size_t count = 0;
+    for (std::size_t at = text.find(needle); at != std::string::npos;
+         at = text.find(needle, at + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace
+
+// Capacity rounds up to a power of two and a full ring keeps the newest events,
+// except the slot the owner would overwrite next
+TEST(ThreadRing, KeepsNewestEventsOnceFull)
+{
+    eos::trace::ThreadRing ring(20, 1, "test");
+    ASSERT_EQ(ring.capacity(), 32u);
+
+    std::vector<eos::trace::TraceEvent> events;
+    EXPECT_EQ(ring.snapshot(events), 0u);
+
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        ring.push(eos::trace::TraceEvent{static_cast<std::int64_t>(i), 1, "span", i});
+    }
+    EXPECT_EQ(ring.recorded(), 100u);
+    ASSERT_EQ(ring.snapshot(events), 31u);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(events[i].arg, 69u + i);
+    }
+}
+
+// A snapshot taken while the owner keeps writing returns only whole, ordered events
+TEST(ThreadRing, SnapshotWhileRecordingIsConsistent)
+{
+    eos::trace::ThreadRing ring(64, 1, "test");
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (std::uint64_t i = 0; !stop.load(std::memory_order_relaxed); ++i) {
+            const auto value = static_cast<std::int64_t>(i);
+            ring.push(eos::trace::TraceEvent{value, value, "span", i});
+        }
+    });
+
+    std::vector<eos::trace::TraceEvent> events;
+    for (int round = 0; round < 200; ++round) {
+        events.clear();
+        ring.snapshot(events);
+        ASSERT_LE(events.size(), ring.capacity());
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            ASSERT_EQ(events[i].start_ns, static_cast<std::int64_t>(events[i].arg));
+            ASSERT_EQ(events[i].duration_ns, events[i].start_ns);
+            if (i > 0) {
+                ASSERT_EQ(events[i].arg, events[i - 1].arg + 1);
+            }
+        }
+    }
+    stop = true;
+    writer.join();
+}
+
+// Every thread gets its own track, with spans as X and instants as i events
+TEST(Trace, DumpsCompleteAndInstantEventsPerThread)
+{
+    eos::trace::set_enabled(true);
+    const auto record = [] {
+        {
+            eos::trace::Scope scope("test_scope", 7);
+        }
+        eos::trace::instant("test_instant", 9);
+    };
+    record();
+    std::thread other(record);
+    other.join();
+
+    std::ostringstream out;
+    const std::size_t written = eos::trace::write_chrome_trace(out);
+    const std::string json = out.str();
+
+    EXPECT_GE(written, 4u);
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+    EXPECT_GE(occurrences(json, "\"name\":\"thread_name\""), 2u);
+    EXPECT_GE(occurrences(json, "\"name\":\"test_scope\",\"ph\":\"X\""), 2u);
+    EXPECT_GE(occurrences(json, "\"name\":\"test_instant\",\"ph\":\"i\""), 2u);
+    EXPECT_NE(json.find("\"args\":{\"arg\":7}"), std::string::npos);
+    EXPECT_EQ(occurrences(json, "{"), occurrences(json, "}"));
+}
+
+// Disabled recording leaves the rings untouched
+TEST(Trace, DisabledRecordsNothing)
+{
+    eos::trace::set_enabled(false);
+    eos::trace::instant("disabled_instant");
+    eos::trace::set_enabled(true);
+
+    std::ostringstream out;
+    eos::trace::write_chrome_trace(out);
+    EXPECT_EQ(out.str().find("disabled_instant"), std::string::npos);
+}
+
+// The signal handler only flags a dump, which is taken once
+TEST(Trace, SignalRequestsOneDump)
+{
+    EXPECT_FALSE(eos::trace::take_dump_request());
+    std::signal(SIGUSR1, eos::trace::request_dump_from_signal);
+    std::raise(SIGUSR1);
+    std::signal(SIGUSR1, SIG_DFL);
+    EXPECT_TRUE(eos::trace::take_dump_request());
+    EXPECT_FALSE(eos::trace::take_dump_request());
+}